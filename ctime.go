@@ -5,6 +5,10 @@ import (
 	cpkg "github.com/jurgen-kluft/ctime/package"
 )
 
+// Compiling a subset of the tz database into the library (source/main/cpp/c_timezone_data.cpp)
+// is an explicit step, run 'go generate' to regenerate it (see package/tzdata).
+//go:generate go run ./package/tzdata/generate
+
 func main() {
 	if ccode.Init() {
 		pkg := cpkg.GetPackage()
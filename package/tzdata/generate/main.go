@@ -0,0 +1,13 @@
+package main
+
+import (
+	tzdata "github.com/jurgen-kluft/ctime/package/tzdata"
+)
+
+// Regenerates source/main/cpp/c_timezone_data.cpp, run from the root of the repository with
+// 'go generate' or 'go run ./package/tzdata/generate'.
+func main() {
+	if err := tzdata.GenerateFromEnvironment(); err != nil {
+		panic(err)
+	}
+}
@@ -0,0 +1,255 @@
+package tzdata
+
+import (
+	"encoding/binary"
+	"errors"
+	"fmt"
+	"os"
+	"path/filepath"
+	"sort"
+	"strings"
+	"time"
+)
+
+// Generates source/main/cpp/c_timezone_data.cpp, the time zones that are compiled into the
+// ctime library. Every zone is stored as a 'slim' TZif version 2 image (empty version 1 block,
+// no leap second records, no standard/UT indicators) so that timezone_t reads compiled-in zones
+// exactly like memory-mapped zoneinfo files. Transitions before 'fromYear' are dropped, the
+// local time type in effect at that moment becomes type 0 so earlier instants use it.
+
+const (
+	DefaultZoneInfo = "/usr/share/zoneinfo"
+	DefaultFromYear = 1970
+	DefaultOutput   = "source/main/cpp/c_timezone_data.cpp"
+)
+
+// DefaultZones is the subset compiled in when CTIME_TZ_ZONES is not set
+var DefaultZones = []string{
+	"Africa/Johannesburg",
+	"America/Chicago",
+	"America/Denver",
+	"America/Los_Angeles",
+	"America/New_York",
+	"America/Sao_Paulo",
+	"Asia/Kolkata",
+	"Asia/Shanghai",
+	"Asia/Singapore",
+	"Asia/Tokyo",
+	"Australia/Sydney",
+	"Europe/Amsterdam",
+	"Europe/Berlin",
+	"Europe/London",
+	"Europe/Paris",
+	"Pacific/Auckland",
+}
+
+type ttinfo struct {
+	utoff  int32
+	isdst  uint8
+	desigi uint8
+}
+
+type zone struct {
+	name   string
+	times  []int64
+	idx    []uint8
+	types  []ttinfo
+	chars  []byte
+	footer string
+}
+
+// GenerateFromEnvironment is the opt-in 'go generate' step (package/tzdata/generate), it is
+// not run by the package generator. The zone subset can be selected with CTIME_TZ_ZONES (comma
+// separated) and the source directory with CTIME_TZ_ZONEINFO. When the zoneinfo directory is
+// not available the existing file is kept.
+func GenerateFromEnvironment() error {
+	zoneinfo := DefaultZoneInfo
+	if dir := os.Getenv("CTIME_TZ_ZONEINFO"); dir != "" {
+		zoneinfo = dir
+	}
+	zones := DefaultZones
+	if list := os.Getenv("CTIME_TZ_ZONES"); list != "" {
+		zones = strings.Split(list, ",")
+	}
+	if _, err := os.Stat(zoneinfo); err != nil {
+		return nil
+	}
+	return Generate(zoneinfo, zones, DefaultFromYear, DefaultOutput)
+}
+
+func Generate(zoneinfo string, names []string, fromYear int, output string) error {
+	from := time.Date(fromYear, time.January, 1, 0, 0, 0, 0, time.UTC).Unix()
+
+	zones := make([]*zone, 0, len(names))
+	for _, name := range names {
+		name = strings.TrimSpace(name)
+		if name == "" {
+			continue
+		}
+		data, err := os.ReadFile(filepath.Join(zoneinfo, filepath.FromSlash(name)))
+		if err != nil {
+			return err
+		}
+		z, err := parse(name, data)
+		if err != nil {
+			return fmt.Errorf("%s: %w", name, err)
+		}
+		zones = append(zones, z.trim(from))
+	}
+	// Sorted by name, the library binary searches the table
+	sort.Slice(zones, func(i, j int) bool { return zones[i].name < zones[j].name })
+
+	var sb strings.Builder
+	sb.WriteString("// Generated by package/tzdata, do not edit.\n")
+	sb.WriteString(fmt.Sprintf("// %d zones, transitions from %d.\n", len(zones), fromYear))
+	sb.WriteString("#include \"ccore/c_target.h\"\n\n")
+	sb.WriteString("#include \"ctime/private/c_timezone_data.h\"\n\n")
+	sb.WriteString("namespace ncore\n{\n    namespace ntzdata\n    {\n")
+	for i, z := range zones {
+		image := z.tzif()
+		sb.WriteString(fmt.Sprintf("        // %s, %d transitions\n", z.name, len(z.times)))
+		sb.WriteString(fmt.Sprintf("        static constexpr u8 sZone%d[%d] = {\n", i, len(image)))
+		for o := 0; o < len(image); o += 24 {
+			sb.WriteString("          ")
+			for k := o; k < o+24 && k < len(image); k++ {
+				sb.WriteString(fmt.Sprintf("0x%02x,", image[k]))
+			}
+			sb.WriteString("\n")
+		}
+		sb.WriteString("        };\n\n")
+	}
+	sb.WriteString("        static constexpr timezone_data_t sZones[] = {\n")
+	for i, z := range zones {
+		sb.WriteString(fmt.Sprintf("          {\"%s\", sZone%d, sizeof(sZone%d)},\n", z.name, i, i))
+	}
+	if len(zones) == 0 {
+		sb.WriteString("          {\"\", nullptr, 0},\n")
+	}
+	sb.WriteString("        };\n")
+	sb.WriteString("    } // namespace ntzdata\n\n")
+	sb.WriteString("    namespace ntime\n    {\n")
+	sb.WriteString("        const timezone_data_t* getBuiltinZones(s32& count)\n        {\n")
+	sb.WriteString(fmt.Sprintf("            count = %d;\n", len(zones)))
+	sb.WriteString("            return ntzdata::sZones;\n        }\n")
+	sb.WriteString("    } // namespace ntime\n")
+	sb.WriteString("} // namespace ncore\n")
+
+	return os.WriteFile(output, []byte(sb.String()), 0644)
+}
+
+func parse(name string, data []byte) (*zone, error) {
+	type header struct {
+		version                                               byte
+		isutcnt, isstdcnt, leapcnt, timecnt, typecnt, charcnt int
+	}
+	readHeader := func(b []byte) (header, error) {
+		if len(b) < 44 || string(b[:4]) != "TZif" {
+			return header{}, errors.New("not a TZif file")
+		}
+		u := func(o int) int { return int(binary.BigEndian.Uint32(b[o:])) }
+		return header{b[4], u(20), u(24), u(28), u(32), u(36), u(40)}, nil
+	}
+
+	h, err := readHeader(data)
+	if err != nil {
+		return nil, err
+	}
+	if h.version < '2' {
+		return nil, errors.New("version 1 TZif files are not supported")
+	}
+	v1 := h.timecnt*5 + h.typecnt*6 + h.charcnt + h.leapcnt*8 + h.isstdcnt + h.isutcnt
+	if len(data) < 44+v1 {
+		return nil, errors.New("truncated TZif file")
+	}
+	data = data[44+v1:]
+	if h, err = readHeader(data); err != nil {
+		return nil, err
+	}
+	size := h.timecnt*9 + h.typecnt*6 + h.charcnt + h.leapcnt*12 + h.isstdcnt + h.isutcnt
+	if len(data) < 44+size {
+		return nil, errors.New("truncated TZif file")
+	}
+	b := data[44:]
+
+	z := &zone{name: name}
+	for i := 0; i < h.timecnt; i++ {
+		z.times = append(z.times, int64(binary.BigEndian.Uint64(b[i*8:])))
+	}
+	b = b[h.timecnt*8:]
+	z.idx = append(z.idx, b[:h.timecnt]...)
+	b = b[h.timecnt:]
+	for i := 0; i < h.typecnt; i++ {
+		z.types = append(z.types, ttinfo{int32(binary.BigEndian.Uint32(b[i*6:])), b[i*6+4], b[i*6+5]})
+	}
+	b = b[h.typecnt*6:]
+	z.chars = append(z.chars, b[:h.charcnt]...)
+	b = b[h.charcnt+h.leapcnt*12+h.isstdcnt+h.isutcnt:]
+	if len(b) > 1 && b[0] == '\n' {
+		if end := strings.IndexByte(string(b[1:]), '\n'); end >= 0 {
+			z.footer = string(b[1 : 1+end])
+		}
+	}
+	return z, nil
+}
+
+// trim drops the transitions before 'from' and renumbers the types so that the type in
+// effect at 'from' is type 0, types that are no longer referenced are removed.
+func (z *zone) trim(from int64) *zone {
+	first := sort.Search(len(z.times), func(i int) bool { return z.times[i] >= from })
+	initial := uint8(0)
+	if first > 0 {
+		initial = z.idx[first-1]
+	}
+
+	out := &zone{name: z.name, chars: z.chars, footer: z.footer}
+	remap := map[uint8]uint8{}
+	use := func(t uint8) uint8 {
+		if n, ok := remap[t]; ok {
+			return n
+		}
+		n := uint8(len(out.types))
+		remap[t] = n
+		out.types = append(out.types, z.types[t])
+		return n
+	}
+	use(initial)
+	for i := first; i < len(z.times); i++ {
+		out.times = append(out.times, z.times[i])
+		out.idx = append(out.idx, use(z.idx[i]))
+	}
+	return out
+}
+
+func (z *zone) tzif() []byte {
+	var b []byte
+	u32 := func(v uint32) { b = binary.BigEndian.AppendUint32(b, v) }
+	header := func(timecnt, typecnt, charcnt int) {
+		b = append(b, 'T', 'Z', 'i', 'f', '2')
+		b = append(b, make([]byte, 15)...)
+		u32(0) // isutcnt
+		u32(0) // isstdcnt
+		u32(0) // leapcnt
+		u32(uint32(timecnt))
+		u32(uint32(typecnt))
+		u32(uint32(charcnt))
+	}
+
+	// Version 1 block, a single type and designation as RFC 8536 requires
+	header(0, 1, 1)
+	b = append(b, 0, 0, 0, 0, 0, 0, 0)
+
+	header(len(z.times), len(z.types), len(z.chars))
+	for _, t := range z.times {
+		b = binary.BigEndian.AppendUint64(b, uint64(t))
+	}
+	b = append(b, z.idx...)
+	for _, t := range z.types {
+		u32(uint32(t.utoff))
+		b = append(b, t.isdst, t.desigi)
+	}
+	b = append(b, z.chars...)
+	b = append(b, '\n')
+	b = append(b, z.footer...)
+	b = append(b, '\n')
+	return b
+}
@@ -0,0 +1,654 @@
+#include "ccore/c_target.h"
+#include "ccore/c_debug.h"
+
+#include "ctime/c_cron.h"
+#include "ctime/c_timezone.h"
+
+#include "ctime/private/c_bits.h"
+#include "ctime/private/c_calendar.h"
+#include "ctime/private/c_digits.h"
+
+namespace ncore
+{
+    using namespace ncalendar;
+    using namespace nbits;
+    using namespace ndigits;
+
+    static const u64 sTicksMask = D_CONSTANT_U64(0x3fffffffffffffff);
+
+    // Fields in the order of a 6 field expression
+    enum ECronField
+    {
+        CronSecond     = 0,
+        CronMinute     = 1,
+        CronHour       = 2,
+        CronDayOfMonth = 3,
+        CronMonth      = 4,
+        CronDayOfWeek  = 5,
+        CronFieldCount = 6,
+    };
+
+    static const s32 sFieldMin[CronFieldCount] = {0, 0, 0, 1, 1, 0};
+    static const s32 sFieldMax[CronFieldCount] = {59, 59, 23, 31, 12, 7};
+
+    static const u8 sDayOfMonthRestricted = 0x01;
+    static const u8 sDayOfWeekRestricted  = 0x02;
+    static const u8 sLastWeekday          = 0x04; ///< 'LW'
+
+    static const char* sMonthNames   = "JANFEBMARAPRMAYJUNJULAUGSEPOCTNOVDEC";
+    static const char* sWeekdayNames = "SUNMONTUEWEDTHUFRISAT";
+
+    struct cron_t::civil_t
+    {
+        s32 mYear;
+        s32 mMonth;
+        s32 mDay;
+        s32 mHour;
+        s32 mMinute;
+        s32 mSecond;
+    };
+
+    // ------------------------------------------------------------------------------------------
+    // Civil time
+
+    static inline void sToCivil(s64 ticks, s32& year, s32& month, s32& day, s32& hour, s32& minute, s32& second)
+    {
+        civilFromDays((s32)(ticks / TicksPerDay), year, month, day);
+        s32 const seconds = (s32)((ticks % TicksPerDay) / TicksPerSecond);
+        hour              = seconds / 3600;
+        minute            = (seconds / 60) % 60;
+        second            = seconds % 60;
+    }
+
+    static inline datetime_t sFromCivil(s32 year, s32 month, s32 day, s32 hour, s32 minute, s32 second)
+    {
+        s64 const ticks = (s64)daysFromCivil(year, month, day) * TicksPerDay + (s64)(hour * 3600 + minute * 60 + second) * TicksPerSecond;
+        return datetime_t((u64)ticks);
+    }
+
+    // ------------------------------------------------------------------------------------------
+    // Parsing
+
+    static inline bool sIsSpace(char c) { return c == ' ' || c == '\t'; }
+    static inline bool sIsDigit(char c) { return (u32)(c - '0') < 10; }
+
+    // A number or, for months and days of the week, a 3 letter name
+    static bool sParseValue(s32 field, const char* str, s32 len, s32& value)
+    {
+        if (len == 3 && !sIsDigit(str[0]) && (field == CronMonth || field == CronDayOfWeek))
+        {
+            const char* names = (field == CronMonth) ? sMonthNames : sWeekdayNames;
+            s32 const   count = (field == CronMonth) ? 12 : 7;
+            for (s32 i = 0; i < count; ++i)
+            {
+                const char* name = names + i * 3;
+                if (toUpper(str[0]) == name[0] && toUpper(str[1]) == name[1] && toUpper(str[2]) == name[2])
+                {
+                    value = (field == CronMonth) ? (i + 1) : i;
+                    return true;
+                }
+            }
+            return false;
+        }
+        return parseDigits(str, len, value) && value >= sFieldMin[field] && value <= sFieldMax[field];
+    }
+
+    static s32 sIndexOf(const char* str, s32 len, char c)
+    {
+        for (s32 i = 0; i < len; ++i)
+            if (str[i] == c)
+                return i;
+        return -1;
+    }
+
+    cron_t::cron_t() { reset(); }
+
+    void cron_t::reset()
+    {
+        mSeconds      = 1;
+        mMinutes      = D_CONSTANT_U64(0x0fffffffffffffff);
+        mNthWeekdays  = 0;
+        mHours        = 0x00ffffff;
+        mDays         = 0xfffffffe;
+        mNearestDays  = 0;
+        mLastDays     = 0;
+        mMonths       = 0x1ffe;
+        mWeekdays     = 0x7f;
+        mLastWeekdays = 0;
+        mFlags        = 0;
+    }
+
+    bool cron_t::parse(const char* str)
+    {
+        s32 len = 0;
+        while (str[len] != 0)
+            len += 1;
+        return parse(str, len);
+    }
+
+    bool cron_t::parse(const char* str, s32 len)
+    {
+        while (len > 0 && sIsSpace(str[0]))
+        {
+            str += 1;
+            len -= 1;
+        }
+        while (len > 0 && sIsSpace(str[len - 1]))
+            len -= 1;
+
+        if (len > 0 && str[0] == '@')
+        {
+            struct macro_t
+            {
+                const char* mName;
+                const char* mExpression;
+            };
+            static const macro_t sMacros[] = {
+              {"@yearly", "0 0 1 1 *"}, {"@annually", "0 0 1 1 *"}, {"@monthly", "0 0 1 * *"}, {"@weekly", "0 0 * * 0"}, {"@daily", "0 0 * * *"}, {"@midnight", "0 0 * * *"}, {"@hourly", "0 * * * *"},
+            };
+            for (s32 i = 0; i < (s32)(sizeof(sMacros) / sizeof(sMacros[0])); ++i)
+            {
+                const char* name = sMacros[i].mName;
+                s32         n    = 0;
+                while (n < len && name[n] != 0 && toUpper(name[n]) == toUpper(str[n]))
+                    n += 1;
+                if (n == len && name[n] == 0)
+                    return parse(sMacros[i].mExpression);
+            }
+            return false;
+        }
+
+        // Split into fields
+        const char* fields[CronFieldCount];
+        s32         lengths[CronFieldCount];
+        s32         count = 0;
+        s32         i     = 0;
+        while (i < len)
+        {
+            if (count == CronFieldCount)
+                return false;
+            s32 const start = i;
+            while (i < len && !sIsSpace(str[i]))
+                i += 1;
+            fields[count]  = str + start;
+            lengths[count] = i - start;
+            count += 1;
+            while (i < len && sIsSpace(str[i]))
+                i += 1;
+        }
+        if (count != 5 && count != 6)
+            return false;
+
+        // Into a copy, a failed parse leaves this one as it was
+        cron_t cron;
+        cron.mSeconds  = 0;
+        cron.mMinutes  = 0;
+        cron.mHours    = 0;
+        cron.mDays     = 0;
+        cron.mMonths   = 0;
+        cron.mWeekdays = 0;
+
+        s32 const first = CronFieldCount - count;
+        if (first == 1)
+            cron.mSeconds = 1;
+        for (s32 f = 0; f < count; ++f)
+        {
+            if (!cron.parseField(first + f, fields[f], lengths[f]))
+                return false;
+        }
+        *this = cron;
+        return true;
+    }
+
+    bool cron_t::parseField(s32 field, const char* str, s32 len)
+    {
+        // A day field starting with '*' or '?' does not restrict the days
+        if (field == CronDayOfMonth && str[0] != '*' && str[0] != '?')
+            mFlags |= sDayOfMonthRestricted;
+        if (field == CronDayOfWeek && str[0] != '*' && str[0] != '?')
+            mFlags |= sDayOfWeekRestricted;
+
+        while (len > 0)
+        {
+            s32 const comma = sIndexOf(str, len, ',');
+            s32 const n     = (comma < 0) ? len : comma;
+            if (!parseItem(field, str, n))
+                return false;
+            if (comma < 0)
+                break;
+            str += n + 1;
+            len -= n + 1;
+            if (len == 0)
+                return false; // trailing ','
+        }
+
+        switch (field)
+        {
+            case CronSecond: return mSeconds != 0;
+            case CronMinute: return mMinutes != 0;
+            case CronHour: return mHours != 0;
+            case CronDayOfMonth: return (mDays | mNearestDays | mLastDays) != 0 || (mFlags & sLastWeekday) != 0;
+            case CronMonth: return mMonths != 0;
+            case CronDayOfWeek:
+                // Sunday as 7 is Sunday as 0
+                mWeekdays = (u8)((mWeekdays | (mWeekdays >> 7)) & 0x7f);
+                return (mWeekdays | mLastWeekdays) != 0 || mNthWeekdays != 0;
+        }
+        return false;
+    }
+
+    bool cron_t::parseItem(s32 field, const char* str, s32 len)
+    {
+        if (len <= 0)
+            return false;
+
+        if (field == CronDayOfMonth && toUpper(str[0]) == 'L')
+        {
+            s32 offset = 0;
+            if (len == 1)
+                mLastDays |= 1;
+            else if (len == 2 && toUpper(str[1]) == 'W')
+                mFlags |= sLastWeekday;
+            else if (str[1] == '-' && parseDigits(str + 2, len - 2, offset) && offset < 31)
+                mLastDays |= (u32)1 << offset;
+            else
+                return false;
+            return true;
+        }
+        if (field == CronDayOfMonth && toUpper(str[len - 1]) == 'W')
+        {
+            s32 day;
+            if (!sParseValue(field, str, len - 1, day))
+                return false;
+            mNearestDays |= (u32)1 << day;
+            return true;
+        }
+        if (field == CronDayOfWeek && len > 1 && toUpper(str[len - 1]) == 'L')
+        {
+            s32 weekday;
+            if (!sParseValue(field, str, len - 1, weekday))
+                return false;
+            mLastWeekdays |= (u8)(1 << (weekday % 7));
+            return true;
+        }
+        s32 const hash = (field == CronDayOfWeek) ? sIndexOf(str, len, '#') : -1;
+        if (hash >= 0)
+        {
+            s32 weekday, nth;
+            if (!sParseValue(field, str, hash, weekday) || !parseDigits(str + hash + 1, len - hash - 1, nth) || nth < 1 || nth > 5)
+                return false;
+            mNthWeekdays |= D_CONSTANT_U64(1) << ((nth - 1) * 7 + (weekday % 7));
+            return true;
+        }
+
+        // [*|?|a|a-b][/step]
+        s32       step  = 1;
+        s32 const slash = sIndexOf(str, len, '/');
+        s32 const base  = (slash < 0) ? len : slash;
+        if (slash >= 0 && (!parseDigits(str + slash + 1, len - slash - 1, step) || step < 1))
+            return false;
+
+        s32 lo  = sFieldMin[field];
+        s32 hi  = (field == CronDayOfWeek) ? 6 : sFieldMax[field];
+        s32 max = hi;
+        if (base == 1 && (str[0] == '*' || str[0] == '?'))
+        {
+            if (str[0] == '?' && field != CronDayOfMonth && field != CronDayOfWeek)
+                return false;
+        }
+        else
+        {
+            s32 const dash = sIndexOf(str, base, '-');
+            if (dash < 0)
+            {
+                if (!sParseValue(field, str, base, lo))
+                    return false;
+                if (slash < 0)
+                    hi = lo;
+                else if (field == CronDayOfWeek && lo == 7)
+                    lo = 0;
+            }
+            else if (!sParseValue(field, str, dash, lo) || !sParseValue(field, str + dash + 1, base - dash - 1, hi))
+            {
+                return false;
+            }
+            if (field == CronDayOfWeek && lo > hi)
+            {
+                // A range wrapping around Sunday, 7 is 0
+                lo = lo % 7;
+                hi = hi % 7;
+            }
+            if (field == CronDayOfWeek && hi == 7)
+                max = 7;
+        }
+
+        // Values from 'lo' to 'hi', wrapping around from 'max' to the minimum when lo > hi
+        s32 const min   = sFieldMin[field];
+        s32 const span  = max - min + 1;
+        s32 const count = (hi >= lo) ? (hi - lo) : (hi - lo + span);
+        u64       bits  = 0;
+        for (s32 i = 0; i <= count; i += step)
+            bits |= D_CONSTANT_U64(1) << (min + (lo - min + i) % span);
+
+        switch (field)
+        {
+            case CronSecond: mSeconds |= bits; break;
+            case CronMinute: mMinutes |= bits; break;
+            case CronHour: mHours |= (u32)bits; break;
+            case CronDayOfMonth: mDays |= (u32)bits; break;
+            case CronMonth: mMonths |= (u16)bits; break;
+            case CronDayOfWeek: mWeekdays |= (u8)bits; break;
+        }
+        return true;
+    }
+
+    // ------------------------------------------------------------------------------------------
+    // Matching
+
+    u32 cron_t::daysOf(s32 year, s32 month) const
+    {
+        s32 const days  = daysInMonth(year, month);
+        u32 const all   = (((u32)1 << days) - 1) << 1;
+        s32 const first = dayOfWeek(daysFromCivil(year, month, 1)); // of day 1
+
+        u32 dom = mDays & all;
+        for (u32 m = mLastDays; m != 0; m &= m - 1)
+        {
+            s32 const day = days - lowestBit(m);
+            if (day >= 1)
+                dom |= (u32)1 << day;
+        }
+        for (u32 m = mNearestDays; m != 0; m &= m - 1)
+        {
+            s32 const n = lowestBit(m);
+            if (n > days)
+                continue;
+            s32 const weekday = (first + n - 1) % 7;
+            s32       day     = n;
+            if (weekday == Saturday)
+                day = (n == 1) ? 3 : (n - 1);
+            else if (weekday == Sunday)
+                day = (n == days) ? (n - 2) : (n + 1);
+            dom |= (u32)1 << day;
+        }
+        if (mFlags & sLastWeekday)
+        {
+            s32 const weekday = (first + days - 1) % 7;
+            dom |= (u32)1 << (days - ((weekday == Saturday) ? 1 : ((weekday == Sunday) ? 2 : 0)));
+        }
+
+        // 'dL' is the nth last weekday 'd' with n = 1, bits 0 - 6
+        u32 const dow = weekdaysOfMonth(first, days, mWeekdays, mNthWeekdays, mLastWeekdays);
+
+        // Either one when both are restricted, otherwise both (a '*' matches every day)
+        u8 const both = sDayOfMonthRestricted | sDayOfWeekRestricted;
+        return ((mFlags & both) == both) ? (dom | dow) : (dom & dow);
+    }
+
+    bool cron_t::matches(datetime_t time) const
+    {
+        civil_t c;
+        sToCivil((s64)(time.ticks() & sTicksMask), c.mYear, c.mMonth, c.mDay, c.mHour, c.mMinute, c.mSecond);
+        return ((mSeconds >> c.mSecond) & 1) && ((mMinutes >> c.mMinute) & 1) && ((mHours >> c.mHour) & 1) && ((mMonths >> c.mMonth) & 1) && ((daysOf(c.mYear, c.mMonth) >> c.mDay) & 1);
+    }
+
+    // Fields that overflowed (e.g. second 60, day 32 or month 13) carry into the field above
+    bool cron_t::nextCivil(civil_t& c) const
+    {
+        s32 const limit = c.mYear + 400; // the Gregorian calendar repeats every 400 years
+        s32       key   = -1;
+        u32       days  = 0;
+        for (;;)
+        {
+            if (c.mYear > limit || c.mYear > 9999)
+                return false;
+
+            s32 const month = nextBit(mMonths, c.mMonth);
+            if (month < 0)
+            {
+                c.mYear += 1;
+                c.mMonth = 1;
+                c.mDay   = 1;
+                c.mHour = c.mMinute = c.mSecond = 0;
+                continue;
+            }
+            if (month != c.mMonth)
+            {
+                c.mMonth = month;
+                c.mDay   = 1;
+                c.mHour = c.mMinute = c.mSecond = 0;
+            }
+
+            if (key != c.mYear * 16 + c.mMonth)
+            {
+                key  = c.mYear * 16 + c.mMonth;
+                days = daysOf(c.mYear, c.mMonth);
+            }
+            s32 const day = nextBit(days, c.mDay);
+            if (day < 0)
+            {
+                c.mMonth += 1;
+                c.mDay  = 1;
+                c.mHour = c.mMinute = c.mSecond = 0;
+                continue;
+            }
+            if (day != c.mDay)
+            {
+                c.mDay  = day;
+                c.mHour = c.mMinute = c.mSecond = 0;
+            }
+
+            s32 const hour = nextBit(mHours, c.mHour);
+            if (hour < 0)
+            {
+                c.mDay += 1;
+                c.mHour = c.mMinute = c.mSecond = 0;
+                continue;
+            }
+            if (hour != c.mHour)
+            {
+                c.mHour   = hour;
+                c.mMinute = c.mSecond = 0;
+            }
+
+            s32 const minute = nextBit(mMinutes, c.mMinute);
+            if (minute < 0)
+            {
+                c.mHour += 1;
+                c.mMinute = c.mSecond = 0;
+                continue;
+            }
+            if (minute != c.mMinute)
+            {
+                c.mMinute = minute;
+                c.mSecond = 0;
+            }
+
+            s32 const second = nextBit(mSeconds, c.mSecond);
+            if (second < 0)
+            {
+                c.mMinute += 1;
+                c.mSecond = 0;
+                continue;
+            }
+            c.mSecond = second;
+            return true;
+        }
+    }
+
+    // Fields that underflowed (e.g. second -1, day 0 or month 0) borrow from the field above
+    bool cron_t::prevCivil(civil_t& c) const
+    {
+        s32 const limit = c.mYear - 400;
+        s32       key   = -1;
+        u32       days  = 0;
+        for (;;)
+        {
+            if (c.mYear < limit || c.mYear < 1)
+                return false;
+
+            s32 const month = prevBit(mMonths, c.mMonth);
+            if (month < 0)
+            {
+                c.mYear -= 1;
+                c.mMonth = 12;
+                c.mDay   = 31;
+                c.mHour  = 23;
+                c.mMinute = c.mSecond = 59;
+                continue;
+            }
+            if (month != c.mMonth)
+            {
+                c.mMonth  = month;
+                c.mDay    = 31;
+                c.mHour   = 23;
+                c.mMinute = c.mSecond = 59;
+            }
+
+            if (key != c.mYear * 16 + c.mMonth)
+            {
+                key  = c.mYear * 16 + c.mMonth;
+                days = daysOf(c.mYear, c.mMonth);
+            }
+            s32 const day = prevBit(days, c.mDay);
+            if (day < 0)
+            {
+                c.mMonth -= 1;
+                c.mDay    = 31;
+                c.mHour   = 23;
+                c.mMinute = c.mSecond = 59;
+                continue;
+            }
+            if (day != c.mDay)
+            {
+                c.mDay    = day;
+                c.mHour   = 23;
+                c.mMinute = c.mSecond = 59;
+            }
+
+            s32 const hour = prevBit(mHours, c.mHour);
+            if (hour < 0)
+            {
+                c.mDay -= 1;
+                c.mHour   = 23;
+                c.mMinute = c.mSecond = 59;
+                continue;
+            }
+            if (hour != c.mHour)
+            {
+                c.mHour   = hour;
+                c.mMinute = c.mSecond = 59;
+            }
+
+            s32 const minute = prevBit(mMinutes, c.mMinute);
+            if (minute < 0)
+            {
+                c.mHour -= 1;
+                c.mMinute = c.mSecond = 59;
+                continue;
+            }
+            if (minute != c.mMinute)
+            {
+                c.mMinute = minute;
+                c.mSecond = 59;
+            }
+
+            s32 const second = prevBit(mSeconds, c.mSecond);
+            if (second < 0)
+            {
+                c.mMinute -= 1;
+                c.mSecond = 59;
+                continue;
+            }
+            c.mSecond = second;
+            return true;
+        }
+    }
+
+    bool cron_t::nextFrom(const civil_t& start, datetime_t after, datetime_t& out, const timezone_t* tz) const
+    {
+        civil_t c = start;
+        for (;;)
+        {
+            if (!nextCivil(c))
+                return false;
+            datetime_t const local = sFromCivil(c.mYear, c.mMonth, c.mDay, c.mHour, c.mMinute, c.mSecond);
+            if (tz == nullptr)
+            {
+                out = local;
+                return true;
+            }
+
+            // A gap moves it forward, the second instant of an overlap is before 'after'
+            out = tz->localToUtc(local);
+            if (out > after)
+                return true;
+            c.mSecond += 1;
+        }
+    }
+
+    bool cron_t::next(datetime_t after, datetime_t& out, const timezone_t* tz) const
+    {
+        datetime_t const from  = (tz != nullptr) ? tz->utcToLocal(after) : after;
+        s64 const        ticks = (s64)(from.ticks() & sTicksMask);
+        civil_t          c;
+        sToCivil(ticks - ticks % TicksPerSecond, c.mYear, c.mMonth, c.mDay, c.mHour, c.mMinute, c.mSecond);
+        c.mSecond += 1;
+        return nextFrom(c, after, out, tz);
+    }
+
+    bool cron_t::prev(datetime_t before, datetime_t& out, const timezone_t* tz) const
+    {
+        datetime_t const from  = (tz != nullptr) ? tz->utcToLocal(before) : before;
+        s64 const        ticks = (s64)(from.ticks() & sTicksMask);
+        civil_t          c;
+        sToCivil(((ticks + TicksPerSecond - 1) / TicksPerSecond) * TicksPerSecond, c.mYear, c.mMonth, c.mDay, c.mHour, c.mMinute, c.mSecond);
+        c.mSecond -= 1;
+        for (;;)
+        {
+            if (!prevCivil(c))
+                return false;
+            datetime_t const local = sFromCivil(c.mYear, c.mMonth, c.mDay, c.mHour, c.mMinute, c.mSecond);
+            if (tz == nullptr)
+            {
+                out = local;
+                return true;
+            }
+            out = tz->localToUtc(local);
+            if (out < before)
+                return true;
+            c.mSecond -= 1;
+        }
+    }
+
+    // 'after' is decomposed once for all the schedules
+    s64 cron_t::sNext(const cron_t* crons, s64 count, datetime_t after, datetime_t* out, u64* failMask, const timezone_t* tz)
+    {
+        datetime_t const from  = (tz != nullptr) ? tz->utcToLocal(after) : after;
+        s64 const        ticks = (s64)(from.ticks() & sTicksMask);
+        civil_t          start;
+        sToCivil(ticks - ticks % TicksPerSecond, start.mYear, start.mMonth, start.mDay, start.mHour, start.mMinute, start.mSecond);
+        start.mSecond += 1;
+
+        if (failMask != nullptr)
+        {
+            for (s64 i = 0; i < (count + 63) / 64; ++i)
+                failMask[i] = 0;
+        }
+
+        s64 found = 0;
+        for (s64 i = 0; i < count; ++i)
+        {
+            if (crons[i].nextFrom(start, after, out[i], tz))
+            {
+                found += 1;
+                continue;
+            }
+            out[i] = datetime_t::sMaxValue;
+            if (failMask != nullptr)
+                failMask[i >> 6] |= D_CONSTANT_U64(1) << (i & 63);
+        }
+        return found;
+    }
+
+}; // namespace ncore
@@ -0,0 +1,213 @@
+#include "ccore/c_debug.h"
+
+#include "ctime/c_date.h"
+#include "ctime/c_datetime.h"
+
+#include "ctime/private/c_calendar.h"
+
+namespace ncore
+{
+    using namespace ncalendar;
+
+    static const u64 sTicksMask = D_CONSTANT_U64(0x3fffffffffffffff);
+    static const s32 sMaxDays   = 3652058; // 9999-12-31
+
+    // ------------------------------------------------------------------------------------------
+    // date_t
+
+    const date_t date_t::sMaxValue = date_t::sFromDayNumber(sMaxDays);
+    const date_t date_t::sMinValue = date_t::sFromDayNumber(0);
+
+    date_t::date_t()
+        : mDays(0)
+    {
+    }
+
+    /**
+     *   year:          The year (1 through 9999).
+     *   month:         The month (1 through 12).
+     *   day:           The day (1 through the number of days in month).
+     */
+    date_t::date_t(s32 year, s32 month, s32 day)
+    {
+        ASSERTS(year >= 1 && year <= 9999 && month >= 1 && month <= 12 && day >= 1 && day <= daysInMonth(year, month), "Invalid input!");
+        mDays = daysFromCivil(year, month, day);
+    }
+
+    date_t::date_t(datetime_t dt)
+        : mDays((s32)((s64)(dt.ticks() & sTicksMask) / TicksPerDay))
+    {
+    }
+
+    datetime_t date_t::toDateTime() const { return datetime_t((u64)((s64)mDays * TicksPerDay)); }
+    datetime_t date_t::toDateTime(time_of_day_t tod) const { return datetime_t((u64)((s64)mDays * TicksPerDay + tod.ticks())); }
+
+    s32 date_t::year() const
+    {
+        s32 y, m, d;
+        civilFromDays(mDays, y, m, d);
+        return y;
+    }
+
+    EMonth date_t::month() const
+    {
+        s32 y, m, d;
+        civilFromDays(mDays, y, m, d);
+        return (EMonth)m;
+    }
+
+    s32 date_t::day() const
+    {
+        s32 y, m, d;
+        civilFromDays(mDays, y, m, d);
+        return d;
+    }
+
+    EDayOfWeek date_t::dayOfWeek() const { return (EDayOfWeek)ncalendar::dayOfWeek(mDays); }
+
+    s32 date_t::dayOfYear() const { return mDays - daysFromCivil(year(), 1, 1) + 1; }
+
+    void date_t::decompose(s32& year, s32& month, s32& day) const { civilFromDays(mDays, year, month, day); }
+
+    date_t& date_t::addDays(s32 value)
+    {
+        s64 const days = (s64)mDays + value;
+        ASSERTS(days >= 0 && days <= sMaxDays, "Error: out of range!");
+        mDays = (s32)(days < 0 ? 0 : (days > sMaxDays ? sMaxDays : days));
+        return *this;
+    }
+
+    date_t& date_t::addMonths(s32 months)
+    {
+        s32 y, m, d;
+        civilFromDays(mDays, y, m, d);
+        s32 const index = (y * 12 + (m - 1)) + months;
+        ASSERTS(index >= 12 && index < (10000 * 12), "Error: out of range!");
+        y             = index / 12;
+        m             = (index % 12) + 1;
+        s32 const dim = daysInMonth(y, m);
+        mDays         = daysFromCivil(y, m, d > dim ? dim : d);
+        return *this;
+    }
+
+    date_t& date_t::addYears(s32 value) { return addMonths(value * 12); }
+
+    date_t date_t::sFromDayNumber(s32 days)
+    {
+        ASSERTS(days >= 0 && days <= sMaxDays, "Error: out of range!");
+        date_t d;
+        d.mDays = days;
+        return d;
+    }
+
+    date_t date_t::sToday() { return date_t(datetime_t::sNow()); }
+
+    // ------------------------------------------------------------------------------------------
+    // time_of_day_t
+
+    const time_of_day_t time_of_day_t::sMidnight = time_of_day_t::sFromUnits(0);
+    const time_of_day_t time_of_day_t::sMaxValue = time_of_day_t::sFromUnits(time_of_day_t::UnitsPerDay - 1);
+
+    time_of_day_t::time_of_day_t()
+        : mUnits(0)
+    {
+    }
+
+    time_of_day_t::time_of_day_t(s32 hour, s32 minute, s32 second)
+    {
+        ASSERTS(hour >= 0 && hour < 24 && minute >= 0 && minute < 60 && second >= 0 && second < 60, "Invalid input!");
+        mUnits = (u32)((hour * 3600 + minute * 60 + second) * UnitsPerSecond);
+    }
+
+    time_of_day_t::time_of_day_t(s32 hour, s32 minute, s32 second, s32 millisecond)
+    {
+        ASSERTS(hour >= 0 && hour < 24 && minute >= 0 && minute < 60 && second >= 0 && second < 60 && millisecond >= 0 && millisecond < 1000, "Invalid input!");
+        mUnits = (u32)((hour * 3600 + minute * 60 + second) * UnitsPerSecond + millisecond * (UnitsPerSecond / 1000));
+    }
+
+    time_of_day_t::time_of_day_t(datetime_t dt)
+        : mUnits((u32)(((s64)(dt.ticks() & sTicksMask) % TicksPerDay) / TicksPerUnit))
+    {
+    }
+
+    s32 time_of_day_t::hour() const { return (s32)(mUnits / (3600 * UnitsPerSecond)); }
+    s32 time_of_day_t::minute() const { return (s32)((mUnits / (60 * UnitsPerSecond)) % 60); }
+    s32 time_of_day_t::second() const { return (s32)((mUnits / UnitsPerSecond) % 60); }
+    s32 time_of_day_t::millisecond() const { return (s32)((mUnits / (UnitsPerSecond / 1000)) % 1000); }
+    s32 time_of_day_t::microsecond() const { return (s32)(mUnits % (UnitsPerSecond / 1000)) * 100; }
+
+    void time_of_day_t::decompose(s32& hour, s32& minute, s32& second, s32& millisecond) const
+    {
+        u32 const s = mUnits / UnitsPerSecond;
+        hour        = (s32)(s / 3600);
+        minute      = (s32)((s / 60) % 60);
+        second      = (s32)(s % 60);
+        millisecond = (s32)((mUnits % UnitsPerSecond) / (UnitsPerSecond / 1000));
+    }
+
+    time_of_day_t& time_of_day_t::addUnits(s64 units)
+    {
+        s64 u  = ((s64)mUnits + units) % UnitsPerDay;
+        mUnits = (u32)(u < 0 ? (u + UnitsPerDay) : u);
+        return *this;
+    }
+
+    time_of_day_t& time_of_day_t::addHours(s32 value) { return addUnits((s64)value * 3600 * UnitsPerSecond); }
+    time_of_day_t& time_of_day_t::addMinutes(s32 value) { return addUnits((s64)value * 60 * UnitsPerSecond); }
+    time_of_day_t& time_of_day_t::addSeconds(s32 value) { return addUnits((s64)value * UnitsPerSecond); }
+    time_of_day_t& time_of_day_t::addMilliseconds(s32 value) { return addUnits((s64)value * (UnitsPerSecond / 1000)); }
+
+    time_of_day_t time_of_day_t::sFromUnits(u32 units)
+    {
+        ASSERTS(units < UnitsPerDay, "Error: out of range!");
+        time_of_day_t t;
+        t.mUnits = units;
+        return t;
+    }
+
+    // ------------------------------------------------------------------------------------------
+    // Columns, plain loops over the raw values so that the compiler can vectorize them
+
+    namespace ntime
+    {
+        void splitColumn(const datetime_t* in, date_t* dates, time_of_day_t* times, s64 count)
+        {
+            static_assert(sizeof(datetime_t) == sizeof(u64), "datetime_t must be a plain 64-bit value");
+            static_assert(sizeof(date_t) == sizeof(s32) && sizeof(time_of_day_t) == sizeof(u32), "date_t and time_of_day_t must be plain 32-bit values");
+            const u64* src  = reinterpret_cast<const u64*>(in);
+            s32*       date = reinterpret_cast<s32*>(dates);
+            u32*       time = reinterpret_cast<u32*>(times);
+            for (s64 i = 0; i < count; ++i)
+            {
+                s64 const t = (s64)(src[i] & sTicksMask);
+                s64 const d = t / TicksPerDay;
+                date[i]     = (s32)d;
+                if (time != nullptr)
+                    time[i] = (u32)((t - d * TicksPerDay) / time_of_day_t::TicksPerUnit);
+            }
+        }
+
+        void combineColumn(const date_t* dates, const time_of_day_t* times, datetime_t* out, s64 count)
+        {
+            const s32* date = reinterpret_cast<const s32*>(dates);
+            const u32* time = reinterpret_cast<const u32*>(times);
+            u64*       dst  = reinterpret_cast<u64*>(out);
+            if (time == nullptr)
+            {
+                for (s64 i = 0; i < count; ++i)
+                    dst[i] = (u64)((s64)date[i] * TicksPerDay);
+                return;
+            }
+            for (s64 i = 0; i < count; ++i)
+                dst[i] = (u64)((s64)date[i] * TicksPerDay + (s64)time[i] * time_of_day_t::TicksPerUnit);
+        }
+
+        void decomposeColumn(const date_t* dates, s32* years, s32* months, s32* days, s64 count)
+        {
+            const s32* date = reinterpret_cast<const s32*>(dates);
+            for (s64 i = 0; i < count; ++i)
+                civilFromDays(date[i], years[i], months[i], days[i]);
+        }
+    } // namespace ntime
+
+}; // namespace ncore
@@ -0,0 +1,47 @@
+#include "ccore/c_target.h"
+
+#include "ctime/private/c_date_lut.h"
+
+namespace ncore
+{
+    namespace ncalendar
+    {
+        static u32 sDateLut[LutNumDays];
+
+        static bool sBuildDateLut()
+        {
+            s32 year  = 1970;
+            s32 month = 1;
+            s32 day   = 1;
+            s32 doy   = 1;
+            s32 dow   = dayOfWeek(LutFirstDay);
+            for (s32 i = 0; i < LutNumDays; ++i)
+            {
+                sDateLut[i] = (u32)doy | ((u32)dow << 9) | ((u32)day << 12) | ((u32)month << 17) | ((u32)(year - 1970) << 21);
+
+                dow = (dow == 6) ? 0 : (dow + 1);
+                doy += 1;
+                day += 1;
+                if (day > daysInMonth(year, month))
+                {
+                    day = 1;
+                    month += 1;
+                    if (month > 12)
+                    {
+                        month = 1;
+                        year += 1;
+                        doy = 1;
+                    }
+                }
+            }
+            return true;
+        }
+
+        const u32* getDateLut()
+        {
+            static bool const sBuilt = sBuildDateLut();
+            (void)sBuilt;
+            return sDateLut;
+        }
+    } // namespace ncalendar
+} // namespace ncore
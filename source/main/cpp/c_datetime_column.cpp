@@ -0,0 +1,175 @@
+#include "ccore/c_debug.h"
+
+#include "ctime/c_datetime.h"
+#include "ctime/c_datetime_column.h"
+
+#include "ctime/private/c_calendar.h"
+
+namespace ncore
+{
+    namespace ntime
+    {
+        using namespace ncalendar;
+
+        static const u64 sTicksMask = D_CONSTANT_U64(0x3fffffffffffffff);
+
+        // datetime_t is a single u64 of ticks, the loops work on the raw values
+        static inline const u64* sRaw(const datetime_t* column)
+        {
+            static_assert(sizeof(datetime_t) == sizeof(u64), "datetime_t must be a plain 64-bit value");
+            return reinterpret_cast<const u64*>(column);
+        }
+        static inline u64* sRaw(datetime_t* column) { return reinterpret_cast<u64*>(column); }
+
+        static inline s32 sDaysOf(u64 raw) { return (s32)((s64)(raw & sTicksMask) / TicksPerDay); }
+
+        // Day number of January 1st of the year holding 'days'
+        static inline s32 sStartOfYear(s32 days, s32& year)
+        {
+            s32 month, day;
+            civilFromDays(days, year, month, day);
+            return daysFromCivil(year, 1, 1);
+        }
+
+        void isoWeekColumn(const datetime_t* in, s32* weekYears, s32* weeks, s64 count)
+        {
+            const u64* src = sRaw(in);
+            if (weekYears == nullptr)
+            {
+                for (s64 i = 0; i < count; ++i)
+                {
+                    s32 weekYear;
+                    isoWeekFromDays(sDaysOf(src[i]), weekYear, weeks[i]);
+                }
+            }
+            else
+            {
+                for (s64 i = 0; i < count; ++i)
+                    isoWeekFromDays(sDaysOf(src[i]), weekYears[i], weeks[i]);
+            }
+        }
+
+        void weekOfYearColumn(const datetime_t* in, EDayOfWeek firstDayOfWeek, s32* weeks, s64 count)
+        {
+            s32 const  first = (s32)firstDayOfWeek % DaysPerWeek;
+            const u64* src   = sRaw(in);
+            for (s64 i = 0; i < count; ++i)
+            {
+                s32       year;
+                s32 const days = sDaysOf(src[i]);
+                s32 const jan1 = sStartOfYear(days, year);
+                weeks[i]       = weekOfYear(days, days - jan1 + 1, first);
+            }
+        }
+
+        void startOfWeekColumn(const datetime_t* in, EDayOfWeek firstDayOfWeek, datetime_t* out, s64 count)
+        {
+            s32 const  first = (s32)firstDayOfWeek % DaysPerWeek;
+            const u64* src   = sRaw(in);
+            u64*       dst   = sRaw(out);
+            for (s64 i = 0; i < count; ++i)
+            {
+                s32 const days = startOfWeek(sDaysOf(src[i]), first);
+                dst[i]         = (u64)((days < 0 ? 0 : days) * TicksPerDay);
+            }
+        }
+
+        void ordinalDateColumn(const datetime_t* in, s32* years, s32* dayOfYears, s64 count)
+        {
+            const u64* src = sRaw(in);
+            if (years == nullptr)
+            {
+                for (s64 i = 0; i < count; ++i)
+                {
+                    s32       year;
+                    s32 const days = sDaysOf(src[i]);
+                    dayOfYears[i]  = days - sStartOfYear(days, year) + 1;
+                }
+            }
+            else
+            {
+                for (s64 i = 0; i < count; ++i)
+                {
+                    s32 const days = sDaysOf(src[i]);
+                    dayOfYears[i]  = days - sStartOfYear(days, years[i]) + 1;
+                }
+            }
+        }
+
+        // Adds 'months' to the date of 'raw', sets 'overflow' (0 or 1) instead of leaving year 1 - 9999
+        static inline u64 sAddMonths(u64 raw, s32 months, u32& overflow)
+        {
+            s64 const ticks = (s64)(raw & sTicksMask);
+            s32 const days  = (s32)(ticks / TicksPerDay);
+            s32       year, month, day;
+            civilFromDays(days, year, month, day);
+
+            s64 const shifted = (s64)year * 12 + (month - 1) + months;
+            overflow          = (shifted < 12 || shifted >= 10000 * 12) ? 1 : 0;
+            s32 const n       = overflow ? (year * 12 + month - 1) : (s32)shifted;
+            s32 const y       = n / 12;
+            s32 const m       = n - y * 12 + 1;
+            s32 const dim     = daysInMonth(y, m);
+            s32 const d       = day < dim ? day : dim;
+            u64 const result  = (u64)((s64)daysFromCivil(y, m, d) * TicksPerDay + (ticks - (s64)days * TicksPerDay));
+            return overflow ? raw : result;
+        }
+
+        // Blocks of 64 elements so that every block writes one word of the overflow mask
+        s64 addMonthsColumn(const datetime_t* in, datetime_t* out, s64 count, s32 months, u64* overflowMask)
+        {
+            const u64* src      = sRaw(in);
+            u64*       dst      = sRaw(out);
+            s64        overflow = 0;
+            for (s64 block = 0; block < count; block += 64)
+            {
+                s64 const n    = (count - block) < 64 ? (count - block) : 64;
+                u64       bits = 0;
+                for (s64 j = 0; j < n; ++j)
+                {
+                    u32 o;
+                    dst[block + j] = sAddMonths(src[block + j], months, o);
+                    bits |= (u64)o << j;
+                    overflow += o;
+                }
+                if (overflowMask != nullptr)
+                    overflowMask[block >> 6] = bits;
+            }
+            return count - overflow;
+        }
+
+        s64 addYearsColumn(const datetime_t* in, datetime_t* out, s64 count, s32 years, u64* overflowMask)
+        {
+            // Beyond 10000 years every element overflows, keep the month count in range
+            years = years < -10000 ? -10000 : (years > 10000 ? 10000 : years);
+            return addMonthsColumn(in, out, count, years * 12, overflowMask);
+        }
+
+        // Midnight of the first day of the month, 'monthsPerPeriod' 1 for months and 3 for quarters
+        static inline u64 sTruncate(u64 raw, s32 monthsPerPeriod)
+        {
+            s32 year, month, day;
+            civilFromDays(sDaysOf(raw), year, month, day);
+            month -= (month - 1) % monthsPerPeriod;
+            return (u64)((s64)daysFromCivil(year, month, 1) * TicksPerDay);
+        }
+
+        void truncateToMonthColumn(const datetime_t* in, datetime_t* out, s64 count)
+        {
+            const u64* src = sRaw(in);
+            u64*       dst = sRaw(out);
+            for (s64 i = 0; i < count; ++i)
+                dst[i] = sTruncate(src[i], 1);
+        }
+
+        void truncateToQuarterColumn(const datetime_t* in, datetime_t* out, s64 count)
+        {
+            const u64* src = sRaw(in);
+            u64*       dst = sRaw(out);
+            for (s64 i = 0; i < count; ++i)
+                dst[i] = sTruncate(src[i], 3);
+        }
+
+    } // namespace ntime
+
+}; // namespace ncore
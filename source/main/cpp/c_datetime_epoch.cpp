@@ -0,0 +1,179 @@
+#include "ccore/c_debug.h"
+
+#include "ctime/c_datetime.h"
+#include "ctime/c_datetime_epoch.h"
+
+#include "ctime/private/c_calendar.h"
+
+namespace ncore
+{
+    using namespace ncalendar;
+
+    // Day numbers (since 0001-01-01) of the epochs
+    static const s64 sJulianDayOfEpoch = 1721425; // 0001-01-01 00:00 is JD 1721425.5
+    static const s64 sMjdEpochDays     = 678575;  // 1858-11-17
+    static const s64 sExcelEpochDays   = 693593;  // 1899-12-30, serial 0 of the 1900 date system from 1900-03-01 on
+    static const s64 sNtpEpochDays     = 693595;  // 1900-01-01
+
+    // 1900-03-01, the 1900 date system counts a 1900-02-29 so earlier serials are one day off
+    static const s64 sExcelLeapBugEnd = D_CONSTANT_S64(693654) * TicksPerDay;
+
+    static const u64 sTicksMask = D_CONSTANT_U64(0x3fffffffffffffff);
+
+    static inline s64 sClamp(s64 ticks)
+    {
+        ticks = ticks < 0 ? 0 : ticks;
+        return ticks > MaxTicks ? MaxTicks : ticks;
+    }
+
+    // Days (with fraction) since 'epochDays', rounded once to the nearest double
+    static inline f64 sTicksToDays(s64 ticks, s64 epochDays, f64 bias)
+    {
+        s64 const d = ticks / TicksPerDay;
+        s64 const r = ticks - d * TicksPerDay;
+        return (f64)(d - epochDays) + ((f64)r / (f64)TicksPerDay + bias);
+    }
+
+    // Ticks of 'days' since 'epochDays', the fraction rounded to the nearest multiple of 'unit'
+    // ticks. The integral day is split off first, a double holding whole ticks since year 1
+    // would only resolve 128 ticks.
+    static inline s64 sDaysToTicks(f64 days, s64 epochDays, s64 unit)
+    {
+        f64 const lo = (f64)(-epochDays - 1);
+        f64 const hi = (f64)(MaxTicks / TicksPerDay + 1 - epochDays);
+        days         = (days >= lo) ? days : lo; // also catches NaN
+        days         = (days <= hi) ? days : hi;
+        s64 d        = (s64)days;
+        d -= (days < (f64)d) ? 1 : 0;
+        f64 const frac = days - (f64)d;
+        s64 const r    = (s64)(frac * (f64)(TicksPerDay / unit) + 0.5) * unit;
+        return sClamp((d + epochDays) * TicksPerDay + r);
+    }
+
+    static inline f64 sToJulianDay(s64 ticks) { return sTicksToDays(ticks, -sJulianDayOfEpoch, 0.5); }
+    static inline s64 sFromJulianDay(f64 jd) { return sDaysToTicks(jd - ((f64)sJulianDayOfEpoch + 0.5), 0, 1); }
+
+    static inline f64 sToMjd(s64 ticks) { return sTicksToDays(ticks, sMjdEpochDays, 0.0); }
+    static inline s64 sFromMjd(f64 mjd) { return sDaysToTicks(mjd, sMjdEpochDays, 1); }
+
+    static inline f64 sToExcel(s64 ticks) { return sTicksToDays(ticks < sExcelLeapBugEnd ? (ticks - TicksPerDay) : ticks, sExcelEpochDays, 0.0); }
+    static inline s64 sFromExcel(f64 serial)
+    {
+        s64 const t = sDaysToTicks(serial, sExcelEpochDays, TicksPerMillisecond);
+        return t < sExcelLeapBugEnd ? (t + TicksPerDay) : t;
+    }
+
+    static inline u64 sToNtp(s64 ticks)
+    {
+        s64 const t = ticks - sNtpEpochDays * TicksPerDay;
+        s64       s = t / TicksPerSecond;
+        s64       r = t - s * TicksPerSecond;
+        s -= (r < 0) ? 1 : 0;
+        r += (r < 0) ? TicksPerSecond : 0;
+        u64 const frac = (((u64)r << 32) + (u64)(TicksPerSecond / 2)) / (u64)TicksPerSecond;
+        return ((u64)s << 32) | frac;
+    }
+
+    static inline s64 sFromNtp(u64 ntp)
+    {
+        // Era 0 when the most significant bit is set, era 1 otherwise
+        s64 const s    = (s64)(ntp >> 32) + (((ntp >> 63) != 0) ? 0 : D_CONSTANT_S64(0x100000000));
+        s64 const frac = (s64)((((ntp & 0xffffffff) * (u64)TicksPerSecond) + D_CONSTANT_U64(0x80000000)) >> 32);
+        return sClamp(sNtpEpochDays * TicksPerDay + s * TicksPerSecond + frac);
+    }
+
+    static inline s64 sTicksOf(datetime_t dt) { return (s64)(dt.ticks() & sTicksMask); }
+
+    namespace ntime
+    {
+        f64        toJulianDay(datetime_t dt) { return sToJulianDay(sTicksOf(dt)); }
+        datetime_t fromJulianDay(f64 jd) { return datetime_t((u64)sFromJulianDay(jd)); }
+        f64        toModifiedJulianDay(datetime_t dt) { return sToMjd(sTicksOf(dt)); }
+        datetime_t fromModifiedJulianDay(f64 mjd) { return datetime_t((u64)sFromMjd(mjd)); }
+        f64        toExcelSerial(datetime_t dt) { return sToExcel(sTicksOf(dt)); }
+        datetime_t fromExcelSerial(f64 serial) { return datetime_t((u64)sFromExcel(serial)); }
+        u64        toNtp64(datetime_t dt) { return sToNtp(sTicksOf(dt)); }
+        datetime_t fromNtp64(u64 ntp) { return datetime_t((u64)sFromNtp(ntp)); }
+        s64        toDotNetTicks(datetime_t dt) { return sTicksOf(dt); }
+        datetime_t fromDotNetTicks(s64 ticks) { return datetime_t((u64)sClamp(ticks)); }
+
+        // datetime_t is a single u64 of ticks, the batch loops work on the raw values
+        static inline const u64* sRaw(const datetime_t* column)
+        {
+            static_assert(sizeof(datetime_t) == sizeof(u64), "datetime_t must be a plain 64-bit value");
+            return reinterpret_cast<const u64*>(column);
+        }
+        static inline u64* sRaw(datetime_t* column) { return reinterpret_cast<u64*>(column); }
+
+        void toJulianDay(const datetime_t* in, f64* out, s64 count)
+        {
+            const u64* src = sRaw(in);
+            for (s64 i = 0; i < count; ++i)
+                out[i] = sToJulianDay((s64)(src[i] & sTicksMask));
+        }
+
+        void fromJulianDay(const f64* in, datetime_t* out, s64 count)
+        {
+            u64* dst = sRaw(out);
+            for (s64 i = 0; i < count; ++i)
+                dst[i] = (u64)sFromJulianDay(in[i]);
+        }
+
+        void toModifiedJulianDay(const datetime_t* in, f64* out, s64 count)
+        {
+            const u64* src = sRaw(in);
+            for (s64 i = 0; i < count; ++i)
+                out[i] = sToMjd((s64)(src[i] & sTicksMask));
+        }
+
+        void fromModifiedJulianDay(const f64* in, datetime_t* out, s64 count)
+        {
+            u64* dst = sRaw(out);
+            for (s64 i = 0; i < count; ++i)
+                dst[i] = (u64)sFromMjd(in[i]);
+        }
+
+        void toExcelSerial(const datetime_t* in, f64* out, s64 count)
+        {
+            const u64* src = sRaw(in);
+            for (s64 i = 0; i < count; ++i)
+                out[i] = sToExcel((s64)(src[i] & sTicksMask));
+        }
+
+        void fromExcelSerial(const f64* in, datetime_t* out, s64 count)
+        {
+            u64* dst = sRaw(out);
+            for (s64 i = 0; i < count; ++i)
+                dst[i] = (u64)sFromExcel(in[i]);
+        }
+
+        void toNtp64(const datetime_t* in, u64* out, s64 count)
+        {
+            const u64* src = sRaw(in);
+            for (s64 i = 0; i < count; ++i)
+                out[i] = sToNtp((s64)(src[i] & sTicksMask));
+        }
+
+        void fromNtp64(const u64* in, datetime_t* out, s64 count)
+        {
+            u64* dst = sRaw(out);
+            for (s64 i = 0; i < count; ++i)
+                dst[i] = (u64)sFromNtp(in[i]);
+        }
+
+        void toDotNetTicks(const datetime_t* in, s64* out, s64 count)
+        {
+            const u64* src = sRaw(in);
+            for (s64 i = 0; i < count; ++i)
+                out[i] = (s64)(src[i] & sTicksMask);
+        }
+
+        void fromDotNetTicks(const s64* in, datetime_t* out, s64 count)
+        {
+            u64* dst = sRaw(out);
+            for (s64 i = 0; i < count; ++i)
+                dst[i] = (u64)sClamp(in[i]);
+        }
+    } // namespace ntime
+
+}; // namespace ncore
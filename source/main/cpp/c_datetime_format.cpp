@@ -0,0 +1,258 @@
+#include "ccore/c_debug.h"
+
+#include "ctime/c_datetime.h"
+#include "ctime/c_datetime_format.h"
+#include "ctime/c_datetime_offset.h"
+
+#include "ctime/private/c_calendar.h"
+#include "ctime/private/c_digits.h"
+
+namespace ncore
+{
+    using namespace ncalendar;
+    using namespace ndigits;
+
+    // Elements are processed in blocks, the first pass decomposes a whole block into
+    // structure-of-arrays form, the second pass converts and places the digits.
+    static const s32 sBlockSize = 8;
+
+    static const s32 sIsoWidth   = 24; // 2023-11-14T22:13:20.123Z
+    static const s32 sEpochWidth = 15; // -62135596800000 or 253402300799999
+    static const s32 sRfcWidth   = 29; // 2023-11-14T23:13:20.123+01:00
+
+    struct iso_block_t
+    {
+        u32 year[sBlockSize];
+        u32 month[sBlockSize];
+        u32 day[sBlockSize];
+        u32 hour[sBlockSize];
+        u32 minute[sBlockSize];
+        u32 second[sBlockSize];
+        u32 milli[sBlockSize];
+    };
+
+    static inline void sDecomposeIso(const u64* ticks, s32 n, iso_block_t& b)
+    {
+        for (s32 i = 0; i < n; ++i)
+        {
+            s64 const t   = (s64)(ticks[i] & D_CONSTANT_U64(0x3fffffffffffffff));
+            s32 const day = (s32)(t / TicksPerDay);
+            s64 const tod = t - ((s64)day * TicksPerDay);
+            s32       y, m, d;
+            civilFromDays(day, y, m, d);
+            s32 const ms = (s32)(tod / TicksPerMillisecond);
+            b.year[i]    = (u32)y;
+            b.month[i]   = (u32)m;
+            b.day[i]     = (u32)d;
+            b.hour[i]    = (u32)(ms / 3600000);
+            b.minute[i]  = (u32)((ms / 60000) % 60);
+            b.second[i]  = (u32)((ms / 1000) % 60);
+            b.milli[i]   = (u32)(ms % 1000);
+        }
+    }
+
+    static inline char* sEncodeIso(const iso_block_t& b, s32 i, char separator, char* dst)
+    {
+        u64 const date = fourPairs(b.year[i] / 100, b.year[i] % 100, b.month[i], b.day[i]);  // YYYYMMDD
+        u64 const time = fourPairs(b.hour[i], b.minute[i], b.second[i], b.milli[i] / 10);     // HHMMSSmm
+        u64 const last = (u64)('0' + (b.milli[i] % 10));
+
+        u64 const w0 = (date & 0xFFFFFFFF) | ((u64)'-' << 32) | (((date >> 32) & 0xFFFF) << 40) | ((u64)'-' << 56);
+        u64 const w1 = ((date >> 48) & 0xFFFF) | ((u64)'T' << 16) | ((time & 0xFFFF) << 24) | ((u64)':' << 40) | (((time >> 16) & 0xFFFF) << 48);
+        u64 const w2 = (u64)':' | (((time >> 32) & 0xFFFF) << 8) | ((u64)'.' << 24) | (((time >> 48) & 0xFFFF) << 32) | (last << 48) | ((u64)'Z' << 56);
+        store8(dst + 0, w0);
+        store8(dst + 8, w1);
+        store8(dst + 16, w2);
+        dst[sIsoWidth] = separator;
+        return dst + sIsoWidth + 1;
+    }
+
+    // Replaces the 'Z' of an ISO element at 'dst' with the offset, '+hh:mm' or '-hh:mm'
+    static inline char* sEncodeOffset(char* dst, s32 offsetMinutes, char separator)
+    {
+        u32 const a     = (u32)(offsetMinutes < 0 ? -offsetMinutes : offsetMinutes);
+        u64 const pairs = fourPairs(a / 60, a % 60, 0, 0); // hhmm
+        u64 const w     = (u64)(offsetMinutes < 0 ? '-' : '+') | ((pairs & 0xFFFF) << 8) | ((u64)':' << 24) | (((pairs >> 16) & 0xFFFF) << 32) | ((u64)(u8)separator << 48);
+        storeN(dst + sIsoWidth - 1, w, 7);
+        return dst + sRfcWidth + 1;
+    }
+
+    static inline s32 sFirstNonZeroByte(u64 v)
+    {
+        s32 n = 0;
+        while (n < 8 && (v & 0xff) == 0)
+        {
+            v >>= 8;
+            n += 1;
+        }
+        return n;
+    }
+
+    // Formats the milliseconds since the unix epoch into 'hi:lo' (16 characters, digits left aligned)
+    // and returns the number of characters, the sign is returned separately.
+    static inline s32 sEncodeEpochMillis(u64 ticks, bool& negative, u64& hi, u64& lo)
+    {
+        s64 const t  = (s64)(ticks & D_CONSTANT_U64(0x3fffffffffffffff)) - EpochTicks;
+        s64       ms = t / TicksPerMillisecond;
+        if (t < 0 && (ms * TicksPerMillisecond) != t)
+            ms -= 1; // floor
+        negative    = ms < 0;
+        u64 const a = (u64)(negative ? -ms : ms);
+        hi          = eightDigits((u32)(a / 100000000));
+        lo          = eightDigits((u32)(a % 100000000));
+
+        s32 z = sFirstNonZeroByte(hi ^ sAsciiZeros);
+        if (z == 8)
+        {
+            z += sFirstNonZeroByte(lo ^ sAsciiZeros);
+            if (z == 16)
+                z = 15;
+        }
+        // Shift the leading zeros out, 'hi:lo' is a 16 byte string with its first char in the lowest byte of 'hi'
+        if (z >= 8)
+        {
+            hi = lo >> ((z - 8) * 8);
+            lo = 0;
+        }
+        else if (z > 0)
+        {
+            hi = (hi >> (z * 8)) | (lo << ((8 - z) * 8));
+            lo = lo >> (z * 8);
+        }
+        return 16 - z;
+    }
+
+    namespace ntime
+    {
+        s32 exportElementSize(EDateTimeExport format) { return (format == ExportIso8601) ? (sIsoWidth + 1) : (sEpochWidth + 1); }
+
+        s64 exportColumn(const u64* ticks, s64 count, EDateTimeExport format, char separator, char* dst, s64 dstSize, s64& outBytes)
+        {
+            outBytes = 0;
+            if (ticks == nullptr || dst == nullptr || count <= 0)
+                return 0;
+
+            char*       cursor = dst;
+            char* const end    = dst + dstSize;
+            s64         i      = 0;
+
+            if (format == ExportIso8601)
+            {
+                s64 const fit = dstSize / (sIsoWidth + 1);
+                if (count > fit)
+                    count = fit;
+
+                iso_block_t block;
+                while (i < count)
+                {
+                    s32 const n = (count - i) < sBlockSize ? (s32)(count - i) : sBlockSize;
+                    sDecomposeIso(ticks + i, n, block);
+                    for (s32 j = 0; j < n; ++j)
+                        cursor = sEncodeIso(block, j, separator, cursor);
+                    i += n;
+                }
+            }
+            else
+            {
+                // The block path stores 16 bytes per element unconditionally and only advances by the
+                // actual width, which needs some slack at the end of the buffer.
+                s64 const slack = (sEpochWidth + 2) * (sBlockSize + 1);
+
+                u64  hi[sBlockSize];
+                u64  lo[sBlockSize];
+                s32  width[sBlockSize];
+                bool negative[sBlockSize];
+                while ((count - i) >= sBlockSize && (end - cursor) >= slack)
+                {
+                    for (s32 j = 0; j < sBlockSize; ++j)
+                        width[j] = sEncodeEpochMillis(ticks[i + j], negative[j], hi[j], lo[j]);
+                    for (s32 j = 0; j < sBlockSize; ++j)
+                    {
+                        *cursor = '-';
+                        cursor += negative[j] ? 1 : 0;
+                        store8(cursor + 0, hi[j]);
+                        store8(cursor + 8, lo[j]);
+                        cursor += width[j];
+                        *cursor++ = separator;
+                    }
+                    i += sBlockSize;
+                }
+
+                // Tail, exact bounds checking per element
+                for (; i < count; ++i)
+                {
+                    bool      neg;
+                    u64       h, l;
+                    s32 const w = sEncodeEpochMillis(ticks[i], neg, h, l);
+                    if ((end - cursor) < (w + (neg ? 2 : 1)))
+                        break;
+                    if (neg)
+                        *cursor++ = '-';
+                    storeN(cursor, h, w < 8 ? w : 8);
+                    if (w > 8)
+                        storeN(cursor + 8, l, w - 8);
+                    cursor += w;
+                    *cursor++ = separator;
+                }
+                count = i;
+            }
+
+            outBytes = (s64)(cursor - dst);
+            return count;
+        }
+
+        s64 exportColumn(const datetime_t* column, s64 count, EDateTimeExport format, char separator, char* dst, s64 dstSize, s64& outBytes)
+        {
+            // datetime_t is a single u64 of ticks, its high 2 bits are masked out by the kernels
+            static_assert(sizeof(datetime_t) == sizeof(u64), "datetime_t must be a plain 64-bit value");
+            return exportColumn(reinterpret_cast<const u64*>(column), count, format, separator, dst, dstSize, outBytes);
+        }
+
+        s32 formatRfc3339(const datetime_offset_t& dto, char* dst, s32 dstSize)
+        {
+            if (dst == nullptr || dstSize <= sRfcWidth)
+                return 0;
+            s64 bytes;
+            exportColumn(&dto, 1, 0, dst, dstSize, bytes);
+            return sRfcWidth;
+        }
+
+        s64 exportColumn(const datetime_offset_t* column, s64 count, char separator, char* dst, s64 dstSize, s64& outBytes)
+        {
+            outBytes = 0;
+            if (column == nullptr || dst == nullptr || count <= 0)
+                return 0;
+
+            s64 const fit = dstSize / (sRfcWidth + 1);
+            if (count > fit)
+                count = fit;
+
+            // The local time is formatted as ISO 8601, then its 'Z' is replaced by the offset
+            char*       cursor = dst;
+            iso_block_t block;
+            u64         local[sBlockSize];
+            s32         offset[sBlockSize];
+            s64         i = 0;
+            while (i < count)
+            {
+                s32 const n = (count - i) < sBlockSize ? (s32)(count - i) : sBlockSize;
+                for (s32 j = 0; j < n; ++j)
+                {
+                    local[j]  = column[i + j].local().ticks();
+                    offset[j] = column[i + j].offsetMinutes();
+                }
+                sDecomposeIso(local, n, block);
+                for (s32 j = 0; j < n; ++j)
+                {
+                    sEncodeIso(block, j, 0, cursor);
+                    cursor = sEncodeOffset(cursor, offset[j], separator);
+                }
+                i += n;
+            }
+
+            outBytes = (s64)(cursor - dst);
+            return count;
+        }
+    } // namespace ntime
+
+}; // namespace ncore
@@ -0,0 +1,91 @@
+#include "ccore/c_debug.h"
+
+#include "ctime/c_datetime.h"
+#include "ctime/c_datetime_offset.h"
+#include "ctime/c_timezone.h"
+
+#include "ctime/private/c_calendar.h"
+
+namespace ncore
+{
+    using namespace ncalendar;
+
+    static const s64 sBaseTicks   = D_CONSTANT_S64(693595) * TicksPerDay; // 1900-01-01
+    static const u64 sTicksMask   = (D_CONSTANT_U64(1) << 57) - 1;
+    static const s32 sOffsetShift = 57;
+
+    static inline u64 sPack(s64 utc, s32 quarters)
+    {
+        s64 t = utc - sBaseTicks;
+        t     = t < 0 ? 0 : t;
+        t     = t > (s64)sTicksMask ? (s64)sTicksMask : t;
+        return ((u64)(quarters & 0x7f) << sOffsetShift) | (u64)t;
+    }
+
+    const datetime_offset_t datetime_offset_t::sMinValue = datetime_offset_t::sFromPacked(0);
+    const datetime_offset_t datetime_offset_t::sMaxValue = datetime_offset_t::sFromPacked(sTicksMask);
+
+    datetime_offset_t::datetime_offset_t()
+        : mPacked(0)
+    {
+    }
+
+    /**
+     *  Summary:
+     *      Initializes a new instance from a UTC instant and the local offset it was
+     *      captured in. Instants outside the range saturate.
+     *
+     *  Parameters:
+     *    utc:
+     *      The instant, expressed in UTC.
+     *    offsetMinutes:
+     *      Minutes east of UTC, a multiple of 15 in the range -960 to 945.
+     */
+    datetime_offset_t::datetime_offset_t(datetime_t utc, s32 offsetMinutes)
+    {
+        ASSERTS((offsetMinutes % 15) == 0 && offsetMinutes >= -960 && offsetMinutes <= 945, "Error: offset out of range!");
+        ASSERTS(sIsRepresentable(utc), "Error: out of range!");
+        mPacked = sPack((s64)utc.ticks(), offsetMinutes / 15);
+    }
+
+    datetime_t datetime_offset_t::utc() const { return datetime_t((u64)((s64)(mPacked & sTicksMask) + sBaseTicks)); }
+
+    datetime_t datetime_offset_t::local() const { return datetime_t((u64)((s64)(mPacked & sTicksMask) + sBaseTicks + (s64)offsetMinutes() * TicksPerMinute)); }
+
+    s32 datetime_offset_t::offsetMinutes() const
+    {
+        // Sign extend the 7-bit quarter hours
+        return ((s32)(s8)((u8)(mPacked >> sOffsetShift) << 1) >> 1) * 15;
+    }
+
+    datetime_offset_t datetime_offset_t::sFromPacked(u64 packed)
+    {
+        datetime_offset_t dto;
+        dto.mPacked = packed;
+        return dto;
+    }
+
+    datetime_offset_t datetime_offset_t::sFromLocal(datetime_t local, s32 offsetMinutes) { return datetime_offset_t(datetime_t((u64)((s64)local.ticks() - (s64)offsetMinutes * TicksPerMinute)), offsetMinutes); }
+
+    datetime_offset_t datetime_offset_t::sFromZone(datetime_t utc, const timezone_t* zone)
+    {
+        // Historic offsets (local mean time) are not quarter hours, round to the nearest
+        s32 const seconds  = (zone != nullptr) ? zone->offsetAt(utc) : 0;
+        s32 const quarters = (seconds >= 0) ? ((seconds + 450) / 900) : -((-seconds + 450) / 900);
+        return sFromPacked(sPack((s64)utc.ticks(), quarters < -64 ? -64 : (quarters > 63 ? 63 : quarters)));
+    }
+
+    bool datetime_offset_t::sIsRepresentable(datetime_t utc)
+    {
+        s64 const t = (s64)utc.ticks() - sBaseTicks;
+        return t >= 0 && t <= (s64)sTicksMask;
+    }
+
+    s32 datetime_offset_t::sCompare(const datetime_offset_t& t1, const datetime_offset_t& t2)
+    {
+        u64 const a = t1.mPacked & sTicksMask;
+        u64 const b = t2.mPacked & sTicksMask;
+        return (a < b) ? -1 : ((a > b) ? 1 : 0);
+    }
+
+}; // namespace ncore
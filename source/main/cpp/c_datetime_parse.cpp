@@ -0,0 +1,567 @@
+#include "ccore/c_debug.h"
+
+#include "ctime/c_datetime.h"
+#include "ctime/c_datetime_parse.h"
+
+#include "ctime/private/c_calendar.h"
+
+namespace ncore
+{
+    using namespace ncalendar;
+
+    // ------------------------------------------------------------------------------------------
+    // 8 bytes at a time helpers, bytes are composed in little-endian order so that byte 0 of the
+    // string always ends up in the lowest byte of the word, independent of the target.
+
+    static const u64 sOnes = D_CONSTANT_U64(0x0101010101010101);
+    static const u64 sHigh = D_CONSTANT_U64(0x8080808080808080);
+
+    static inline u64 sLoad8(const char* str, s32 len)
+    {
+        u64 v = 0;
+        s32 n = len < 8 ? len : 8;
+        for (s32 i = 0; i < n; ++i)
+            v |= (u64)(u8)str[i] << (i * 8);
+        return v;
+    }
+
+    // Returns 0x80 in every byte that is NOT an ascii digit
+    static inline u64 sNonDigitMask(u64 v)
+    {
+        u64 const t = v ^ (sOnes * '0');
+        return (((t & (sOnes * 0x7f)) + (sOnes * (0x80 - 10))) | t) & sHigh;
+    }
+
+    static inline s32 sFirstByteSet(u64 mask)
+    {
+        if (mask == 0)
+            return 8;
+        s32 n = 0;
+        while ((mask & 0xff) == 0)
+        {
+            mask >>= 8;
+            n += 1;
+        }
+        return n;
+    }
+
+    // Converts exactly 8 ascii digits to their value using 3 multiplies
+    static inline u32 sParse8Digits(u64 v)
+    {
+        v -= sOnes * '0';
+        v = (v * 10) + (v >> 8);
+        v = (((v & D_CONSTANT_U64(0x000000FF000000FF)) * (100 + (D_CONSTANT_U64(1000000) << 32))) + (((v >> 16) & D_CONSTANT_U64(0x000000FF000000FF)) * (1 + (D_CONSTANT_U64(10000) << 32)))) >> 32;
+        return (u32)v;
+    }
+
+    static inline bool sIsDigit(char c) { return (u32)(c - '0') < 10; }
+    static inline bool sIsAlpha(char c) { return (u32)((c | 0x20) - 'a') < 26; }
+
+    // Number of leading digits of the token, at most 'len'
+    static s32 sLeadingDigits(const char* str, s32 len)
+    {
+        s32 n = 0;
+        while (n < len)
+        {
+            s32 const d = sFirstByteSet(sNonDigitMask(sLoad8(str + n, len - n)));
+            if (d < 8)
+                return (n + d) < len ? (n + d) : len;
+            n += 8;
+        }
+        return len;
+    }
+
+    static u64 sParseDigits(const char* str, s32 len)
+    {
+        u64 v = 0;
+        while (len >= 8)
+        {
+            v = (v * 100000000) + sParse8Digits(sLoad8(str, 8));
+            str += 8;
+            len -= 8;
+        }
+        while (len > 0)
+        {
+            v = (v * 10) + (u64)(*str++ - '0');
+            len -= 1;
+        }
+        return v;
+    }
+
+    static inline bool sDigits(const char* str, s32 count, s32& value)
+    {
+        s32 v = 0;
+        for (s32 i = 0; i < count; ++i)
+        {
+            if (!sIsDigit(str[i]))
+                return false;
+            v = (v * 10) + (str[i] - '0');
+        }
+        value = v;
+        return true;
+    }
+
+    // Parses up to 7 fraction digits into ticks, additional digits are validated and truncated
+    static inline s32 sParseFraction(const char* str, s32 len, s32& pos, s64& ticks)
+    {
+        s32 const start = pos;
+        s64       frac  = 0;
+        s64       scale = TicksPerSecond;
+        while (pos < len && sIsDigit(str[pos]))
+        {
+            if (scale > 1)
+            {
+                scale /= 10;
+                frac += (str[pos] - '0') * scale;
+            }
+            pos += 1;
+        }
+        ticks = frac;
+        return pos - start;
+    }
+
+    // Month name to month number (1-12), 0 when not a month
+    static s32 sMonthFromName(const char* str)
+    {
+        static const u32 sMonthNames[12] = {
+          'j' | ('a' << 8) | ('n' << 16), 'f' | ('e' << 8) | ('b' << 16), 'm' | ('a' << 8) | ('r' << 16), 'a' | ('p' << 8) | ('r' << 16), 'm' | ('a' << 8) | ('y' << 16), 'j' | ('u' << 8) | ('n' << 16),
+          'j' | ('u' << 8) | ('l' << 16), 'a' | ('u' << 8) | ('g' << 16), 's' | ('e' << 8) | ('p' << 16), 'o' | ('c' << 8) | ('t' << 16), 'n' | ('o' << 8) | ('v' << 16), 'd' | ('e' << 8) | ('c' << 16),
+        };
+        u32 const name = ((u32)(u8)(str[0] | 0x20)) | ((u32)(u8)(str[1] | 0x20) << 8) | ((u32)(u8)(str[2] | 0x20) << 16);
+        for (s32 i = 0; i < 12; ++i)
+        {
+            if (sMonthNames[i] == name)
+                return i + 1;
+        }
+        return 0;
+    }
+
+    static bool sMakeDateTime(s32 year, s32 month, s32 day, s32 hour, s32 minute, s32 second, s64 fraction, s32 offsetSeconds, datetime_t& out)
+    {
+        if (year < 1 || year > 9999 || month < 1 || month > 12 || day < 1 || day > daysInMonth(year, month))
+            return false;
+        if (hour > 23 || minute > 59 || second > 60)
+            return false;
+        if (second == 60) // A leap second is folded into the last second of the minute
+        {
+            second   = 59;
+            fraction = TicksPerSecond - 1;
+        }
+        s64 const ticks = ((s64)daysFromCivil(year, month, day) * TicksPerDay) + (hour * TicksPerHour) + (minute * TicksPerMinute) + (second * TicksPerSecond) + fraction - (offsetSeconds * TicksPerSecond);
+        if (ticks < 0 || ticks > MaxTicks)
+            return false;
+        out = datetime_t((u64)ticks);
+        return true;
+    }
+
+    static bool sMakeFromEpoch(u64 value, s64 ticksPerUnit, s64 unitsPerTick, s64 fraction, datetime_t& out)
+    {
+        u64 const ticks = (unitsPerTick > 1 ? (value / (u64)unitsPerTick) : (value * (u64)ticksPerUnit)) + (u64)fraction + (u64)EpochTicks;
+        if (ticks > (u64)MaxTicks)
+            return false;
+        out = datetime_t(ticks);
+        return true;
+    }
+
+    // Parses 'Z', '+hh:mm', '+hhmm', '+hh' and the RFC 2822 zone names
+    static bool sParseZone(const char* str, s32 len, s32& pos, s32& offsetSeconds, bool allowNames)
+    {
+        offsetSeconds = 0;
+        if (pos >= len)
+            return true;
+        char const c = str[pos];
+        if (c == 'Z' || c == 'z')
+        {
+            pos += 1;
+            return true;
+        }
+        if (c == '+' || c == '-')
+        {
+            s32 hh, mm = 0;
+            if ((pos + 3) > len || !sDigits(str + pos + 1, 2, hh))
+                return false;
+            pos += 3;
+            if (pos < len && str[pos] == ':')
+                pos += 1;
+            if (pos < len)
+            {
+                if ((pos + 2) > len || !sDigits(str + pos, 2, mm))
+                    return false;
+                pos += 2;
+            }
+            if (hh > 23 || mm > 59)
+                return false;
+            offsetSeconds = (hh * 3600) + (mm * 60);
+            if (c == '-')
+                offsetSeconds = -offsetSeconds;
+            return true;
+        }
+        if (!allowNames)
+            return false;
+
+        s32 n = 0;
+        while ((pos + n) < len && sIsAlpha(str[pos + n]))
+            n += 1;
+        u32 name = 0;
+        for (s32 i = 0; i < n && i < 4; ++i)
+            name = (name << 8) | (u8)(str[pos + i] & ~0x20);
+        s32 hours = 0;
+        switch (n)
+        {
+            case 2:
+                if (name != (('U' << 8) | 'T'))
+                    return false;
+                break;
+            case 3:
+                switch (name)
+                {
+                    case ('G' << 16) | ('M' << 8) | 'T':
+                    case ('U' << 16) | ('T' << 8) | 'C': hours = 0; break;
+                    case ('E' << 16) | ('S' << 8) | 'T': hours = -5; break;
+                    case ('E' << 16) | ('D' << 8) | 'T': hours = -4; break;
+                    case ('C' << 16) | ('S' << 8) | 'T': hours = -6; break;
+                    case ('C' << 16) | ('D' << 8) | 'T': hours = -5; break;
+                    case ('M' << 16) | ('S' << 8) | 'T': hours = -7; break;
+                    case ('M' << 16) | ('D' << 8) | 'T': hours = -6; break;
+                    case ('P' << 16) | ('S' << 8) | 'T': hours = -8; break;
+                    case ('P' << 16) | ('D' << 8) | 'T': hours = -7; break;
+                    default: return false;
+                }
+                break;
+            default: return false;
+        }
+        pos += n;
+        offsetSeconds = hours * 3600;
+        return true;
+    }
+
+    // ------------------------------------------------------------------------------------------
+    // Format specific parsers, each one is strict about the shape of its format so that a
+    // successful parse can never be a mis-detection of another format.
+
+    static bool sParseEpoch(ETimestampFormat format, const char* str, s32 len, datetime_t& out)
+    {
+        s32 const digits = sLeadingDigits(str, len);
+        switch (format)
+        {
+            case TimestampEpochSeconds:
+            {
+                if (digits < 9 || digits > 11)
+                    return false;
+                s64 fraction = 0;
+                if (digits < len)
+                {
+                    s32 pos = digits + 1;
+                    if (str[digits] != '.' || sParseFraction(str, len, pos, fraction) == 0 || pos != len)
+                        return false;
+                }
+                return sMakeFromEpoch(sParseDigits(str, digits), TicksPerSecond, 1, fraction, out);
+            }
+            case TimestampEpochMillis:
+                if (digits != len || digits < 12 || digits > 14)
+                    return false;
+                return sMakeFromEpoch(sParseDigits(str, digits), TicksPerMillisecond, 1, 0, out);
+            case TimestampEpochMicros:
+                if (digits != len || digits < 15 || digits > 17)
+                    return false;
+                return sMakeFromEpoch(sParseDigits(str, digits), TicksPerMicrosecond, 1, 0, out);
+            case TimestampEpochNanos:
+                if (digits != len || digits < 18 || digits > 19)
+                    return false;
+                return sMakeFromEpoch(sParseDigits(str, digits), 1, 100, 0, out);
+            default: break;
+        }
+        return false;
+    }
+
+    static bool sParseIso8601(const char* str, s32 len, datetime_t& out)
+    {
+        s32 year, month, day, hour = 0, minute = 0, second = 0, offset = 0;
+        s64 fraction = 0;
+        s32 pos;
+
+        bool const basic = (len >= 8) && sIsDigit(str[4]);
+        if (basic)
+        {
+            if (!sDigits(str, 4, year) || !sDigits(str + 4, 2, month) || !sDigits(str + 6, 2, day))
+                return false;
+            pos = 8;
+        }
+        else
+        {
+            if (len < 10 || str[4] != '-' || str[7] != '-' || !sDigits(str, 4, year) || !sDigits(str + 5, 2, month) || !sDigits(str + 8, 2, day))
+                return false;
+            pos = 10;
+        }
+
+        if (pos < len)
+        {
+            char const sep = str[pos];
+            if (sep != 'T' && sep != 't' && sep != ' ')
+                return false;
+            pos += 1;
+            if ((pos + 2) > len || !sDigits(str + pos, 2, hour))
+                return false;
+            pos += 2;
+            if (!basic && pos < len && str[pos] == ':')
+                pos += 1;
+            else if (!basic)
+                return false;
+            if ((pos + 2) > len || !sDigits(str + pos, 2, minute))
+                return false;
+            pos += 2;
+            if (pos < len && (basic ? sIsDigit(str[pos]) : (str[pos] == ':')))
+            {
+                pos += basic ? 0 : 1;
+                if ((pos + 2) > len || !sDigits(str + pos, 2, second))
+                    return false;
+                pos += 2;
+                if (pos < len && (str[pos] == '.' || str[pos] == ','))
+                {
+                    pos += 1;
+                    if (sParseFraction(str, len, pos, fraction) == 0)
+                        return false;
+                }
+            }
+            if (!sParseZone(str, len, pos, offset, false) || pos != len)
+                return false;
+        }
+        return sMakeDateTime(year, month, day, hour, minute, second, fraction, offset, out);
+    }
+
+    static bool sParseRfc2822(const char* str, s32 len, datetime_t& out)
+    {
+        s32 pos = 0;
+        if (len >= 4 && sIsAlpha(str[0]))
+        {
+            // Optional day-of-week, it is not validated against the date
+            if (!sIsAlpha(str[1]) || !sIsAlpha(str[2]) || str[3] != ',')
+                return false;
+            pos = 4;
+            while (pos < len && str[pos] == ' ')
+                pos += 1;
+        }
+
+        s32 day, month, year, hour, minute, second = 0, offset = 0;
+        s32 n = sLeadingDigits(str + pos, len - pos);
+        if (n < 1 || n > 2 || !sDigits(str + pos, n, day))
+            return false;
+        pos += n;
+        if ((pos + 5) > len || str[pos] != ' ' || (month = sMonthFromName(str + pos + 1)) == 0 || str[pos + 4] != ' ')
+            return false;
+        pos += 5;
+        n = sLeadingDigits(str + pos, len - pos);
+        if ((n != 2 && n != 4) || !sDigits(str + pos, n, year))
+            return false;
+        if (n == 2) // Obsolete 2-digit year (RFC 2822, 4.3)
+            year += (year < 50) ? 2000 : 1900;
+        pos += n;
+        if ((pos + 6) > len || str[pos] != ' ' || !sDigits(str + pos + 1, 2, hour) || str[pos + 3] != ':' || !sDigits(str + pos + 4, 2, minute))
+            return false;
+        pos += 6;
+        if (pos < len && str[pos] == ':')
+        {
+            if ((pos + 3) > len || !sDigits(str + pos + 1, 2, second))
+                return false;
+            pos += 3;
+        }
+        if (pos < len)
+        {
+            if (str[pos] != ' ')
+                return false;
+            while (pos < len && str[pos] == ' ')
+                pos += 1;
+            if (!sParseZone(str, len, pos, offset, true) || pos != len)
+                return false;
+        }
+        return sMakeDateTime(year, month, day, hour, minute, second, 0, offset, out);
+    }
+
+    static bool sParseSyslog(const char* str, s32 len, s32 year, datetime_t& out)
+    {
+        // "Mmm dd hh:mm:ss", the day is space padded
+        if (len < 15 || str[3] != ' ' || str[6] != ' ' || str[9] != ':' || str[12] != ':')
+            return false;
+        s32 const month = sMonthFromName(str);
+        if (month == 0)
+            return false;
+        s32 day = 0, hour = 0, minute = 0, second = 0;
+        if (str[4] == ' ' ? !sDigits(str + 5, 1, day) : !sDigits(str + 4, 2, day))
+            return false;
+        if (!sDigits(str + 7, 2, hour) || !sDigits(str + 10, 2, minute) || !sDigits(str + 13, 2, second))
+            return false;
+        s64 fraction = 0;
+        s32 pos      = 15;
+        if (pos < len)
+        {
+            pos += 1;
+            if (str[15] != '.' || sParseFraction(str, len, pos, fraction) == 0 || pos != len)
+                return false;
+        }
+        return sMakeDateTime(year, month, day, hour, minute, second, fraction, 0, out);
+    }
+
+    namespace ntime
+    {
+        ETimestampFormat classifyTimestamp(const char* str, s32 len)
+        {
+            if (str == nullptr || len < 8)
+                return TimestampUnknown;
+
+            // Character classes are determined 8 bytes at a time
+            s32 const lead = sLeadingDigits(str, len);
+
+            if (lead == len)
+            {
+                if (len == 8)
+                    return TimestampIso8601; // 20231114
+                if (len <= 11)
+                    return TimestampEpochSeconds;
+                if (len <= 14)
+                    return TimestampEpochMillis;
+                if (len <= 17)
+                    return TimestampEpochMicros;
+                if (len <= 19)
+                    return TimestampEpochNanos;
+                return TimestampUnknown;
+            }
+
+            char const c = str[lead];
+            switch (lead)
+            {
+                case 0:
+                    if (sIsAlpha(str[0]) && sIsAlpha(str[1]) && sIsAlpha(str[2]))
+                    {
+                        if (str[3] == ',')
+                            return TimestampRfc2822;
+                        if (str[3] == ' ' && (str[4] == ' ' || sIsDigit(str[4])))
+                            return TimestampSyslog;
+                    }
+                    break;
+                case 1:
+                case 2:
+                    if (c == ' ' && sIsAlpha(str[lead + 1]))
+                        return TimestampRfc2822;
+                    break;
+                case 4:
+                    if (c == '-')
+                        return TimestampIso8601;
+                    break;
+                case 8:
+                    if (c == 'T' || c == 't')
+                        return TimestampIso8601;
+                    break;
+                case 9:
+                case 10:
+                case 11:
+                    if (c == '.')
+                        return TimestampEpochSeconds;
+                    break;
+            }
+            return TimestampUnknown;
+        }
+
+        bool parseTimestamp(ETimestampFormat format, const char* str, s32 len, datetime_t& out, s32 year)
+        {
+            if (str == nullptr || len <= 0)
+                return false;
+            switch (format)
+            {
+                case TimestampEpochSeconds:
+                case TimestampEpochMillis:
+                case TimestampEpochMicros:
+                case TimestampEpochNanos: return sParseEpoch(format, str, len, out);
+                case TimestampIso8601: return sParseIso8601(str, len, out);
+                case TimestampRfc2822: return sParseRfc2822(str, len, out);
+                case TimestampSyslog: return sParseSyslog(str, len, year, out);
+                default: break;
+            }
+            return false;
+        }
+
+        bool parseTimestamp(const char* str, s32 len, datetime_t& out, s32 year) { return parseTimestamp(classifyTimestamp(str, len), str, len, out, year); }
+    } // namespace ntime
+
+    // ------------------------------------------------------------------------------------------
+    // timestamp_parser_t
+
+    // Scores are halved after this many samples so that the parser follows a change of format
+    static const s32 sParserWindow = 1024;
+
+    timestamp_parser_t::timestamp_parser_t()
+        : mYear(1970)
+    {
+        reset();
+    }
+
+    void timestamp_parser_t::reset()
+    {
+        mDominant = TimestampUnknown;
+        mSamples  = 0;
+        for (s32 i = 0; i < TimestampFormatCount; ++i)
+            mScore[i] = 0;
+        mFastHits   = 0;
+        mFastMisses = 0;
+    }
+
+    void timestamp_parser_t::learn(ETimestampFormat format)
+    {
+        mScore[format] += 1;
+        if (format != mDominant && mScore[format] > mScore[mDominant])
+            mDominant = format;
+        if (++mSamples == sParserWindow)
+        {
+            for (s32 i = 0; i < TimestampFormatCount; ++i)
+                mScore[i] >>= 1;
+            mSamples = 0;
+        }
+    }
+
+    bool timestamp_parser_t::parse(const char* str, s32 len, datetime_t& out)
+    {
+        if (mDominant != TimestampUnknown)
+        {
+            if (ntime::parseTimestamp(mDominant, str, len, out, mYear))
+            {
+                mFastHits += 1;
+                learn(mDominant);
+                return true;
+            }
+            mFastMisses += 1;
+        }
+
+        ETimestampFormat const format = ntime::classifyTimestamp(str, len);
+        if (format == TimestampUnknown || format == mDominant)
+            return false;
+        if (!ntime::parseTimestamp(format, str, len, out, mYear))
+            return false;
+        learn(format);
+        return true;
+    }
+
+    s32 timestamp_parser_t::parse(const char* const* strs, const s32* lens, s32 count, datetime_t* out, u64* failMask)
+    {
+        if (failMask != nullptr)
+        {
+            for (s32 i = 0; i < ((count + 63) >> 6); ++i)
+                failMask[i] = 0;
+        }
+
+        s32 parsed = 0;
+        for (s32 i = 0; i < count; ++i)
+        {
+            if (parse(strs[i], lens[i], out[i]))
+            {
+                parsed += 1;
+            }
+            else
+            {
+                out[i] = datetime_t::sMinValue;
+                if (failMask != nullptr)
+                    failMask[i >> 6] |= (u64)1 << (i & 63);
+            }
+        }
+        return parsed;
+    }
+
+}; // namespace ncore
@@ -0,0 +1,224 @@
+#include "ccore/c_allocator.h"
+#include "ccore/c_debug.h"
+
+#include "ctime/c_deadline_queue.h"
+
+namespace ncore
+{
+    // The children of heap position i are 4i+1 .. 4i+4, storing position i at index i+3 of
+    // a 64 byte aligned array puts every group of children in one half of a cache line.
+    static const u32 sDeadlineShift = 3;
+
+    static inline timer_handle_t sHandle(u32 slot, u32 generation) { return ((u64)generation << 32) | slot; }
+
+    deadline_queue_t::deadline_queue_t()
+        : mAllocator(nullptr)
+        , mDeadlines(nullptr)
+        , mPayloads(nullptr)
+        , mSlots(nullptr)
+        , mPositions(nullptr)
+        , mGenerations(nullptr)
+        , mFree(0)
+        , mSize(0)
+        , mCapacity(0)
+    {
+    }
+
+    deadline_queue_t::~deadline_queue_t() { exit(); }
+
+    bool deadline_queue_t::init(alloc_t* allocator, u32 capacity)
+    {
+        ASSERTS(mAllocator == nullptr, "deadline_queue_t is already initialized");
+        ASSERTS(capacity > 0 && capacity < 0x10000000, "invalid deadline_queue_t capacity");
+
+        tick_t* deadlines = (tick_t*)allocator->allocate(sizeof(tick_t) * (capacity + sDeadlineShift), 64);
+        mPayloads         = (void**)allocator->allocate(sizeof(void*) * capacity, sizeof(void*));
+        mSlots            = (u32*)allocator->allocate(sizeof(u32) * capacity * 3, sizeof(u32));
+        if (deadlines == nullptr || mPayloads == nullptr || mSlots == nullptr)
+        {
+            if (deadlines != nullptr)
+                allocator->deallocate(deadlines);
+            if (mPayloads != nullptr)
+                allocator->deallocate(mPayloads);
+            if (mSlots != nullptr)
+                allocator->deallocate(mSlots);
+            mPayloads = nullptr;
+            mSlots    = nullptr;
+            return false;
+        }
+
+        mAllocator   = allocator;
+        mDeadlines   = deadlines + sDeadlineShift;
+        mPositions   = mSlots + capacity;
+        mGenerations = mPositions + capacity;
+        for (u32 i = 0; i < capacity; ++i)
+        {
+            mPositions[i]   = i + 1; // free list
+            mGenerations[i] = 1;
+        }
+        mFree     = 0;
+        mSize     = 0;
+        mCapacity = capacity;
+        return true;
+    }
+
+    void deadline_queue_t::exit()
+    {
+        if (mAllocator != nullptr)
+        {
+            mAllocator->deallocate(mDeadlines - sDeadlineShift);
+            mAllocator->deallocate(mPayloads);
+            mAllocator->deallocate(mSlots);
+        }
+        mAllocator   = nullptr;
+        mDeadlines   = nullptr;
+        mPayloads    = nullptr;
+        mSlots       = nullptr;
+        mPositions   = nullptr;
+        mGenerations = nullptr;
+        mSize        = 0;
+        mCapacity    = 0;
+    }
+
+    timer_handle_t deadline_queue_t::push(tick_t deadline, void* payload)
+    {
+        if (mSize == mCapacity)
+            return 0;
+
+        u32 const slot = mFree;
+        mFree          = mPositions[slot];
+        mSize += 1;
+        siftUp(mSize - 1, deadline, payload, slot);
+        return sHandle(slot, mGenerations[slot]);
+    }
+
+    bool deadline_queue_t::cancel(timer_handle_t handle)
+    {
+        u32 const slot = slotOf(handle);
+        if (slot == mCapacity)
+            return false;
+        removeAt(mPositions[slot]);
+        return true;
+    }
+
+    bool deadline_queue_t::reschedule(timer_handle_t handle, tick_t deadline)
+    {
+        u32 const slot = slotOf(handle);
+        if (slot == mCapacity)
+            return false;
+
+        u32 const pos = mPositions[slot];
+        if (deadline < mDeadlines[pos])
+            siftUp(pos, deadline, mPayloads[pos], slot);
+        else
+            siftDown(pos, deadline, mPayloads[pos], slot);
+        return true;
+    }
+
+    bool deadline_queue_t::isQueued(timer_handle_t handle) const { return slotOf(handle) != mCapacity; }
+
+    bool deadline_queue_t::peek(entry_t& entry) const
+    {
+        if (mSize == 0)
+            return false;
+        entry.mDeadline = mDeadlines[0];
+        entry.mPayload  = mPayloads[0];
+        entry.mHandle   = sHandle(mSlots[0], mGenerations[mSlots[0]]);
+        return true;
+    }
+
+    bool deadline_queue_t::pop(entry_t& entry)
+    {
+        if (!peek(entry))
+            return false;
+        removeAt(0);
+        return true;
+    }
+
+    u32 deadline_queue_t::popExpired(tick_t now, entry_t* out, u32 max)
+    {
+        u32 n = 0;
+        while (n < max && mSize > 0 && mDeadlines[0] <= now)
+        {
+            peek(out[n++]);
+            removeAt(0);
+        }
+        return n;
+    }
+
+    // Moves the hole at 'pos' up until the parent is not later than 'deadline' and fills it
+    void deadline_queue_t::siftUp(u32 pos, tick_t deadline, void* payload, u32 slot)
+    {
+        while (pos > 0)
+        {
+            u32 const parent = (pos - 1) >> 2;
+            if (mDeadlines[parent] <= deadline)
+                break;
+            mDeadlines[pos]            = mDeadlines[parent];
+            mPayloads[pos]             = mPayloads[parent];
+            mSlots[pos]                = mSlots[parent];
+            mPositions[mSlots[parent]] = pos;
+            pos                        = parent;
+        }
+        mDeadlines[pos]  = deadline;
+        mPayloads[pos]   = payload;
+        mSlots[pos]      = slot;
+        mPositions[slot] = pos;
+    }
+
+    // Moves the hole at 'pos' down until no child is earlier than 'deadline' and fills it
+    void deadline_queue_t::siftDown(u32 pos, tick_t deadline, void* payload, u32 slot)
+    {
+        for (;;)
+        {
+            u32 const first = (pos << 2) + 1;
+            if (first >= mSize)
+                break;
+            u32 const end   = (first + 4) < mSize ? (first + 4) : mSize;
+            u32       child = first;
+            for (u32 c = first + 1; c < end; ++c)
+                child = (mDeadlines[c] < mDeadlines[child]) ? c : child;
+            if (mDeadlines[child] >= deadline)
+                break;
+            mDeadlines[pos]           = mDeadlines[child];
+            mPayloads[pos]            = mPayloads[child];
+            mSlots[pos]               = mSlots[child];
+            mPositions[mSlots[child]] = pos;
+            pos                       = child;
+        }
+        mDeadlines[pos]  = deadline;
+        mPayloads[pos]   = payload;
+        mSlots[pos]      = slot;
+        mPositions[slot] = pos;
+    }
+
+    // Releases the handle slot of the entry at 'pos' and fills the hole with the last entry
+    void deadline_queue_t::removeAt(u32 pos)
+    {
+        u32 const slot = mSlots[pos];
+        mGenerations[slot] += (mGenerations[slot] == 0xffffffff) ? 2 : 1; // skip 0, a handle is never 0
+        mPositions[slot] = mFree;
+        mFree            = slot;
+
+        mSize -= 1;
+        if (pos == mSize)
+            return;
+
+        tick_t const deadline = mDeadlines[mSize];
+        if (pos > 0 && mDeadlines[(pos - 1) >> 2] > deadline)
+            siftUp(pos, deadline, mPayloads[mSize], mSlots[mSize]);
+        else
+            siftDown(pos, deadline, mPayloads[mSize], mSlots[mSize]);
+    }
+
+    // The handle slot of a queued entry, mCapacity when the handle is stale
+    u32 deadline_queue_t::slotOf(timer_handle_t handle) const
+    {
+        u32 const slot = (u32)handle;
+        if (slot >= mCapacity || mGenerations[slot] != (u32)(handle >> 32))
+            return mCapacity;
+        u32 const pos = mPositions[slot];
+        return (pos < mSize && mSlots[pos] == slot) ? slot : mCapacity;
+    }
+
+}; // namespace ncore
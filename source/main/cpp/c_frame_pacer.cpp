@@ -0,0 +1,126 @@
+#include "ccore/c_debug.h"
+
+#include "ctime/c_time.h"
+#include "ctime/c_sleep.h"
+#include "ctime/c_frame_pacer.h"
+#include "ctime/private/c_os_sleep.h"
+
+namespace ncore
+{
+    frame_pacer_t::frame_pacer_t()
+        : mEpoch(0)
+        , mIndex(0)
+        , mSpan(1)
+        , mNumerator(1)
+        , mDenominator(1)
+        , mMaxCatchUp(8)
+        , mPolicy(FrameSkip)
+        , mWait(FrameWaitSleep)
+    {
+        resetStats();
+    }
+
+    void frame_pacer_t::start(u32 framesPerSecond, u32 denominator, EFrameMissPolicy policy, EFrameWait wait)
+    {
+        mPolicy = policy;
+        mWait   = wait;
+        resetStats();
+        mFrameRate.restart();
+        mEpoch = getTime();
+        mIndex = 0;
+        setRate(framesPerSecond, denominator);
+    }
+
+    void frame_pacer_t::setRate(u32 framesPerSecond, u32 denominator)
+    {
+        ASSERTS(framesPerSecond > 0 && denominator > 0, "invalid frame rate");
+        s64 const span = getTicksPerSecond() * (s64)denominator;
+        ASSERTS(span >= (s64)framesPerSecond, "frame rate above the resolution of getTime()");
+
+        mEpoch       = deadlineOf(mIndex);
+        mIndex       = 0;
+        mSpan        = span;
+        mNumerator   = framesPerSecond;
+        mDenominator = denominator;
+    }
+
+    void frame_pacer_t::resync()
+    {
+        mEpoch = getTime();
+        mIndex = 0;
+    }
+
+    tick_t frame_pacer_t::waitFrame()
+    {
+        mIndex += 1;
+        tick_t deadline = deadlineOf(mIndex);
+        tick_t now      = getTime();
+        if (now < deadline)
+        {
+            switch (mWait)
+            {
+                case FrameWaitSleep:
+                    ntime::sleepUntil(deadline);
+                    now = getTime();
+                    break;
+                case FrameWaitSpin:
+                    while (now < deadline)
+                    {
+                        ntime::osPause();
+                        now = getTime();
+                    }
+                    break;
+                case FrameWaitNone: now = deadline; break;
+            }
+        }
+        else
+        {
+            // The slots that passed before this frame started
+            u64 const passed = slotOf(now) - mIndex;
+            if (passed > 0)
+            {
+                u64 const drop = (mPolicy == FrameSkip) ? passed : (passed > mMaxCatchUp ? passed - mMaxCatchUp : 0);
+                mIndex += drop;
+                mSkipped += drop;
+                mMissed += drop + ((passed > drop) ? 1 : 0); // catching up, this frame is late too
+                deadline = deadlineOf(mIndex);
+            }
+        }
+
+        tick_t const lateness = now - deadline;
+        mTotalLateness += lateness;
+        mMaxLateness = (lateness > mMaxLateness) ? lateness : mMaxLateness;
+        mFrames += 1;
+        mFrameRate.markFrame();
+        return deadline;
+    }
+
+    tick_t frame_pacer_t::getPeriod() const { return mSpan / mNumerator; }
+
+    void frame_pacer_t::resetStats()
+    {
+        mFrames        = 0;
+        mMissed        = 0;
+        mSkipped       = 0;
+        mMaxLateness   = 0;
+        mTotalLateness = 0;
+    }
+
+    // Rounded up, a deadline is never before the exact time of the frame
+    tick_t frame_pacer_t::deadlineOf(u64 index) const
+    {
+        u64 const q = index / mNumerator;
+        u64 const r = index % mNumerator;
+        return mEpoch + (tick_t)q * mSpan + ((tick_t)r * mSpan + mNumerator - 1) / mNumerator;
+    }
+
+    // The index of the last deadline at or before 'time'
+    u64 frame_pacer_t::slotOf(tick_t time) const
+    {
+        tick_t const elapsed = time - mEpoch;
+        u64 const    q       = (u64)(elapsed / mSpan);
+        u64 const    r       = (u64)(elapsed % mSpan);
+        return q * mNumerator + (r * mNumerator) / (u64)mSpan;
+    }
+
+}; // namespace ncore
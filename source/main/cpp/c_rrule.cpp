@@ -0,0 +1,682 @@
+#include "ccore/c_target.h"
+#include "ccore/c_debug.h"
+
+#include "ctime/c_rrule.h"
+#include "ctime/c_datetime_parse.h"
+
+#include "ctime/private/c_bits.h"
+#include "ctime/private/c_calendar.h"
+#include "ctime/private/c_digits.h"
+
+namespace ncore
+{
+    using namespace ncalendar;
+    using namespace nbits;
+    using namespace ndigits;
+
+    static const u64 sTicksMask = D_CONSTANT_U64(0x3fffffffffffffff);
+
+    static const u8 sByDay      = 0x01;
+    static const u8 sByMonthDay = 0x02;
+
+    static const char* sWeekdayNames = "SUMOTUWETHFRSA";
+
+    static inline s64 sTicksOf(datetime_t dt) { return (s64)(dt.ticks() & sTicksMask); }
+    static inline s32 sMaxDay() { return daysFromCivil(9999, 12, 31); }
+
+    // Month index (year * 12 + month - 1) of a day number
+    static inline s32 sMonthIndexOf(s32 days)
+    {
+        s32 year, month, day;
+        civilFromDays(days, year, month, day);
+        return year * 12 + month - 1;
+    }
+
+    static inline s32 sFirstDayOf(s32 monthIndex) { return daysFromCivil(monthIndex / 12, monthIndex % 12 + 1, 1); }
+
+    // ------------------------------------------------------------------------------------------
+    // Parsing
+
+    static bool sEquals(const char* str, s32 len, const char* name)
+    {
+        s32 i = 0;
+        while (i < len && name[i] != 0 && toUpper(str[i]) == name[i])
+            i += 1;
+        return i == len && name[i] == 0;
+    }
+
+    static bool sParseSigned(const char* str, s32 len, s32& value)
+    {
+        bool const negative = (len > 0 && str[0] == '-');
+        if (len > 0 && (str[0] == '-' || str[0] == '+'))
+        {
+            str += 1;
+            len -= 1;
+        }
+        if (!parseDigits(str, len, value))
+            return false;
+        value = negative ? -value : value;
+        return true;
+    }
+
+    static bool sParseWeekday(const char* str, s32 len, s32& weekday)
+    {
+        if (len != 2)
+            return false;
+        for (s32 i = 0; i < 7; ++i)
+        {
+            if (toUpper(str[0]) == sWeekdayNames[i * 2] && toUpper(str[1]) == sWeekdayNames[i * 2 + 1])
+            {
+                weekday = i;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Length of the next item of a comma separated list
+    static s32 sItemLength(const char* str, s32 len)
+    {
+        s32 n = 0;
+        while (n < len && str[n] != ',')
+            n += 1;
+        return n;
+    }
+
+    rrule_t::rrule_t()
+        : mStart()
+        , mUntil(datetime_t::sMaxValue)
+        , mExDates(nullptr)
+        , mNumExDates(0)
+        , mInterval(1)
+        , mCount(0)
+        , mNthWeekdays(0)
+        , mLastNthWeekdays(0)
+        , mMonthDays(0)
+        , mLastMonthDays(0)
+        , mMonths(0)
+        , mWeekdays(0)
+        , mNumSetPos(0)
+        , mFrequency(RRuleDaily)
+        , mWeekStart(Monday)
+        , mFlags(0)
+    {
+        for (s32 i = 0; i < 8; ++i)
+            mSetPos[i] = 0;
+    }
+
+    bool rrule_t::parse(const char* str, datetime_t start)
+    {
+        s32 len = 0;
+        while (str[len] != 0)
+            len += 1;
+        return parse(str, len, start);
+    }
+
+    bool rrule_t::parse(const char* str, s32 len, datetime_t start)
+    {
+        if (len >= 6 && sEquals(str, 6, "RRULE:"))
+        {
+            str += 6;
+            len -= 6;
+        }
+
+        // Into a copy, a failed parse leaves this one as it was
+        rrule_t rule;
+        rule.mStart     = start;
+        rule.mFrequency = 0xff;
+        bool hasUntil   = false;
+        while (len > 0)
+        {
+            s32 n = 0;
+            while (n < len && str[n] != ';')
+                n += 1;
+            s32 eq = 0;
+            while (eq < n && str[eq] != '=')
+                eq += 1;
+            if (eq == 0 || eq >= n - 1)
+                return false;
+            if (!rule.parsePart(str, eq, str + eq + 1, n - eq - 1))
+                return false;
+            hasUntil = hasUntil || sEquals(str, eq, "UNTIL");
+            if (n == len)
+                break;
+            str += n + 1;
+            len -= n + 1;
+        }
+        if (rule.mFrequency == 0xff || (hasUntil && rule.mCount > 0))
+            return false;
+
+        // An INTERVAL spanning the datetime_t range (10000 years) only has the first period, capping
+        // it keeps the steps (e.g. INTERVAL * TicksPerHour) and the period arithmetic from overflowing
+        static const s32 sMaxInterval[] = {0x7fffffff, 0x7fffffff, 10000 * 8766, 10000 * 366, 10000 * 53, 10000 * 12, 10000};
+        rule.mInterval                  = rule.mInterval < sMaxInterval[rule.mFrequency] ? rule.mInterval : sMaxInterval[rule.mFrequency];
+
+        // An ordinal BYDAY is within the month
+        bool const ordinal = (rule.mNthWeekdays | rule.mLastNthWeekdays) != 0;
+        if (ordinal && !(rule.mFrequency == RRuleMonthly || (rule.mFrequency == RRuleYearly && rule.mMonths != 0)))
+            return false;
+
+        // Without a day rule part the day of DTSTART repeats
+        s32 year, month, day;
+        s64 const ticks = sTicksOf(start);
+        civilFromDays((s32)(ticks / TicksPerDay), year, month, day);
+        if ((rule.mFlags & (sByDay | sByMonthDay)) == 0)
+        {
+            if (rule.mFrequency == RRuleWeekly)
+            {
+                rule.mWeekdays = (u8)(1 << dayOfWeek((s32)(ticks / TicksPerDay)));
+                rule.mFlags |= sByDay;
+            }
+            else if (rule.mFrequency == RRuleMonthly || rule.mFrequency == RRuleYearly)
+            {
+                rule.mMonthDays = (u32)1 << day;
+                rule.mFlags |= sByMonthDay;
+                if (rule.mFrequency == RRuleYearly && rule.mMonths == 0)
+                    rule.mMonths = (u16)(1 << month);
+            }
+        }
+
+        *this = rule;
+        return true;
+    }
+
+    bool rrule_t::parsePart(const char* key, s32 keyLen, const char* value, s32 valueLen)
+    {
+        if (sEquals(key, keyLen, "FREQ"))
+        {
+            static const char* sNames[] = {"SECONDLY", "MINUTELY", "HOURLY", "DAILY", "WEEKLY", "MONTHLY", "YEARLY"};
+            for (s32 i = 0; i < 7; ++i)
+            {
+                if (sEquals(value, valueLen, sNames[i]))
+                {
+                    mFrequency = (u8)i;
+                    return true;
+                }
+            }
+            return false;
+        }
+        if (sEquals(key, keyLen, "INTERVAL"))
+            return parseDigits(value, valueLen, mInterval) && mInterval >= 1;
+        if (sEquals(key, keyLen, "COUNT"))
+            return parseDigits(value, valueLen, mCount) && mCount >= 1;
+        if (sEquals(key, keyLen, "UNTIL"))
+        {
+            // A date is inclusive, up to the end of that day
+            if (!ntime::parseTimestamp(TimestampIso8601, value, valueLen, mUntil))
+                return false;
+            if (valueLen == 8)
+                mUntil = datetime_t((u64)(sTicksOf(mUntil) + TicksPerDay - 1));
+            return true;
+        }
+        if (sEquals(key, keyLen, "WKST"))
+        {
+            s32 weekday;
+            if (!sParseWeekday(value, valueLen, weekday))
+                return false;
+            mWeekStart = (u8)weekday;
+            return true;
+        }
+
+        // The lists
+        s32 part = -1;
+        if (sEquals(key, keyLen, "BYMONTH"))
+            part = 0;
+        else if (sEquals(key, keyLen, "BYMONTHDAY"))
+            part = 1;
+        else if (sEquals(key, keyLen, "BYDAY"))
+            part = 2;
+        else if (sEquals(key, keyLen, "BYSETPOS"))
+            part = 3;
+        if (part < 0)
+            return false; // BYSECOND, BYMINUTE, BYHOUR, BYYEARDAY, BYWEEKNO and anything else
+
+        while (valueLen > 0)
+        {
+            s32 const n = sItemLength(value, valueLen);
+            s32       v;
+            switch (part)
+            {
+                case 0:
+                    if (!parseDigits(value, n, v) || v < 1 || v > 12)
+                        return false;
+                    mMonths |= (u16)(1 << v);
+                    break;
+                case 1:
+                    if (!sParseSigned(value, n, v) || v == 0 || v < -31 || v > 31)
+                        return false;
+                    if (v > 0)
+                        mMonthDays |= (u32)1 << v;
+                    else
+                        mLastMonthDays |= (u32)1 << -v;
+                    mFlags |= sByMonthDay;
+                    break;
+                case 2:
+                {
+                    s32 weekday;
+                    if (n < 2 || !sParseWeekday(value + n - 2, 2, weekday))
+                        return false;
+                    mFlags |= sByDay;
+                    if (n == 2)
+                    {
+                        mWeekdays |= (u8)(1 << weekday);
+                        break;
+                    }
+                    if (!sParseSigned(value, n - 2, v) || v == 0 || v < -5 || v > 5)
+                        return false;
+                    if (v > 0)
+                        mNthWeekdays |= D_CONSTANT_U64(1) << ((v - 1) * 7 + weekday);
+                    else
+                        mLastNthWeekdays |= D_CONSTANT_U64(1) << ((-v - 1) * 7 + weekday);
+                    break;
+                }
+                case 3:
+                    if (mNumSetPos == 8 || !sParseSigned(value, n, v) || v == 0 || v < -366 || v > 366)
+                        return false;
+                    mSetPos[mNumSetPos++] = (s16)v;
+                    break;
+            }
+            if (n == valueLen)
+                break;
+            value += n + 1;
+            valueLen -= n + 1;
+            if (valueLen == 0)
+                return false; // trailing ','
+        }
+        return true;
+    }
+
+    void rrule_t::setExDates(const datetime_t* exdates, s32 count)
+    {
+        mExDates    = exdates;
+        mNumExDates = count;
+    }
+
+    u32 rrule_t::daysOf(s32 year, s32 month) const
+    {
+        if (mMonths != 0 && ((mMonths >> month) & 1) == 0)
+            return 0;
+
+        s32 const days = daysInMonth(year, month);
+        u32       mask = (((u32)1 << days) - 1) << 1;
+        if (mFlags & sByMonthDay)
+        {
+            u32 dom = mMonthDays & mask;
+            for (u32 m = mLastMonthDays; m != 0; m &= m - 1)
+            {
+                s32 const day = days + 1 - lowestBit(m);
+                if (day >= 1)
+                    dom |= (u32)1 << day;
+            }
+            mask &= dom;
+        }
+        if (mFlags & sByDay)
+        {
+            s32 const first = dayOfWeek(daysFromCivil(year, month, 1));
+            mask &= weekdaysOfMonth(first, days, mWeekdays, mNthWeekdays, mLastNthWeekdays);
+        }
+        return mask;
+    }
+
+    // BYSETPOS, 'index' is the 1 based position of a candidate among the 'total' of its period
+    bool rrule_t::isSelected(s32 index, s32 total) const
+    {
+        for (s32 i = 0; i < mNumSetPos; ++i)
+        {
+            s32 const pos = mSetPos[i];
+            if ((pos > 0 ? pos : (total + 1 + pos)) == index)
+                return true;
+        }
+        return false;
+    }
+
+    s32 rrule_t::numSelected(s32 total) const
+    {
+        if (mNumSetPos == 0)
+            return total;
+        s32 count = 0;
+        for (s32 i = 0; i < mNumSetPos; ++i)
+        {
+            s32 const index = mSetPos[i] > 0 ? mSetPos[i] : (total + 1 + mSetPos[i]);
+            if (index < 1 || index > total)
+                continue;
+            bool duplicate = false;
+            for (s32 j = 0; j < i && !duplicate; ++j)
+                duplicate = (mSetPos[j] > 0 ? mSetPos[j] : (total + 1 + mSetPos[j])) == index;
+            count += duplicate ? 0 : 1;
+        }
+        return count;
+    }
+
+    s32 rrule_t::expand(datetime_t begin, datetime_t end, datetime_t* out, s32 max) const
+    {
+        rrule_iterator_t it;
+        it.init(this);
+        it.seek(begin);
+        s32        n = 0;
+        datetime_t when;
+        while (n < max && it.next(when) && when < end)
+            out[n++] = when;
+        return n;
+    }
+
+    // ------------------------------------------------------------------------------------------
+    // Iterator
+
+    static inline s64 sStepOf(const rrule_t* rule, s32 interval)
+    {
+        switch (rule->frequency())
+        {
+            case RRuleSecondly: return interval * TicksPerSecond;
+            case RRuleMinutely: return interval * TicksPerMinute;
+            default: return interval * TicksPerHour;
+        }
+    }
+
+    rrule_iterator_t::rrule_iterator_t()
+        : mRule(nullptr)
+        , mPeriod(0)
+        , mMonth(0)
+        , mLast(0)
+        , mMask(0)
+        , mIndex(1)
+        , mTotal(0)
+        , mEmitted(0)
+        , mExDate(0)
+        , mDone(true)
+    {
+    }
+
+    void rrule_iterator_t::init(const rrule_t* rule)
+    {
+        mRule    = rule;
+        mEmitted = 0;
+        mExDate  = 0;
+        mDone    = false;
+        loadPeriod(0);
+    }
+
+    // The days [first, last] of a DAILY, WEEKLY, MONTHLY or YEARLY period
+    void rrule_iterator_t::periodRange(s64 period, s32& first, s32& last) const
+    {
+        s32 const start    = (s32)(sTicksOf(mRule->mStart) / TicksPerDay);
+        s64 const interval = mRule->mInterval;
+        s64       index    = period * interval;
+        switch (mRule->mFrequency)
+        {
+            case RRuleDaily:
+                first = last = (s32)(start + index);
+                return;
+            case RRuleWeekly:
+                first = (s32)(startOfWeek(start, mRule->mWeekStart) + 7 * index);
+                last  = first + 6;
+                return;
+            case RRuleMonthly:
+                index += sMonthIndexOf(start);
+                if (index > 9999 * 12 + 11)
+                    break;
+                first = sFirstDayOf((s32)index);
+                last  = first + daysInMonth((s32)(index / 12), (s32)(index % 12) + 1) - 1;
+                return;
+            default:
+            {
+                s32 year, month, day;
+                civilFromDays(start, year, month, day);
+                index += year;
+                if (index > 9999)
+                    break;
+                first = daysFromCivil((s32)index, 1, 1);
+                last  = daysFromCivil((s32)index, 12, 31);
+                return;
+            }
+        }
+        first = last = sMaxDay() + 1;
+    }
+
+    // The candidate days of month 'month' within [first, last]
+    u32 rrule_iterator_t::chunkMask(s32 month, s32 first, s32 last) const
+    {
+        s32 const day0 = sFirstDayOf(month);
+        s32 const lo   = (first > day0) ? (first - day0 + 1) : 1;
+        s32 const hi   = last - day0 + 1; // beyond the month is fine, there are no bits
+        if (hi < lo)
+            return 0;
+        u32 const range = (u32)(((D_CONSTANT_U64(2) << (hi < 31 ? hi : 31)) - 1) & ~((D_CONSTANT_U64(1) << lo) - 1));
+        return mRule->daysOf(month / 12, month % 12 + 1) & range;
+    }
+
+    s32 rrule_iterator_t::periodTotal(s32 first, s32 last) const
+    {
+        s32 total = 0;
+        for (s32 month = sMonthIndexOf(first), end = sMonthIndexOf(last); month <= end; ++month)
+            total += popCount(chunkMask(month, first, last));
+        return total;
+    }
+
+    void rrule_iterator_t::loadPeriod(s64 period)
+    {
+        mPeriod = period;
+        mIndex  = 1;
+        mTotal  = 1;
+        if (mRule->mFrequency < RRuleDaily)
+            return;
+
+        s32 first;
+        periodRange(period, first, mLast);
+        if (first > sMaxDay())
+        {
+            mDone = true;
+            return;
+        }
+        mMonth = sMonthIndexOf(first);
+        mMask  = chunkMask(mMonth, first, mLast);
+        if (mRule->mNumSetPos != 0)
+            mTotal = periodTotal(first, mLast);
+    }
+
+    bool rrule_iterator_t::nextDay(s32& day)
+    {
+        for (;;)
+        {
+            if (mMask == 0)
+            {
+                if (sFirstDayOf(mMonth + 1) > mLast)
+                    return false;
+                mMonth += 1;
+                mMask = chunkMask(mMonth, 0, mLast);
+                continue;
+            }
+            s32 const bit   = lowestBit(mMask);
+            s32 const index = mIndex++;
+            mMask &= mMask - 1;
+            if (mRule->mNumSetPos != 0 && !mRule->isSelected(index, mTotal))
+                continue;
+            day = sFirstDayOf(mMonth) + bit - 1;
+            return true;
+        }
+    }
+
+    bool rrule_iterator_t::advance(s64& ticks)
+    {
+        if (mDone)
+            return false;
+        if (mRule->mCount > 0 && mEmitted >= mRule->mCount)
+        {
+            mDone = true;
+            return false;
+        }
+
+        s64 const start   = sTicksOf(mRule->mStart);
+        s64 const horizon = (s64)146097 * TicksPerDay; // 400 years without an occurrence, there is none
+        s64       t       = 0;
+        if (mRule->mFrequency < RRuleDaily)
+        {
+            // One candidate per period, days that do not match are skipped as a whole
+            s64 const step = sStepOf(mRule, mRule->mInterval);
+            if (mRule->mNumSetPos != 0 && !mRule->isSelected(1, 1))
+                mDone = true;
+            s64 const from = start + mPeriod * step;
+            while (!mDone)
+            {
+                t = start + mPeriod * step;
+                if (t > (s64)sMaxDay() * TicksPerDay || t - from > horizon)
+                {
+                    mDone = true;
+                    break;
+                }
+                s32 year, month, day;
+                civilFromDays((s32)(t / TicksPerDay), year, month, day);
+                if ((mRule->daysOf(year, month) >> day) & 1)
+                {
+                    mPeriod += 1;
+                    break;
+                }
+                s64 const tomorrow = (t / TicksPerDay + 1) * TicksPerDay;
+                mPeriod            = (tomorrow - start + step - 1) / step;
+            }
+        }
+        else
+        {
+            s64 const tod  = start % TicksPerDay;
+            s32 const from = mLast;
+            for (;;)
+            {
+                s32 day;
+                if (!nextDay(day))
+                {
+                    if ((s64)(mLast - from) * TicksPerDay > horizon)
+                        mDone = true;
+                    else
+                        loadPeriod(mPeriod + 1);
+                    if (mDone)
+                        break;
+                    continue;
+                }
+                t = (s64)day * TicksPerDay + tod;
+                if (t >= start)
+                    break;
+            }
+        }
+
+        if (mDone || t > sTicksOf(mRule->mUntil))
+        {
+            mDone = true;
+            return false;
+        }
+        mEmitted += 1;
+        ticks = t;
+        return true;
+    }
+
+    bool rrule_iterator_t::next(datetime_t& out)
+    {
+        s64 t;
+        while (advance(t))
+        {
+            while (mExDate < mRule->mNumExDates && sTicksOf(mRule->mExDates[mExDate]) < t)
+                mExDate += 1;
+            if (mExDate < mRule->mNumExDates && sTicksOf(mRule->mExDates[mExDate]) == t)
+                continue;
+            out = datetime_t((u64)t);
+            return true;
+        }
+        return false;
+    }
+
+    void rrule_iterator_t::seek(datetime_t at)
+    {
+        init(mRule);
+        s64 const target = sTicksOf(at);
+        s64 const start  = sTicksOf(mRule->mStart);
+        if (target <= start)
+            return;
+
+        // The first EXDATE that is not before 'at'
+        s32 lo = 0, hi = mRule->mNumExDates;
+        while (lo < hi)
+        {
+            s32 const mid = (lo + hi) >> 1;
+            if (sTicksOf(mRule->mExDates[mid]) < target)
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+        mExDate = lo;
+
+        if (mRule->mCount == 0)
+        {
+            // The period holding the first day with a possible occurrence at or after 'at'
+            s64 const interval = mRule->mInterval;
+            s64       units    = 0;
+            if (mRule->mFrequency < RRuleDaily)
+            {
+                units = (target - start + sStepOf(mRule, 1) - 1) / sStepOf(mRule, 1);
+            }
+            else
+            {
+                s32 const first = (s32)(start / TicksPerDay);
+                s32 const day   = (s32)(target / TicksPerDay) + ((target % TicksPerDay > start % TicksPerDay) ? 1 : 0);
+                switch (mRule->mFrequency)
+                {
+                    case RRuleDaily: units = day - first; break;
+                    case RRuleWeekly: units = (startOfWeek(day, mRule->mWeekStart) - startOfWeek(first, mRule->mWeekStart)) / 7; break;
+                    case RRuleMonthly: units = sMonthIndexOf(day) - sMonthIndexOf(first); break;
+                    default: units = sMonthIndexOf(day) / 12 - sMonthIndexOf(first) / 12; break;
+                }
+            }
+            loadPeriod((units + interval - 1) / interval);
+        }
+        else if (mRule->mFrequency >= RRuleDaily)
+        {
+            // The first period one by one, it may hold candidates before DTSTART
+            s64 t;
+            for (;;)
+            {
+                rrule_iterator_t const saved = *this;
+                if (!advance(t))
+                    return;
+                if (t >= target)
+                {
+                    *this = saved;
+                    return;
+                }
+                if (mPeriod != 0)
+                {
+                    *this = saved;
+                    break;
+                }
+            }
+
+            // Whole periods before 'at' are counted from their day bitsets
+            s64 const tod = start % TicksPerDay;
+            for (s64 period = mPeriod + 1; !mDone; ++period)
+            {
+                s32 first, last;
+                periodRange(period, first, last);
+                if ((s64)last * TicksPerDay + tod >= target || first > sMaxDay())
+                {
+                    loadPeriod(period);
+                    break;
+                }
+                mEmitted += mRule->numSelected(periodTotal(first, last));
+                if (mEmitted >= mRule->mCount)
+                    mDone = true;
+            }
+        }
+
+        // Within the period, one by one
+        s64 t;
+        for (;;)
+        {
+            rrule_iterator_t const saved = *this;
+            if (!advance(t))
+                return;
+            if (t >= target)
+            {
+                *this = saved;
+                return;
+            }
+        }
+    }
+
+}; // namespace ncore
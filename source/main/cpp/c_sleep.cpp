@@ -0,0 +1,110 @@
+#include "ccore/c_debug.h"
+
+#include "ctime/c_sleep.h"
+#include "ctime/private/c_os_sleep.h"
+
+#include <atomic>
+
+namespace ncore
+{
+    namespace ntime
+    {
+        static const s64 sMaxOversleepNs = 10000000; ///< A sample above 10 ms is a preemption, not the lateness of the OS sleep
+        static const s64 sMaxMarginNs    = 2000000;
+
+        // Oversleep estimate in nanoseconds, average and mean deviation (as TCP estimates the round trip time)
+        static std::atomic<s64> sMeanNs(100000);
+        static std::atomic<s64> sDevNs(25000);
+
+        static std::atomic<u64> sSleeps(0);
+        static std::atomic<s64> sTotalError(0);
+        static std::atomic<s64> sMaxError(0);
+        static std::atomic<s64> sSleptTicks(0);
+        static std::atomic<s64> sSpunTicks(0);
+
+        static s64 sMarginNs()
+        {
+            s64 const margin = sMeanNs.load(std::memory_order_relaxed) + 4 * sDevNs.load(std::memory_order_relaxed);
+            return margin < sMaxMarginNs ? margin : sMaxMarginNs;
+        }
+
+        // Threads may race on the estimate, a lost sample does not matter. Preemptions are not
+        // learned, they would keep the margin (and the spinning) at its maximum for many sleeps.
+        static void sLearn(s64 oversleepNs)
+        {
+            if (oversleepNs > sMaxOversleepNs)
+                return;
+            oversleepNs        = oversleepNs < 0 ? 0 : oversleepNs;
+            s64 const mean     = sMeanNs.load(std::memory_order_relaxed);
+            s64 const dev      = sDevNs.load(std::memory_order_relaxed);
+            s64 const delta    = oversleepNs - mean;
+            s64 const absDelta = delta < 0 ? -delta : delta;
+            sMeanNs.store(mean + delta / 8, std::memory_order_relaxed);
+            sDevNs.store(dev + (absDelta - dev) / 4, std::memory_order_relaxed);
+        }
+
+        void sleepUntil(tick_t deadline)
+        {
+            tick_t now = getTime();
+            if (now >= deadline)
+                return;
+
+            // Sleep until the margin before the deadline, the OS may return early so it can take more than one sleep
+            tick_t const start = now;
+            for (;;)
+            {
+                tick_t const coarse = deadline - now - nsToTicks(sMarginNs());
+                if (coarse <= 0)
+                    break;
+                osSleep((u64)ticksToNs(coarse));
+                tick_t const woke = getTime();
+                sLearn(ticksToNs(woke - now - coarse));
+                now = woke;
+            }
+
+            tick_t const spin = now;
+            while (now < deadline)
+            {
+                osPause();
+                now = getTime();
+            }
+
+            tick_t const error = now - deadline;
+            sSleeps.fetch_add(1, std::memory_order_relaxed);
+            sTotalError.fetch_add(error, std::memory_order_relaxed);
+            sSleptTicks.fetch_add(spin - start, std::memory_order_relaxed);
+            sSpunTicks.fetch_add(now - spin, std::memory_order_relaxed);
+            s64 maxError = sMaxError.load(std::memory_order_relaxed);
+            while (error > maxError && !sMaxError.compare_exchange_weak(maxError, error, std::memory_order_relaxed))
+            {
+            }
+        }
+
+        void sleepFor(const timespan_t& duration)
+        {
+            if ((s64)duration.ticks() <= 0)
+                return;
+            sleepUntil(getTime() + toTicks(duration));
+        }
+
+        void getSleepStats(sleep_stats_t& stats)
+        {
+            stats.mSleeps     = sSleeps.load(std::memory_order_relaxed);
+            stats.mMargin     = nsToTicks(sMarginNs());
+            stats.mTotalError = sTotalError.load(std::memory_order_relaxed);
+            stats.mMaxError   = sMaxError.load(std::memory_order_relaxed);
+            stats.mSleptTicks = sSleptTicks.load(std::memory_order_relaxed);
+            stats.mSpunTicks  = sSpunTicks.load(std::memory_order_relaxed);
+        }
+
+        void resetSleepStats()
+        {
+            sSleeps.store(0, std::memory_order_relaxed);
+            sTotalError.store(0, std::memory_order_relaxed);
+            sMaxError.store(0, std::memory_order_relaxed);
+            sSleptTicks.store(0, std::memory_order_relaxed);
+            sSpunTicks.store(0, std::memory_order_relaxed);
+        }
+    } // namespace ntime
+
+}; // namespace ncore
@@ -6,6 +6,7 @@
 
 #include "ctime/private/c_time_source.h"
 #include "ctime/private/c_datetime_source.h"
+#include "ctime/private/c_date_lut.h"
 
 namespace ncore
 {
@@ -25,6 +26,18 @@ namespace ncore
     s64    getTicksPerSecond(void) { return ntime::sTimeSource->getTicksPerSecond(); }
     tick_t getTime(void) { return ntime::sTimeSource->getTimeInTicks(); }
 
+    namespace ntime
+    {
+        static const s64 sNsPerSecond = 1000000000;
+
+        // Whole seconds and the remainder are converted apart, 'a * b / c' would overflow
+        static inline s64 sScale(s64 value, s64 from, s64 to) { return (value / from) * to + ((value % from) * to) / from; }
+
+        tick_t toTicks(const timespan_t& span) { return sScale((s64)span.ticks(), (s64)timespan_t::sTicksPerSecond, getTicksPerSecond()); }
+        s64    ticksToNs(tick_t ticks) { return sScale(ticks, getTicksPerSecond(), sNsPerSecond); }
+        tick_t nsToTicks(s64 ns) { return sScale(ns, sNsPerSecond, getTicksPerSecond()); }
+    } // namespace ntime
+
     /**
      * datetime_t
      */
@@ -87,6 +100,22 @@ namespace ncore
     s32 sGetDatePart(EDatePart part, s64 ticks)
     {
         s32 num2 = (s32)(ticks / TicksPerDay);
+#if CTIME_DATE_LUT
+        // Most dates fall in the window of the table
+        u32 const lut = (u32)(num2 - ncalendar::LutFirstDay);
+        if (lut < (u32)ncalendar::LutNumDays)
+        {
+            ncalendar::date_parts_t parts;
+            ncalendar::unpackDateLut(ncalendar::getDateLut()[lut], parts);
+            switch (part)
+            {
+                case DatePartYear: return parts.mYear;
+                case DatePartDayOfYear: return parts.mDayOfYear;
+                case DatePartMonth: return parts.mMonth;
+                default: return parts.mDay;
+            }
+        }
+#endif
         s32 num3 = num2 / DaysPer400Years;
         num2 -= num3 * DaysPer400Years;
         s32 num4 = num2 / DaysPer100Years;
@@ -228,6 +257,58 @@ namespace ncore
      */
     s32 datetime_t::dayOfYear() const { return sGetDatePart(DatePartDayOfYear, __ticks()); }
 
+    /**
+     *  Summary:
+     *      Gets the ISO 8601 week number of this instance, weeks start on Monday and
+     *      week 1 is the week holding the first Thursday of the year.
+     *
+     *  Returns:
+     *      The ISO week, expressed as a value between 1 and 53. Around January 1st it
+     *      can belong to the previous or next year, see isoWeekYear().
+     */
+    s32 datetime_t::isoWeek() const
+    {
+        s32 weekYear, week;
+        ncalendar::isoWeekFromDays((s32)(__ticks() / TicksPerDay), weekYear, week);
+        return week;
+    }
+
+    s32 datetime_t::isoWeekYear() const
+    {
+        s32 weekYear, week;
+        ncalendar::isoWeekFromDays((s32)(__ticks() / TicksPerDay), weekYear, week);
+        return weekYear;
+    }
+
+    /**
+     *  Summary:
+     *      Gets the week of the year of this instance, week 1 is the (partial) week
+     *      holding January 1st and every week starts at firstDayOfWeek.
+     *
+     *  Returns:
+     *      The week of the year, expressed as a value between 1 and 54.
+     */
+    s32 datetime_t::weekOfYear(EDayOfWeek firstDayOfWeek) const
+    {
+        s32 const days = (s32)(__ticks() / TicksPerDay);
+        return ncalendar::weekOfYear(days, dayOfYear(), (s32)firstDayOfWeek % DaysPerWeek);
+    }
+
+    /**
+     *  Summary:
+     *      Gets the start of the week holding this instance.
+     *
+     *  Returns:
+     *      A System.datetime_t at midnight of the most recent firstDayOfWeek on or
+     *      before this date.
+     */
+    datetime_t datetime_t::startOfWeek(EDayOfWeek firstDayOfWeek) const
+    {
+        s32 const days  = ncalendar::startOfWeek((s32)(__ticks() / TicksPerDay), (s32)firstDayOfWeek % DaysPerWeek);
+        s32 const first = days < 0 ? 0 : days; // the week of 0001-01-01 starts before it
+        return datetime_t((u64)(first * TicksPerDay));
+    }
+
     /**
      *  Summary:
      *      Gets the hour component of the date represented by this instance.
@@ -422,9 +503,11 @@ namespace ncore
     {
         ASSERTS((months >= -120000) && (months <= 120000), "ArgumentOutOfRange_DateTimeBadMonths");
 
-        s32 year  = sGetDatePart(DatePartYear, __ticks());
-        s32 month = sGetDatePart(DatePartMonth, __ticks());
-        s32 day   = sGetDatePart(DatePartDay, __ticks());
+        ncalendar::date_parts_t parts;
+        ncalendar::lookupDays((s32)(__ticks() / TicksPerDay), parts);
+        s32 year  = parts.mYear;
+        s32 month = parts.mMonth;
+        s32 day   = parts.mDay;
         s32 num4  = (month - 1) + months;
         if (num4 >= 0)
         {
@@ -592,6 +675,35 @@ namespace ncore
         return datetime_t(systemTime);
     }
 
+    /**
+     *  Summary:
+     *      Creates a datetime_t at midnight of an ISO 8601 week date, e.g. 2020-W53-5
+     *      is 2021-01-01.
+     *
+     *  Parameters:
+     *    weekYear:
+     *      The ISO week-numbering year (1 through 9999).
+     *    week:
+     *      The ISO week (1 through sIsoWeeksInYear(weekYear)).
+     *    isoDayOfWeek:
+     *      The day of the week, 1 is Monday and 7 is Sunday.
+     */
+    datetime_t datetime_t::sFromIsoWeekDate(s32 weekYear, s32 week, s32 isoDayOfWeek)
+    {
+        ASSERTS((weekYear >= 1) && (weekYear <= 9999), "ArgumentOutOfRange_Year");
+        ASSERTS((week >= 1) && (week <= ncalendar::isoWeeksInYear(weekYear)), "ArgumentOutOfRange_Week");
+        ASSERTS((isoDayOfWeek >= 1) && (isoDayOfWeek <= 7), "ArgumentOutOfRange_DayOfWeek");
+        s64 const days = ncalendar::daysFromIsoWeek(weekYear, week, isoDayOfWeek);
+        ASSERTS((days >= 0) && (days * TicksPerDay <= (s64)MaxTicks), "ArgumentOutOfRange_DateArithmetic");
+        return datetime_t((u64)(days * TicksPerDay));
+    }
+
+    s32 datetime_t::sIsoWeeksInYear(s32 weekYear)
+    {
+        ASSERTS((weekYear >= 1) && (weekYear <= 9999), "ArgumentOutOfRange_Year");
+        return ncalendar::isoWeeksInYear(weekYear);
+    }
+
     /**
      *  Summary:
      *      Returns an indication whether the specified year is a leap year.
@@ -2,6 +2,10 @@
 #ifdef TARGET_MAC
 
 #include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 #include "ccore/c_debug.h"
 
@@ -11,6 +15,8 @@
 
 #include "ctime/private/c_time_source.h"
 #include "ctime/private/c_datetime_source.h"
+#include "ctime/private/c_file_mapping.h"
+#include "ctime/private/c_os_sleep.h"
 
 namespace ncore
 {
@@ -39,10 +45,15 @@ namespace ncore
 			return (u64)dt.ticks();
 		}
 
+		// Time difference between local and UTC in minutes (UTC = local + bias), same as win32
 		virtual s64			getSystemTimeZone()
 		{
-			// NOT implemented yet
-			return 0;
+			time_t	curTime;
+			time(&curTime);
+
+			tm		localTime;
+			localtime_r(&curTime, &localTime);
+			return -(s64)(localTime.tm_gmtoff / 60);
 		}
 
 		virtual u64			getSystemTimeAsFileTime()
@@ -140,10 +151,18 @@ namespace ncore
 		tick_t			mLastTicks;
 
 	public:
+		// The monotonic clock in nanoseconds, clock() is the CPU time of the process and stands still while sleeping
+		static tick_t	sNow()
+		{
+			timespec ts;
+			clock_gettime(CLOCK_MONOTONIC, &ts);
+			return (tick_t)ts.tv_sec * 1000000000 + (tick_t)ts.tv_nsec;
+		}
+
 		void			init()
 		{
-			mFreqPerSec  = CLOCKS_PER_SEC;
-			mBaseTimeTick = clock();
+			mFreqPerSec  = 1000000000.0;
+			mBaseTimeTick = sNow();
 		}
 
 		/**
@@ -164,7 +183,7 @@ namespace ncore
 		virtual tick_t	getTimeInTicks()
 		{
 			ASSERT(mBaseTimeTick);
-			s64 ticks = clock();
+			s64 ticks = sNow();
 			ticks -= mBaseTimeTick;
 			return ticks;
 		}
@@ -178,6 +197,48 @@ namespace ncore
 
 	namespace ntime
 	{
+		const u8*		mapFile(const char* path, u64& size)
+		{
+			size = 0;
+			int fd = ::open(path, O_RDONLY);
+			if (fd < 0)
+				return nullptr;
+
+			struct stat st;
+			void* data = MAP_FAILED;
+			if (::fstat(fd, &st) == 0 && st.st_size > 0)
+				data = ::mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+			::close(fd);
+			if (data == MAP_FAILED)
+				return nullptr;
+
+			size = (u64)st.st_size;
+			return (const u8*)data;
+		}
+
+		void			unmapFile(const u8* data, u64 size)
+		{
+			if (data != nullptr)
+				::munmap((void*)data, (size_t)size);
+		}
+
+		void			osSleep(u64 nanoseconds)
+		{
+			timespec ts;
+			ts.tv_sec  = (time_t)(nanoseconds / 1000000000);
+			ts.tv_nsec = (long)(nanoseconds % 1000000000);
+			::nanosleep(&ts, nullptr);
+		}
+
+		void			osPause()
+		{
+#if defined(__x86_64__) || defined(__i386__)
+			__builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+			__asm__ __volatile__("yield");
+#endif
+		}
+
 		void init(void)
 		{
 			static ncore::time_source_mac sTimeSource;
@@ -18,6 +18,8 @@
 
 #include "ctime/private/c_time_source.h"
 #include "ctime/private/c_datetime_source.h"
+#include "ctime/private/c_file_mapping.h"
+#include "ctime/private/c_os_sleep.h"
 
 namespace ncore
 {
@@ -165,6 +167,49 @@ namespace ncore
 
 	namespace ntime
 	{
+		const u8*		mapFile(const char* path, u64& size)
+		{
+			size = 0;
+			HANDLE file = ::CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+			if (file == INVALID_HANDLE_VALUE)
+				return nullptr;
+
+			LARGE_INTEGER fileSize;
+			const u8* data = nullptr;
+			if (::GetFileSizeEx(file, &fileSize) && fileSize.QuadPart > 0)
+			{
+				HANDLE mapping = ::CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+				if (mapping != NULL)
+				{
+					data = (const u8*)::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+					::CloseHandle(mapping);		// The view keeps the mapping alive
+				}
+			}
+			::CloseHandle(file);
+			if (data != nullptr)
+				size = (u64)fileSize.QuadPart;
+			return data;
+		}
+
+		void			unmapFile(const u8* data, u64 size)
+		{
+			if (data != nullptr)
+				::UnmapViewOfFile(data);
+		}
+
+		// Sleep() works in milliseconds and wakes up on a scheduler tick, the margin
+		// learned by sleepUntil covers the lateness
+		void			osSleep(u64 nanoseconds)
+		{
+			DWORD const ms = (DWORD)(nanoseconds / 1000000);
+			::Sleep(ms);
+		}
+
+		void			osPause()
+		{
+			YieldProcessor();
+		}
+
 		void init(void)
 		{
 			static ncore::time_source_win32 sTimeSource;
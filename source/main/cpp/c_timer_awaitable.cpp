@@ -0,0 +1,50 @@
+#include "ccore/c_debug.h"
+
+#include "ctime/c_timer_awaitable.h"
+
+#if defined(__cpp_impl_coroutine)
+
+namespace ncore
+{
+    static thread_local timer_executor_t* tCurrentExecutor = nullptr;
+
+    timer_executor_t::timer_executor_t() {}
+    timer_executor_t::~timer_executor_t() { exit(); }
+
+    bool timer_executor_t::init(alloc_t* allocator, u32 maxWaits, tick_t resolution) { return mWheel.init(allocator, maxWaits, resolution, getTime()); }
+
+    void timer_executor_t::exit()
+    {
+        if (tCurrentExecutor == this)
+            tCurrentExecutor = nullptr;
+        mWheel.exit();
+    }
+
+    void timer_executor_t::makeCurrent() { tCurrentExecutor = this; }
+
+    u32 timer_executor_t::poll() { return poll(getTime()); }
+
+    u32 timer_executor_t::poll(tick_t now)
+    {
+        tCurrentExecutor = this;
+        return mWheel.advance(now);
+    }
+
+    timer_executor_t* timer_executor_t::sCurrent() { return tCurrentExecutor; }
+
+    void timer_executor_t::sResume(timer_handle_t /*handle*/, void* user) { std::coroutine_handle<>::from_address(user).resume(); }
+
+    namespace ntime
+    {
+        sleep_awaitable_t until(timer_executor_t& executor, const datetime_t& when)
+        {
+            timespan_t const span((u64)((s64)when.ticks() - (s64)datetime_t::sNow().ticks()));
+            return sleep_awaitable_t(&executor, getTime() + toTicks(span));
+        }
+
+        sleep_awaitable_t until(const datetime_t& when) { return until(*timer_executor_t::sCurrent(), when); }
+    } // namespace ntime
+
+}; // namespace ncore
+
+#endif // __cpp_impl_coroutine
@@ -0,0 +1,209 @@
+#include "ccore/c_allocator.h"
+#include "ccore/c_debug.h"
+
+#include "ctime/c_timer_coalescer.h"
+
+namespace ncore
+{
+    static const u32 sNil = 0xffffffff;
+
+    enum ENodeState
+    {
+        NodeFree,
+        NodeQueued,
+        NodeFiring,    ///< Taken out of the queues by fire(), the callback did not run yet
+        NodeCancelled, ///< Cancelled while firing
+    };
+
+    struct timer_coalescer_t::node_t
+    {
+        timer_callback_t mCallback;
+        void*            mUser;
+        timer_handle_t   mEarliest;
+        timer_handle_t   mLatest;
+        u32              mGeneration;
+        u32              mState;
+        u32              mNext; ///< Free list or firing list
+    };
+
+    static inline timer_handle_t sHandle(u32 index, u32 generation) { return ((u64)generation << 32) | index; }
+
+    timer_coalescer_t::timer_coalescer_t()
+        : mAllocator(nullptr)
+        , mNodes(nullptr)
+        , mFree(sNil)
+        , mCapacity(0)
+        , mTicksPerSecond(1)
+        , mWakeups(0)
+        , mFired(0)
+    {
+    }
+
+    timer_coalescer_t::~timer_coalescer_t() { exit(); }
+
+    bool timer_coalescer_t::init(alloc_t* allocator, u32 maxTimers)
+    {
+        ASSERTS(mAllocator == nullptr, "timer_coalescer_t is already initialized");
+
+        mNodes = (node_t*)allocator->allocate(sizeof(node_t) * maxTimers, sizeof(void*));
+        if (mNodes == nullptr)
+            return false;
+        if (!mEarliest.init(allocator, maxTimers) || !mLatest.init(allocator, maxTimers))
+        {
+            mEarliest.exit();
+            allocator->deallocate(mNodes);
+            mNodes = nullptr;
+            return false;
+        }
+
+        mAllocator = allocator;
+        mCapacity  = maxTimers;
+        for (u32 i = 0; i < maxTimers; ++i)
+        {
+            mNodes[i].mGeneration = 1;
+            mNodes[i].mState      = NodeFree;
+            mNodes[i].mNext       = (i + 1) < maxTimers ? (i + 1) : sNil;
+        }
+        mFree           = 0;
+        mTicksPerSecond = getTicksPerSecond();
+        resetStats();
+        return true;
+    }
+
+    void timer_coalescer_t::exit()
+    {
+        if (mAllocator != nullptr)
+        {
+            mEarliest.exit();
+            mLatest.exit();
+            mAllocator->deallocate(mNodes);
+        }
+        mAllocator = nullptr;
+        mNodes     = nullptr;
+        mFree      = sNil;
+        mCapacity  = 0;
+    }
+
+    timer_handle_t timer_coalescer_t::schedule(tick_t deadline, const timespan_t& slack, timer_callback_t callback, void* user)
+    {
+        ASSERTS(callback != nullptr, "timer callback is nullptr");
+        if (mFree == sNil)
+            return 0;
+
+        // The slack from 100 nanosecond ticks to getTime() ticks
+        s64 const seconds = (s64)(slack.ticks() / timespan_t::sTicksPerSecond);
+        s64 const rest    = (s64)(slack.ticks() % timespan_t::sTicksPerSecond);
+        s64 const window  = seconds * mTicksPerSecond + (rest * mTicksPerSecond) / (s64)timespan_t::sTicksPerSecond;
+
+        u32 const index = mFree;
+        node_t&   node  = mNodes[index];
+        mFree           = node.mNext;
+        node.mCallback  = callback;
+        node.mUser      = user;
+        node.mState     = NodeQueued;
+        node.mEarliest  = mEarliest.push(deadline, &node);
+        node.mLatest    = mLatest.push(deadline + window, &node);
+        return sHandle(index, node.mGeneration);
+    }
+
+    bool timer_coalescer_t::cancel(timer_handle_t handle)
+    {
+        u32 const index = nodeOf(handle);
+        if (index == sNil)
+            return false;
+
+        node_t& node = mNodes[index];
+        if (node.mState == NodeFiring)
+        {
+            // fire() holds it in its batch, it releases the node
+            node.mState = NodeCancelled;
+            return true;
+        }
+        mEarliest.cancel(node.mEarliest);
+        mLatest.cancel(node.mLatest);
+        release(index);
+        return true;
+    }
+
+    bool timer_coalescer_t::isScheduled(timer_handle_t handle) const { return nodeOf(handle) != sNil; }
+
+    bool timer_coalescer_t::nextWakeup(tick_t& wakeup) const
+    {
+        deadline_queue_t::entry_t entry;
+        if (!mLatest.peek(entry))
+            return false;
+        wakeup = entry.mDeadline;
+        return true;
+    }
+
+    u32 timer_coalescer_t::fire(tick_t now)
+    {
+        // Take every due timer out of the queues first, callbacks may schedule and cancel
+        u32                       first = sNil;
+        u32*                      link  = &first;
+        deadline_queue_t::entry_t batch[32];
+        u32                       n;
+        while ((n = mEarliest.popExpired(now, batch, 32)) > 0)
+        {
+            for (u32 i = 0; i < n; ++i)
+            {
+                node_t* node = (node_t*)batch[i].mPayload;
+                mLatest.cancel(node->mLatest);
+                node->mState = NodeFiring;
+                node->mNext  = sNil;
+                *link        = (u32)(node - mNodes);
+                link         = &node->mNext;
+            }
+        }
+
+        u32 fired = 0;
+        while (first != sNil)
+        {
+            u32 const              index     = first;
+            node_t&                node      = mNodes[index];
+            bool const             cancelled = node.mState == NodeCancelled;
+            timer_handle_t const   handle    = sHandle(index, node.mGeneration);
+            timer_callback_t const callback  = node.mCallback;
+            void* const            user      = node.mUser;
+            first                            = node.mNext;
+            release(index);
+            if (!cancelled)
+            {
+                callback(handle, user);
+                fired += 1;
+            }
+        }
+
+        if (fired > 0)
+        {
+            mWakeups += 1;
+            mFired += fired;
+        }
+        return fired;
+    }
+
+    void timer_coalescer_t::resetStats()
+    {
+        mWakeups = 0;
+        mFired   = 0;
+    }
+
+    u32 timer_coalescer_t::nodeOf(timer_handle_t handle) const
+    {
+        u32 const index = (u32)handle;
+        if (index >= mCapacity || mNodes[index].mGeneration != (u32)(handle >> 32))
+            return sNil;
+        u32 const state = mNodes[index].mState;
+        return (state == NodeQueued || state == NodeFiring) ? index : sNil;
+    }
+
+    void timer_coalescer_t::release(u32 index)
+    {
+        node_t& node = mNodes[index];
+        node.mGeneration += (node.mGeneration == 0xffffffff) ? 2 : 1; // skip 0, a handle is never 0
+        node.mState = NodeFree;
+        node.mNext  = mFree;
+        mFree       = index;
+    }
+
+}; // namespace ncore
@@ -0,0 +1,152 @@
+#include "ccore/c_target.h"
+#include "ccore/c_debug.h"
+
+#include "ctime/c_timer_event.h"
+#include "ctime/c_timer_wheel.h"
+#include "ctime/c_deadline_queue.h"
+#include "ctime/c_timer_coalescer.h"
+
+#ifdef TARGET_LINUX
+#    include <time.h>
+#    include <unistd.h>
+#    include <sys/timerfd.h>
+#endif
+
+namespace ncore
+{
+    namespace ntime
+    {
+        s32 pollTimeout(tick_t deadline, tick_t now)
+        {
+            if (deadline <= now)
+                return 0;
+            s64 const ticks          = deadline - now;
+            s64 const ticksPerSecond = getTicksPerSecond();
+            s64 const ms             = (ticks / ticksPerSecond) * 1000 + ((ticks % ticksPerSecond) * 1000 + ticksPerSecond - 1) / ticksPerSecond;
+            return (ms < 0x7fffffff) ? (s32)ms : 0x7fffffff;
+        }
+
+        s32 pollTimeout(const timer_wheel_t& wheel)
+        {
+            tick_t when;
+            return wheel.nextExpiry(when) ? pollTimeout(when, getTime()) : -1;
+        }
+
+        s32 pollTimeout(const deadline_queue_t& queue)
+        {
+            deadline_queue_t::entry_t entry;
+            return queue.peek(entry) ? pollTimeout(entry.mDeadline, getTime()) : -1;
+        }
+
+        s32 pollTimeout(const timer_coalescer_t& coalescer)
+        {
+            tick_t wakeup;
+            return coalescer.nextWakeup(wakeup) ? pollTimeout(wakeup, getTime()) : -1;
+        }
+    } // namespace ntime
+
+#ifdef TARGET_LINUX
+
+    static const s64 sNsPerSecond = 1000000000;
+
+    timer_fd_t::timer_fd_t()
+        : mFd(-1)
+        , mArmed(false)
+        , mDeadline(0)
+        , mOffsetNs(0)
+        , mSyscalls(0)
+    {
+    }
+
+    timer_fd_t::~timer_fd_t() { exit(); }
+
+    bool timer_fd_t::init()
+    {
+        ASSERTS(mFd < 0, "timer_fd_t is already initialized");
+        mFd = ::timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+        if (mFd < 0)
+            return false;
+
+        // Read the clock after getTime(), an error in the offset makes the timerfd late and not early
+        tick_t const now = getTime();
+        timespec     ts;
+        ::clock_gettime(CLOCK_MONOTONIC, &ts);
+        mOffsetNs = (s64)ts.tv_sec * sNsPerSecond + (s64)ts.tv_nsec - ntime::ticksToNs(now);
+        mArmed    = false;
+        mSyscalls = 0;
+        return true;
+    }
+
+    void timer_fd_t::exit()
+    {
+        if (mFd >= 0)
+            ::close(mFd);
+        mFd    = -1;
+        mArmed = false;
+    }
+
+    bool timer_fd_t::arm(tick_t deadline)
+    {
+        if (mArmed && mDeadline == deadline)
+            return true;
+        return settime(true, deadline);
+    }
+
+    bool timer_fd_t::disarm() { return mArmed ? settime(false, 0) : true; }
+
+    bool timer_fd_t::arm(const timer_wheel_t& wheel)
+    {
+        tick_t when;
+        return wheel.nextExpiry(when) ? arm(when) : disarm();
+    }
+
+    bool timer_fd_t::arm(const timer_coalescer_t& coalescer)
+    {
+        tick_t wakeup;
+        return coalescer.nextWakeup(wakeup) ? arm(wakeup) : disarm();
+    }
+
+    // Always sets the timerfd, that clears its expirations and so its readiness
+    u32 timer_fd_t::dispatch(timer_wheel_t& wheel)
+    {
+        u32 const  fired = wheel.advance(getTime());
+        tick_t     when  = 0;
+        bool const next  = wheel.nextExpiry(when);
+        settime(next, when);
+        return fired;
+    }
+
+    u32 timer_fd_t::dispatch(timer_coalescer_t& coalescer)
+    {
+        u32 const  fired  = coalescer.fire(getTime());
+        tick_t     wakeup = 0;
+        bool const next   = coalescer.nextWakeup(wakeup);
+        settime(next, wakeup);
+        return fired;
+    }
+
+    bool timer_fd_t::settime(bool armed, tick_t deadline)
+    {
+        ASSERTS(mFd >= 0, "timer_fd_t is not initialized");
+        itimerspec spec = {};
+        if (armed)
+        {
+            s64 const ns          = mOffsetNs + ntime::ticksToNs(deadline);
+            s64 const value       = (ns > 0) ? ns : 1; // 0 disarms
+            spec.it_value.tv_sec  = (time_t)(value / sNsPerSecond);
+            spec.it_value.tv_nsec = (long)(value % sNsPerSecond);
+        }
+        mSyscalls += 1;
+        if (::timerfd_settime(mFd, TFD_TIMER_ABSTIME, &spec, nullptr) != 0)
+        {
+            mArmed = false;
+            return false;
+        }
+        mArmed    = armed;
+        mDeadline = deadline;
+        return true;
+    }
+
+#endif // TARGET_LINUX
+
+}; // namespace ncore
@@ -0,0 +1,347 @@
+#include "ccore/c_allocator.h"
+#include "ccore/c_debug.h"
+
+#include "ctime/c_timer_service.h"
+
+#include <atomic>
+#include <new>
+
+namespace ncore
+{
+    static const u32 sNil      = 0xffffffff;
+    static const u32 sRingSize = 256; ///< Batches per worker, a power of 2
+
+    // The low half of a node state word, the high half is the generation of the node
+    enum ENodeState
+    {
+        NodeFree      = 0,
+        NodePending   = 1, ///< In the inbox, not in the wheel yet
+        NodeScheduled = 2, ///< In the wheel
+        NodeCancelled = 3, ///< In the inbox to be taken out of the wheel (or never put in)
+        NodeFiring    = 4, ///< Expired, in a batch
+    };
+
+    struct timer_service_t::node_t
+    {
+        tick_t           mDeadline;
+        timer_callback_t mCallback;
+        void*            mUser;
+        worker_t*        mOwner;
+        timer_handle_t   mWheelHandle; ///< Owner thread only, 0 until the node is in the wheel
+        u32              mIndex;
+        std::atomic<u32> mNext;  ///< Free list, inbox or batch
+        std::atomic<u64> mState; ///< Generation << 32 | ENodeState
+    };
+
+    // Members written by other threads are kept on cache lines of their own
+    struct timer_service_t::worker_t
+    {
+        timer_wheel_t     mWheel;
+        node_t*           mNodes;
+        std::atomic<u64>* mRing;
+        u32               mIndex;
+        u32               mBatchFirst; ///< The batch being filled by advance()
+        u32               mBatchCount;
+        u64               mFired;
+        u64               mBatches;
+        u64               mStolen;
+        u8                mPad0[64];
+        std::atomic<u64>  mFree; ///< Tag << 32 | first node, the tag prevents ABA
+        u8                mPad1[64 - sizeof(u64)];
+        std::atomic<u32>  mInbox;
+        u8                mPad2[64 - sizeof(u32)];
+        std::atomic<u64>  mHead; ///< Next batch to take, any thread
+        u8                mPad3[64 - sizeof(u64)];
+        std::atomic<u64>  mTail; ///< Next batch to publish, owner thread
+        u8                mPad4[64 - sizeof(u64)];
+    };
+
+    static inline timer_handle_t sHandle(u32 worker, u32 index, u64 state) { return (state & D_CONSTANT_U64(0xffffffff00000000)) | ((u64)worker << 24) | index; }
+    static inline u64            sState(u64 state, u32 value) { return (state & D_CONSTANT_U64(0xffffffff00000000)) | value; }
+
+    timer_service_t::timer_service_t()
+        : mAllocator(nullptr)
+        , mWorkers(nullptr)
+        , mNumWorkers(0)
+    {
+    }
+
+    timer_service_t::~timer_service_t() { exit(); }
+
+    bool timer_service_t::init(alloc_t* allocator, s32 numWorkers, u32 timersPerWorker, tick_t resolution, tick_t now)
+    {
+        ASSERTS(mAllocator == nullptr, "timer_service_t is already initialized");
+        ASSERTS(numWorkers > 0 && numWorkers <= MaxWorkers, "invalid number of workers");
+        ASSERTS(timersPerWorker > 0 && timersPerWorker <= MaxTimersPerWorker, "invalid number of timers per worker");
+
+        mWorkers = (worker_t*)allocator->allocate(sizeof(worker_t) * numWorkers, 64);
+        if (mWorkers == nullptr)
+            return false;
+        mAllocator  = allocator;
+        mNumWorkers = 0;
+        for (s32 w = 0; w < numWorkers; ++w)
+        {
+            worker_t* worker = new (&mWorkers[w]) worker_t();
+            mNumWorkers += 1;
+            worker->mNodes = (node_t*)allocator->allocate(sizeof(node_t) * timersPerWorker, sizeof(void*));
+            worker->mRing  = (std::atomic<u64>*)allocator->allocate(sizeof(std::atomic<u64>) * sRingSize, 64);
+            if (worker->mNodes == nullptr || worker->mRing == nullptr || !worker->mWheel.init(allocator, timersPerWorker, resolution, now))
+            {
+                exit();
+                return false;
+            }
+
+            for (u32 i = 0; i < timersPerWorker; ++i)
+            {
+                node_t* node = new (&worker->mNodes[i]) node_t();
+                node->mOwner = worker;
+                node->mIndex = i;
+                node->mNext.store((i + 1) < timersPerWorker ? (i + 1) : sNil, std::memory_order_relaxed);
+                node->mState.store(((u64)1 << 32) | NodeFree, std::memory_order_relaxed);
+            }
+            for (u32 i = 0; i < sRingSize; ++i)
+                new (&worker->mRing[i]) std::atomic<u64>(0);
+
+            worker->mIndex      = (u32)w;
+            worker->mBatchFirst = sNil;
+            worker->mBatchCount = 0;
+            worker->mFired      = 0;
+            worker->mBatches    = 0;
+            worker->mStolen     = 0;
+            worker->mFree.store(0, std::memory_order_relaxed);
+            worker->mInbox.store(sNil, std::memory_order_relaxed);
+            worker->mHead.store(0, std::memory_order_relaxed);
+            worker->mTail.store(0, std::memory_order_relaxed);
+        }
+        std::atomic_thread_fence(std::memory_order_release);
+        return true;
+    }
+
+    void timer_service_t::exit()
+    {
+        for (s32 w = 0; w < mNumWorkers; ++w)
+        {
+            worker_t& worker = mWorkers[w];
+            worker.mWheel.exit();
+            if (worker.mNodes != nullptr)
+                mAllocator->deallocate(worker.mNodes);
+            if (worker.mRing != nullptr)
+                mAllocator->deallocate(worker.mRing);
+            worker.~worker_t();
+        }
+        if (mWorkers != nullptr)
+            mAllocator->deallocate(mWorkers);
+        mAllocator  = nullptr;
+        mWorkers    = nullptr;
+        mNumWorkers = 0;
+    }
+
+    timer_handle_t timer_service_t::schedule(s32 w, tick_t deadline, timer_callback_t callback, void* user)
+    {
+        ASSERTS(w >= 0 && w < mNumWorkers, "invalid worker");
+        ASSERTS(callback != nullptr, "timer callback is nullptr");
+        worker_t& worker = mWorkers[w];
+
+        // Pop a node from the lock-free free list
+        u64 head = worker.mFree.load(std::memory_order_acquire);
+        u32 index;
+        for (;;)
+        {
+            index = (u32)head;
+            if (index == sNil)
+                return 0;
+            u64 const next = (((head >> 32) + 1) << 32) | worker.mNodes[index].mNext.load(std::memory_order_relaxed);
+            if (worker.mFree.compare_exchange_weak(head, next, std::memory_order_acquire, std::memory_order_acquire))
+                break;
+        }
+
+        node_t& node      = worker.mNodes[index];
+        node.mDeadline    = deadline;
+        node.mCallback    = callback;
+        node.mUser        = user;
+        node.mWheelHandle = 0;
+        u64 const state   = sState(node.mState.load(std::memory_order_relaxed), NodePending);
+        node.mState.store(state, std::memory_order_relaxed);
+
+        // Publish to the owner
+        u32 inbox = worker.mInbox.load(std::memory_order_relaxed);
+        do
+        {
+            node.mNext.store(inbox, std::memory_order_relaxed);
+        } while (!worker.mInbox.compare_exchange_weak(inbox, index, std::memory_order_release, std::memory_order_relaxed));
+
+        return sHandle((u32)w, index, state);
+    }
+
+    bool timer_service_t::cancel(timer_handle_t handle)
+    {
+        u32 const w     = ((u32)handle >> 24) & 0xff;
+        u32 const index = (u32)handle & 0xffffff;
+        if ((s32)w >= mNumWorkers)
+            return false;
+        worker_t& worker = mWorkers[w];
+        if (index >= worker.mWheel.capacity())
+            return false;
+        node_t& node = worker.mNodes[index];
+
+        // Not in the wheel yet, the owner drops it when it drains the inbox
+        u64 expected = sState(handle, NodePending);
+        if (node.mState.compare_exchange_strong(expected, sState(handle, NodeCancelled), std::memory_order_acq_rel))
+            return true;
+
+        // In the wheel, the owner has to take it out
+        expected = sState(handle, NodeScheduled);
+        if (!node.mState.compare_exchange_strong(expected, sState(handle, NodeCancelled), std::memory_order_acq_rel))
+            return false;
+        u32 inbox = worker.mInbox.load(std::memory_order_relaxed);
+        do
+        {
+            node.mNext.store(inbox, std::memory_order_relaxed);
+        } while (!worker.mInbox.compare_exchange_weak(inbox, index, std::memory_order_release, std::memory_order_relaxed));
+        return true;
+    }
+
+    u32 timer_service_t::poll(s32 w, tick_t now)
+    {
+        ASSERTS(w >= 0 && w < mNumWorkers, "invalid worker");
+        worker_t& worker = mWorkers[w];
+
+        sDrainInbox(worker);
+        worker.mWheel.advance(now);
+        if (worker.mBatchCount > 0)
+            sPublishBatch(worker);
+
+        u32 ran = sTakeBatches(worker, worker, false);
+        for (s32 i = 1; ran == 0 && i < mNumWorkers; ++i)
+            ran += sTakeBatches(worker, mWorkers[(w + i) % mNumWorkers], true);
+        return ran;
+    }
+
+    void timer_service_t::getStats(s32 w, u64& fired, u64& batches, u64& stolen) const
+    {
+        ASSERTS(w >= 0 && w < mNumWorkers, "invalid worker");
+        fired   = mWorkers[w].mFired;
+        batches = mWorkers[w].mBatches;
+        stolen  = mWorkers[w].mStolen;
+    }
+
+    void timer_service_t::sDrainInbox(worker_t& worker)
+    {
+        u32 index = worker.mInbox.exchange(sNil, std::memory_order_acquire);
+        while (index != sNil)
+        {
+            node_t&   node  = worker.mNodes[index];
+            u32 const next  = node.mNext.load(std::memory_order_relaxed);
+            u64       state = node.mState.load(std::memory_order_acquire);
+            if ((u32)state == NodePending)
+            {
+                node.mWheelHandle = worker.mWheel.schedule(node.mDeadline, sOnExpired, &node);
+                if (!node.mState.compare_exchange_strong(state, sState(state, NodeScheduled), std::memory_order_acq_rel))
+                {
+                    // Cancelled in the meantime
+                    worker.mWheel.cancel(node.mWheelHandle);
+                    sRelease(worker, node);
+                }
+            }
+            else if ((u32)state == NodeCancelled)
+            {
+                if (node.mWheelHandle != 0)
+                    worker.mWheel.cancel(node.mWheelHandle); // stale when it expired in the meantime
+                sRelease(worker, node);
+            }
+            index = next;
+        }
+    }
+
+    // Called by the wheel of the owner, adds the node to the batch being filled
+    void timer_service_t::sOnExpired(timer_handle_t /*handle*/, void* user)
+    {
+        node_t&   node     = *(node_t*)user;
+        worker_t& worker   = *node.mOwner;
+        u64       expected = sState(node.mState.load(std::memory_order_relaxed), NodeScheduled);
+        if (!node.mState.compare_exchange_strong(expected, sState(expected, NodeFiring), std::memory_order_acq_rel))
+            return; // cancelled, the node waits in the inbox
+
+        node.mNext.store(worker.mBatchFirst, std::memory_order_relaxed);
+        worker.mBatchFirst = node.mIndex;
+        worker.mBatchCount += 1;
+        if (worker.mBatchCount == BatchSize)
+            sPublishBatch(worker);
+    }
+
+    // Owner thread, a batch is the first node of a list and the number of nodes
+    void timer_service_t::sPublishBatch(worker_t& worker)
+    {
+        u64 const batch = ((u64)worker.mBatchCount << 32) | worker.mBatchFirst;
+        worker.mBatchFirst = sNil;
+        worker.mBatchCount = 0;
+
+        u64 const tail = worker.mTail.load(std::memory_order_relaxed);
+        if ((tail - worker.mHead.load(std::memory_order_acquire)) >= sRingSize)
+        {
+            // Ring full, run it here
+            worker.mBatches += 1;
+            worker.mFired += sRunBatch(worker, batch);
+            return;
+        }
+        worker.mRing[tail & (sRingSize - 1)].store(batch, std::memory_order_relaxed);
+        worker.mTail.store(tail + 1, std::memory_order_release);
+    }
+
+    // Takes batches from the ring of 'victim' (the worker itself when not stealing) until it is empty
+    u32 timer_service_t::sTakeBatches(worker_t& worker, worker_t& victim, bool steal)
+    {
+        u32 ran = 0;
+        for (;;)
+        {
+            u64 head = victim.mHead.load(std::memory_order_acquire);
+            if (head >= victim.mTail.load(std::memory_order_acquire))
+                break;
+            u64 const batch = victim.mRing[head & (sRingSize - 1)].load(std::memory_order_relaxed);
+            if (!victim.mHead.compare_exchange_strong(head, head + 1, std::memory_order_acq_rel))
+                continue;
+            ran += sRunBatch(victim, batch);
+            worker.mBatches += 1;
+            worker.mStolen += steal ? 1 : 0;
+        }
+        worker.mFired += ran;
+        return ran;
+    }
+
+    // Any thread, runs the callbacks of a batch of nodes of 'owner' and frees the nodes
+    u32 timer_service_t::sRunBatch(worker_t& owner, u64 batch)
+    {
+        u32 index = (u32)batch;
+        u32 count = (u32)(batch >> 32);
+        for (u32 i = 0; i < count; ++i)
+        {
+            node_t&                node     = owner.mNodes[index];
+            u32 const              next     = node.mNext.load(std::memory_order_relaxed);
+            timer_handle_t const   handle   = sHandle(owner.mIndex, index, node.mState.load(std::memory_order_relaxed));
+            timer_callback_t const callback = node.mCallback;
+            void* const            user     = node.mUser;
+            sRelease(owner, node);
+            callback(handle, user);
+            index = next;
+        }
+        return count;
+    }
+
+    // Any thread, bumps the generation (stale handles) and pushes the node on the free list
+    void timer_service_t::sRelease(worker_t& owner, node_t& node)
+    {
+        u64 const state = node.mState.load(std::memory_order_relaxed);
+        u32       gen   = (u32)(state >> 32) + 1;
+        gen += (gen == 0) ? 1 : 0; // a handle is never 0
+        node.mState.store(((u64)gen << 32) | NodeFree, std::memory_order_release);
+
+        u64 head = owner.mFree.load(std::memory_order_relaxed);
+        u64 next;
+        do
+        {
+            node.mNext.store((u32)head, std::memory_order_relaxed);
+            next = (((head >> 32) + 1) << 32) | node.mIndex;
+        } while (!owner.mFree.compare_exchange_weak(head, next, std::memory_order_release, std::memory_order_relaxed));
+    }
+
+}; // namespace ncore
@@ -0,0 +1,315 @@
+#include "ccore/c_allocator.h"
+#include "ccore/c_debug.h"
+
+#include "ctime/c_timer_wheel.h"
+
+#include "ctime/private/c_bits.h"
+
+namespace ncore
+{
+    static const u32 sNil         = 0xffffffff;
+    static const s32 sLevels      = 4;
+    static const s32 sSlotBits    = 8;
+    static const u32 sSlots       = 1 << sSlotBits;
+    static const u32 sSlotMask    = sSlots - 1;
+    static const u32 sFiringList  = sLevels * sSlots; ///< Timers collected by advance() that did not fire yet
+    static const s64 sMaxDistance = D_CONSTANT_S64(1) << (sLevels * sSlotBits);
+
+    struct timer_wheel_t::node_t
+    {
+        tick_t           mDeadline;
+        timer_callback_t mCallback;
+        void*            mUser;
+        u32              mNext;
+        u32              mPrev;
+        u32              mList; ///< sNil when the node is free
+        u32              mGeneration;
+    };
+
+    static inline timer_handle_t sHandle(u32 index, u32 generation) { return ((u64)generation << 32) | index; }
+
+    timer_wheel_t::timer_wheel_t()
+        : mAllocator(nullptr)
+        , mNodes(nullptr)
+        , mHeads(nullptr)
+        , mFree(sNil)
+        , mCapacity(0)
+        , mCount(0)
+        , mResolution(1)
+        , mCurrent(0)
+    {
+        for (s32 i = 0; i < 4; ++i)
+            mOccupied[i] = 0;
+    }
+
+    timer_wheel_t::~timer_wheel_t() { exit(); }
+
+    bool timer_wheel_t::init(alloc_t* allocator, u32 maxTimers, tick_t resolution, tick_t now)
+    {
+        ASSERTS(mNodes == nullptr, "timer_wheel_t is already initialized");
+        ASSERTS(resolution > 0 && maxTimers > 0 && maxTimers < sNil, "invalid timer_wheel_t configuration");
+
+        mNodes = (node_t*)allocator->allocate(sizeof(node_t) * maxTimers, sizeof(void*));
+        mHeads = (u32*)allocator->allocate(sizeof(u32) * (sFiringList + 1), sizeof(u32));
+        if (mNodes == nullptr || mHeads == nullptr)
+        {
+            if (mNodes != nullptr)
+                allocator->deallocate(mNodes);
+            if (mHeads != nullptr)
+                allocator->deallocate(mHeads);
+            mNodes = nullptr;
+            mHeads = nullptr;
+            return false;
+        }
+
+        mAllocator  = allocator;
+        mCapacity   = maxTimers;
+        mCount      = 0;
+        mResolution = resolution;
+        for (u32 i = 0; i < maxTimers; ++i)
+        {
+            mNodes[i].mNext       = (i + 1) < maxTimers ? (i + 1) : sNil;
+            mNodes[i].mList       = sNil;
+            mNodes[i].mGeneration = 1;
+        }
+        mFree = 0;
+        for (u32 i = 0; i <= sFiringList; ++i)
+            mHeads[i] = sNil;
+        for (s32 i = 0; i < 4; ++i)
+            mOccupied[i] = 0;
+
+        // Slot of 'now' rounded down, the first advance() expires it
+        mCurrent = now / resolution;
+        mCurrent -= (mCurrent * resolution > now) ? 1 : 0;
+        return true;
+    }
+
+    void timer_wheel_t::exit()
+    {
+        if (mAllocator != nullptr)
+        {
+            mAllocator->deallocate(mNodes);
+            mAllocator->deallocate(mHeads);
+        }
+        mAllocator = nullptr;
+        mNodes     = nullptr;
+        mHeads     = nullptr;
+        mFree      = sNil;
+        mCapacity  = 0;
+        mCount     = 0;
+    }
+
+    timer_handle_t timer_wheel_t::schedule(tick_t deadline, timer_callback_t callback, void* user)
+    {
+        ASSERTS(callback != nullptr, "timer callback is nullptr");
+        if (mFree == sNil)
+            return 0;
+
+        u32 const index = mFree;
+        node_t&   node  = mNodes[index];
+        mFree           = node.mNext;
+        node.mDeadline  = deadline;
+        node.mCallback  = callback;
+        node.mUser      = user;
+        insert(index);
+        mCount += 1;
+        return sHandle(index, node.mGeneration);
+    }
+
+    bool timer_wheel_t::cancel(timer_handle_t handle)
+    {
+        u32 const index = nodeOf(handle);
+        if (index == sNil)
+            return false;
+
+        unlink(index);
+        node_t& node = mNodes[index];
+        node.mList   = sNil;
+        node.mGeneration += (node.mGeneration == 0xffffffff) ? 2 : 1; // skip 0, a handle is never 0
+        node.mNext = mFree;
+        mFree      = index;
+        mCount -= 1;
+        return true;
+    }
+
+    bool timer_wheel_t::reschedule(timer_handle_t handle, tick_t deadline)
+    {
+        u32 const index = nodeOf(handle);
+        if (index == sNil)
+            return false;
+
+        unlink(index);
+        mNodes[index].mDeadline = deadline;
+        insert(index);
+        return true;
+    }
+
+    bool timer_wheel_t::isScheduled(timer_handle_t handle) const { return nodeOf(handle) != sNil; }
+
+    bool timer_wheel_t::getDeadline(timer_handle_t handle, tick_t& deadline) const
+    {
+        u32 const index = nodeOf(handle);
+        if (index == sNil)
+            return false;
+        deadline = mNodes[index].mDeadline;
+        return true;
+    }
+
+    u32 timer_wheel_t::advance(tick_t now)
+    {
+        s64 target = now / mResolution;
+        target -= (target * mResolution > now) ? 1 : 0;
+
+        // Collect, moving the expired slots to the firing list
+        while (mCurrent <= target)
+        {
+            if (mCount == 0)
+            {
+                mCurrent = target + 1;
+                break;
+            }
+
+            u32 const slot = (u32)(mCurrent & sSlotMask);
+            if (slot == 0)
+            {
+                for (s32 level = 1; level < sLevels; ++level)
+                {
+                    cascade(level);
+                    if (((mCurrent >> (level * sSlotBits)) & sSlotMask) != 0)
+                        break;
+                }
+            }
+            else if ((mOccupied[slot >> 6] & ((u64)1 << (slot & 63))) == 0)
+            {
+                // Skip to the next occupied slot of the lowest level or its wrap around
+                s64 const jump = mCurrent - slot + nextOccupied(slot);
+                mCurrent       = (jump <= target) ? jump : (target + 1);
+                continue;
+            }
+
+            u32 index = mHeads[slot];
+            while (index != sNil)
+            {
+                u32 const next = mNodes[index].mNext;
+                unlink(index);
+                append(sFiringList, index);
+                index = next;
+            }
+            mCurrent += 1;
+        }
+
+        // Fire, a callback may change the firing list so always take its head
+        u32 fired = 0;
+        while (mHeads[sFiringList] != sNil)
+        {
+            u32 const            index    = mHeads[sFiringList];
+            node_t&              node     = mNodes[index];
+            timer_handle_t const handle   = sHandle(index, node.mGeneration);
+            timer_callback_t     callback = node.mCallback;
+            void*                user     = node.mUser;
+            cancel(handle);
+            callback(handle, user);
+            fired += 1;
+        }
+        return fired;
+    }
+
+    // The first occupied slot of the lowest level up to its wrap around, else the wrap around itself
+    // where the next cascade happens (which may not fire anything).
+    bool timer_wheel_t::nextExpiry(tick_t& when) const
+    {
+        if (mCount == 0)
+            return false;
+
+        u32 const slot = (u32)(mCurrent & sSlotMask);
+        when           = (mCurrent - slot + nextOccupied(slot)) * mResolution;
+        return true;
+    }
+
+    // The first occupied slot of the lowest level at or after 'slot', sSlots when there is none
+    u32 timer_wheel_t::nextOccupied(u32 slot) const
+    {
+        for (u32 w = slot >> 6; w < 4; ++w)
+        {
+            u64 const bits = mOccupied[w] & ((w == (slot >> 6)) ? (~(u64)0 << (slot & 63)) : ~(u64)0);
+            if (bits != 0)
+                return (w << 6) + (u32)nbits::lowestBit(bits);
+        }
+        return sSlots;
+    }
+
+    // Places a node in the slot of its deadline on the lowest level that reaches it
+    void timer_wheel_t::insert(u32 index)
+    {
+        tick_t const deadline = mNodes[index].mDeadline;
+        s64          expires  = deadline / mResolution;
+        expires += (expires * mResolution < deadline) ? 1 : 0;
+        expires = (expires < mCurrent) ? mCurrent : expires;
+
+        s64 const distance = expires - mCurrent;
+        s32       level    = 0;
+        if (distance >= sMaxDistance)
+        {
+            level   = sLevels - 1;
+            expires = mCurrent + sMaxDistance - 1; // cascades back down to re-insert
+        }
+        else
+        {
+            while (distance >= ((s64)1 << ((level + 1) * sSlotBits)))
+                level += 1;
+        }
+        append((u32)level * sSlots + (u32)((expires >> (level * sSlotBits)) & sSlotMask), index);
+    }
+
+    void timer_wheel_t::unlink(u32 index)
+    {
+        node_t& node = mNodes[index];
+        if (node.mPrev != sNil)
+            mNodes[node.mPrev].mNext = node.mNext;
+        else
+            mHeads[node.mList] = node.mNext;
+        if (node.mNext != sNil)
+            mNodes[node.mNext].mPrev = node.mPrev;
+
+        if (node.mList < sSlots && mHeads[node.mList] == sNil)
+            mOccupied[node.mList >> 6] &= ~((u64)1 << (node.mList & 63));
+    }
+
+    void timer_wheel_t::append(u32 list, u32 index)
+    {
+        // Pushed at the front, firing order within a slot is not defined
+        node_t& node = mNodes[index];
+        node.mList   = list;
+        node.mPrev   = sNil;
+        node.mNext   = mHeads[list];
+        if (node.mNext != sNil)
+            mNodes[node.mNext].mPrev = index;
+        mHeads[list] = index;
+
+        if (list < sSlots)
+            mOccupied[list >> 6] |= (u64)1 << (list & 63);
+    }
+
+    // Spreads the current slot of 'level' over the levels below
+    void timer_wheel_t::cascade(s32 level)
+    {
+        u32 const list  = (u32)level * sSlots + (u32)((mCurrent >> (level * sSlotBits)) & sSlotMask);
+        u32       index = mHeads[list];
+        mHeads[list]    = sNil;
+        while (index != sNil)
+        {
+            u32 const next = mNodes[index].mNext;
+            insert(index);
+            index = next;
+        }
+    }
+
+    u32 timer_wheel_t::nodeOf(timer_handle_t handle) const
+    {
+        u32 const index = (u32)handle;
+        if (index >= mCapacity || mNodes[index].mList == sNil || mNodes[index].mGeneration != (u32)(handle >> 32))
+            return sNil;
+        return index;
+    }
+
+}; // namespace ncore
@@ -0,0 +1,299 @@
+#include "ccore/c_debug.h"
+
+#include "ctime/c_datetime.h"
+#include "ctime/c_timescale.h"
+
+#include "ctime/private/c_calendar.h"
+#include "ctime/private/c_file_mapping.h"
+
+#include <atomic>
+
+namespace ncore
+{
+    using namespace ncalendar;
+
+    // Seconds from 1900-01-01 (the NTP era 0 epoch used by leap-seconds.list) to 1970-01-01
+    static const s64 sNtpToUnixSeconds = D_CONSTANT_S64(2208988800);
+
+    // GPS time was TAI - 19s at its epoch (1980-01-06) and has no leap seconds
+    static const s64 sGpsMinusTaiTicks = -19 * TicksPerSecond;
+
+    // IERS Bulletin C, NTP seconds at which TAI - UTC takes the value, the list expires 2026-06-28
+    static const s64 sBuiltinExpiry = D_CONSTANT_S64(3991593600);
+    static const u32 sBuiltinTable[][2] = {
+      {2272060800u, 10}, {2287785600u, 11}, {2303683200u, 12}, {2335219200u, 13}, {2366755200u, 14}, {2398291200u, 15}, {2429913600u, 16},
+      {2461449600u, 17}, {2492985600u, 18}, {2524521600u, 19}, {2571782400u, 20}, {2603318400u, 21}, {2634854400u, 22}, {2698012800u, 23},
+      {2776982400u, 24}, {2840140800u, 25}, {2871676800u, 26}, {2918937600u, 27}, {2950473600u, 28}, {2982009600u, 29}, {3029443200u, 30},
+      {3076704000u, 31}, {3124137600u, 32}, {3345062400u, 33}, {3439756800u, 34}, {3550089600u, 35}, {3644697600u, 36}, {3692217600u, 37},
+    };
+
+    static inline s64 sNtpToTicks(s64 ntp) { return (ntp - sNtpToUnixSeconds) * TicksPerSecond + EpochTicks; }
+
+    static inline datetime_t sClampTicks(s64 ticks) { return datetime_t((u64)(ticks < 0 ? 0 : (ticks > MaxTicks ? MaxTicks : ticks))); }
+
+    // ------------------------------------------------------------------------------------------
+    // The table holds, per leap second, the UTC instant from which TAI - UTC has a new value and
+    // the TAI instant from which that value converts back. The TAI instant is the start of an
+    // inserted leap second, so the leap second itself converts to a second 23:59:59.
+
+    struct leapsecond_table_t
+    {
+        enum
+        {
+            MaxEntries = 64,
+        };
+
+        s32 mCount;
+        s64 mExpires;            ///< UTC ticks, 0 when unknown
+        s64 mUtc[MaxEntries];    ///< UTC ticks at which mOffset[i] starts
+        s64 mTai[MaxEntries];    ///< TAI ticks at which mOffset[i] starts to apply to TAI to UTC
+        s32 mOffset[MaxEntries]; ///< TAI - UTC in seconds
+
+        bool add(s64 ntp, s32 offset)
+        {
+            if (mCount == MaxEntries || offset < 0 || offset > 1000)
+                return false;
+            s64 const utc = sNtpToTicks(ntp);
+            if (mCount > 0 && utc <= mUtc[mCount - 1])
+                return false;
+            s32 const prev  = (mCount > 0) ? mOffset[mCount - 1] : offset;
+            mUtc[mCount]    = utc;
+            mTai[mCount]    = utc + (s64)(prev < offset ? prev : offset) * TicksPerSecond;
+            mOffset[mCount] = offset;
+            mCount += 1;
+            return true;
+        }
+
+        // Index of the period that holds 'ticks' in the (UTC or TAI) keys, the first period
+        // also covers everything before it.
+        static s32 sFind(const s64* keys, s32 count, s64 ticks)
+        {
+            s32 lo = 1;
+            s32 hi = count;
+            while (lo < hi)
+            {
+                s32 const mid = (lo + hi) >> 1;
+                if (keys[mid] <= ticks)
+                    lo = mid + 1;
+                else
+                    hi = mid;
+            }
+            return lo - 1;
+        }
+    };
+
+    // The compiled-in table, and two buffers for loaded tables so that a load never writes the
+    // table that is active.
+    static leapsecond_table_t                      sTables[3];
+    static std::atomic<const leapsecond_table_t*> sActive(nullptr);
+    static std::atomic<u32>                        sGeneration(1);
+    static s32                                     sNextLoad = 1;
+
+    static const leapsecond_table_t* sGetTable()
+    {
+        const leapsecond_table_t* table = sActive.load(std::memory_order_acquire);
+        if (table != nullptr)
+            return table;
+
+        static bool const sBuilt = []() {
+            leapsecond_table_t& builtin = sTables[0];
+            builtin.mCount              = 0;
+            for (u32 i = 0; i < sizeof(sBuiltinTable) / sizeof(sBuiltinTable[0]); ++i)
+                builtin.add((s64)sBuiltinTable[i][0], (s32)sBuiltinTable[i][1]);
+            builtin.mExpires = sNtpToTicks(sBuiltinExpiry);
+            return true;
+        }();
+        (void)sBuilt;
+
+        const leapsecond_table_t* expected = nullptr;
+        sActive.compare_exchange_strong(expected, &sTables[0], std::memory_order_acq_rel);
+        return sActive.load(std::memory_order_acquire);
+    }
+
+    // ------------------------------------------------------------------------------------------
+    // Per-thread cache of the period [start, end) with a constant TAI - UTC, one for each
+    // direction. A hit costs a generation check and two compares.
+
+    // Bound of the first and last period, beyond any tick value but far from overflowing
+    static const s64 sUnbounded = D_CONSTANT_S64(0x4000000000000000);
+
+    struct leapsecond_period_t
+    {
+        u32 mGeneration;
+        s64 mStart;
+        s64 mEnd;
+        s64 mOffset; ///< TAI - UTC in ticks
+    };
+
+    struct leapsecond_cache_t
+    {
+        leapsecond_period_t mUtc;
+        leapsecond_period_t mTai;
+        u64                 mHits;
+        u64                 mMisses;
+    };
+
+    static thread_local leapsecond_cache_t tLeapCache = {};
+
+    static void sLookup(leapsecond_period_t& period, bool fromTai, s64 ticks)
+    {
+        u32 const                 generation = sGeneration.load(std::memory_order_acquire);
+        const leapsecond_table_t* table      = sGetTable();
+        const s64*                keys       = fromTai ? table->mTai : table->mUtc;
+        s32 const                 i          = leapsecond_table_t::sFind(keys, table->mCount, ticks);
+        period.mGeneration                   = generation;
+        period.mStart                        = (i == 0) ? -sUnbounded : keys[i];
+        period.mEnd                          = ((i + 1) < table->mCount) ? keys[i + 1] : sUnbounded;
+        period.mOffset                       = (s64)table->mOffset[i] * TicksPerSecond;
+    }
+
+    static inline s64 sOffsetOf(leapsecond_period_t& period, bool fromTai, s64 ticks)
+    {
+        if (period.mGeneration == sGeneration.load(std::memory_order_relaxed) && ticks >= period.mStart && ticks < period.mEnd)
+        {
+            tLeapCache.mHits += 1;
+            return period.mOffset;
+        }
+        tLeapCache.mMisses += 1;
+        sLookup(period, fromTai, ticks);
+        return period.mOffset;
+    }
+
+    static const u64 sTicksMask = D_CONSTANT_U64(0x3fffffffffffffff);
+
+    // Converts runs of elements that share a period with a single add, 'bias' is added on top
+    // of the leap second offset (sign included) to get to GPS.
+    static void sConvert(const datetime_t* in, datetime_t* out, s64 count, bool fromTai, s64 bias)
+    {
+        static_assert(sizeof(datetime_t) == sizeof(u64), "datetime_t must be a plain 64-bit value");
+        const u64*           src    = reinterpret_cast<const u64*>(in);
+        u64*                 dst    = reinterpret_cast<u64*>(out);
+        leapsecond_period_t& period = fromTai ? tLeapCache.mTai : tLeapCache.mUtc;
+        s64                  i      = 0;
+        while (i < count)
+        {
+            s64 const t      = (s64)(src[i] & sTicksMask) - (fromTai ? bias : 0);
+            s64 const offset = sOffsetOf(period, fromTai, t);
+            s64 const delta  = fromTai ? (-offset - bias) : (offset + bias);
+            s64 const start  = period.mStart + (fromTai ? bias : 0);
+            s64 const end    = period.mEnd + (fromTai ? bias : 0);
+            s64       j      = i + 1;
+            while (j < count && (s64)(src[j] & sTicksMask) >= start && (s64)(src[j] & sTicksMask) < end)
+                j++;
+            tLeapCache.mHits += (u64)(j - i - 1);
+            for (s64 k = i; k < j; ++k)
+            {
+                s64 v  = (s64)(src[k] & sTicksMask) + delta;
+                v      = v < 0 ? 0 : v;
+                v      = v > MaxTicks ? MaxTicks : v;
+                dst[k] = (u64)v;
+            }
+            i = j;
+        }
+    }
+
+    namespace ntime
+    {
+        s32 taiMinusUtc(datetime_t utc) { return (s32)(sOffsetOf(tLeapCache.mUtc, false, (s64)utc.ticks()) / TicksPerSecond); }
+
+        datetime_t utcToTai(datetime_t utc) { return sClampTicks((s64)utc.ticks() + sOffsetOf(tLeapCache.mUtc, false, (s64)utc.ticks())); }
+        datetime_t taiToUtc(datetime_t tai) { return sClampTicks((s64)tai.ticks() - sOffsetOf(tLeapCache.mTai, true, (s64)tai.ticks())); }
+        datetime_t utcToGps(datetime_t utc) { return sClampTicks((s64)utcToTai(utc).ticks() + sGpsMinusTaiTicks); }
+        datetime_t gpsToUtc(datetime_t gps) { return taiToUtc(gpsToTai(gps)); }
+        datetime_t taiToGps(datetime_t tai) { return sClampTicks((s64)tai.ticks() + sGpsMinusTaiTicks); }
+        datetime_t gpsToTai(datetime_t gps) { return sClampTicks((s64)gps.ticks() - sGpsMinusTaiTicks); }
+
+        void utcToTai(const datetime_t* in, datetime_t* out, s64 count) { sConvert(in, out, count, false, 0); }
+        void taiToUtc(const datetime_t* in, datetime_t* out, s64 count) { sConvert(in, out, count, true, 0); }
+        void utcToGps(const datetime_t* in, datetime_t* out, s64 count) { sConvert(in, out, count, false, sGpsMinusTaiTicks); }
+        void gpsToUtc(const datetime_t* in, datetime_t* out, s64 count) { sConvert(in, out, count, true, sGpsMinusTaiTicks); }
+
+        static bool sIsSpace(char c) { return c == ' ' || c == '\t' || c == '\r'; }
+
+        static bool sParseNumber(const char*& p, const char* end, s64& value)
+        {
+            while (p < end && sIsSpace(*p))
+                p++;
+            if (p == end || *p < '0' || *p > '9')
+                return false;
+            value = 0;
+            while (p < end && *p >= '0' && *p <= '9' && value < D_CONSTANT_S64(100000000000))
+                value = value * 10 + (*p++ - '0');
+            return true;
+        }
+
+        /**
+         *  Summary:
+         *      Loads the content of a leap-seconds.list file: lines of 'NTP seconds' and
+         *      'TAI - UTC', comments start with '#' and the '#@' line holds the expiry date.
+         *
+         *  Returns:
+         *      False when the text holds no entries or entries that are out of order.
+         */
+        bool loadLeapSeconds(const char* text, s64 length)
+        {
+            leapsecond_table_t& table = sTables[sNextLoad];
+            table.mCount              = 0;
+            table.mExpires            = 0;
+
+            const char*       p   = text;
+            const char* const end = text + length;
+            while (p < end)
+            {
+                const char* eol = p;
+                while (eol < end && *eol != '\n')
+                    eol++;
+
+                s64 ntp, offset;
+                if (*p == '#')
+                {
+                    const char* q = p + 2;
+                    if ((p + 1) < eol && p[1] == '@' && sParseNumber(q, eol, ntp))
+                        table.mExpires = sNtpToTicks(ntp);
+                }
+                else if (sParseNumber(p, eol, ntp))
+                {
+                    if (!sParseNumber(p, eol, offset) || !table.add(ntp, (s32)offset))
+                        return false;
+                }
+                p = eol + 1;
+            }
+            if (table.mCount == 0)
+                return false;
+
+            sGetTable();
+            sActive.store(&table, std::memory_order_release);
+            sGeneration.fetch_add(1, std::memory_order_acq_rel);
+            sNextLoad = (sNextLoad == 1) ? 2 : 1;
+            return true;
+        }
+
+        bool loadLeapSecondsFile(const char* path)
+        {
+            u64       size = 0;
+            const u8* data = mapFile(path, size);
+            if (data == nullptr)
+                return false;
+            bool const loaded = loadLeapSeconds((const char*)data, (s64)size);
+            unmapFile(data, size);
+            return loaded;
+        }
+
+        void resetLeapSeconds()
+        {
+            sGetTable();
+            sActive.store(&sTables[0], std::memory_order_release);
+            sGeneration.fetch_add(1, std::memory_order_acq_rel);
+        }
+
+        s32        getNumLeapSeconds() { return sGetTable()->mCount; }
+        datetime_t getLeapSecondsExpiry() { return datetime_t((u64)sGetTable()->mExpires); }
+
+        void getLeapSecondCacheStats(u64& hits, u64& misses)
+        {
+            hits   = tLeapCache.mHits;
+            misses = tLeapCache.mMisses;
+        }
+    } // namespace ntime
+
+}; // namespace ncore
@@ -0,0 +1,1062 @@
+#include "ccore/c_debug.h"
+
+#include "ctime/c_datetime.h"
+#include "ctime/c_timezone.h"
+
+#include "ctime/private/c_calendar.h"
+#include "ctime/private/c_file_mapping.h"
+#include "ctime/private/c_timezone_data.h"
+
+#include <atomic>
+
+namespace ncore
+{
+    using namespace ncalendar;
+
+    // UTC offsets never exceed 26 hours, local times are resolved against the transitions in this window
+    static const s64 sMaxOffsetSeconds = 26 * 3600;
+
+    static inline u32 sReadU32(const u8* p) { return ((u32)p[0] << 24) | ((u32)p[1] << 16) | ((u32)p[2] << 8) | (u32)p[3]; }
+    static inline s64 sReadS64(const u8* p) { return (s64)(((u64)sReadU32(p) << 32) | (u64)sReadU32(p + 4)); }
+
+    static inline s64 sTicksToSeconds(s64 ticks)
+    {
+        s64 const t = ticks - EpochTicks;
+        s64       s = t / TicksPerSecond;
+        return (t < 0 && (s * TicksPerSecond) != t) ? (s - 1) : s;
+    }
+
+    static inline datetime_t sClampTicks(s64 ticks) { return datetime_t((u64)(ticks < 0 ? 0 : (ticks > MaxTicks ? MaxTicks : ticks))); }
+
+    static inline s64 sSecondsToTicks(s64 seconds)
+    {
+        // Saturates, transition tables may contain times far outside the datetime_t range
+        if (seconds <= -(EpochTicks / TicksPerSecond))
+            return 0;
+        if (seconds >= ((MaxTicks - EpochTicks) / TicksPerSecond))
+            return MaxTicks + 1;
+        return seconds * TicksPerSecond + EpochTicks;
+    }
+
+    // ------------------------------------------------------------------------------------------
+    // Per-thread cache of the current period [start, end) (in UTC ticks) of the most recently
+    // used zones. Consecutive conversions nearly always fall in the same DST period, a hit
+    // costs two compares, only a miss searches the transition table.
+
+    struct timezone_period_t
+    {
+        const timezone_t* mZone;
+        s64               mStart;
+        s64               mEnd;
+        s32               mOffset;
+    };
+
+    struct timezone_period_cache_t
+    {
+        enum
+        {
+            NumSlots = 8,
+        };
+
+        timezone_period_t mSlots[NumSlots];
+        u64               mHits;
+        u64               mMisses;
+
+        static inline u32 sSlot(const timezone_t* zone) { return (u32)(((u64)zone / sizeof(void*)) ^ ((u64)zone >> 12)) & (NumSlots - 1); }
+    };
+
+    static thread_local timezone_period_cache_t tPeriodCache = {};
+
+    static s32 sStrLen(const char* str)
+    {
+        s32 n = 0;
+        while (str[n] != 0)
+            n++;
+        return n;
+    }
+
+    static s32 sStrCompare(const char* a, const char* b)
+    {
+        while (*a != 0 && *a == *b)
+        {
+            a++;
+            b++;
+        }
+        return (s32)(u8)*a - (s32)(u8)*b;
+    }
+
+    static inline bool sStrEqual(const char* a, const char* b) { return sStrCompare(a, b) == 0; }
+
+    static const timezone_data_t* sFindBuiltin(const char* name)
+    {
+        s32                          count;
+        const timezone_data_t* const zones = ntime::getBuiltinZones(count);
+        s32                          lo    = 0;
+        s32                          hi    = count;
+        while (lo < hi)
+        {
+            s32 const mid = (lo + hi) >> 1;
+            s32 const c   = sStrCompare(zones[mid].mName, name);
+            if (c == 0)
+                return &zones[mid];
+            if (c < 0)
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+        return nullptr;
+    }
+
+    // ------------------------------------------------------------------------------------------
+    // POSIX TZ rule, the footer of a version 2+ TZif file. It describes the transitions after
+    // the last one in the table, e.g. "CET-1CEST,M3.5.0,M10.5.0/3":
+    //
+    //     std offset [dst [offset] [,start[/time],end[/time]]]
+    //
+    // Offsets are hours west of UTC, a date is Jn (1-365, February 29 is never counted), n
+    // (0-365) or Mm.w.d (day d of week w of month m, week 5 is the last, day 0 is Sunday). The
+    // time of a date is local time, it defaults to 02:00 and may be negative or beyond 24 hours
+    // (RFC 8536, 3.3.1). The transitions of a year are computed on first use and remembered.
+
+    struct timezone_rule_t
+    {
+        enum EDateKind
+        {
+            DateJulian1,
+            DateJulian0,
+            DateMonthWeekDay,
+        };
+
+        struct date_rule_t
+        {
+            s32 mKind;
+            s32 mMonth;
+            s32 mWeek;
+            s32 mDay; ///< Day of the week (Mm.w.d) or the day of the year (Jn, n)
+            s32 mTime; ///< Seconds since local midnight
+        };
+
+        struct year_t
+        {
+            s32 mYear;
+            s64 mStart; ///< DST starts (unix time)
+            s64 mEnd;   ///< DST ends (unix time)
+        };
+
+        enum
+        {
+            NumYears = 16,
+        };
+
+        bool parse(const char* str, s32 len);
+        void transitionsOfYear(s32 year, s64& start, s64& end);
+
+        s32              mStdOffset; ///< Seconds east of UTC
+        s32              mDstOffset;
+        date_rule_t      mStart;
+        date_rule_t      mEnd;
+        year_t           mYears[NumYears];
+        std::atomic_flag mLock;
+    };
+
+    static bool sParseName(const char*& p, const char* end)
+    {
+        const char* const begin = p;
+        if (p < end && *p == '<')
+        {
+            while (p < end && *p != '>')
+                p++;
+            if (p == end || (p - begin) < 4)
+                return false;
+            p++;
+            return true;
+        }
+        while (p < end && ((*p >= 'a' && *p <= 'z') || (*p >= 'A' && *p <= 'Z')))
+            p++;
+        return (p - begin) >= 3;
+    }
+
+    static bool sParseNumber(const char*& p, const char* end, s32 maxValue, s32& value)
+    {
+        if (p == end || *p < '0' || *p > '9')
+            return false;
+        value = 0;
+        while (p < end && *p >= '0' && *p <= '9')
+        {
+            value = value * 10 + (*p++ - '0');
+            if (value > maxValue)
+                return false;
+        }
+        return true;
+    }
+
+    // [+|-]hh[:mm[:ss]] in seconds
+    static bool sParseTime(const char*& p, const char* end, s32 maxHours, s32& seconds)
+    {
+        s32 sign = 1;
+        if (p < end && (*p == '+' || *p == '-'))
+            sign = (*p++ == '-') ? -1 : 1;
+        s32 h, m = 0, s = 0;
+        if (!sParseNumber(p, end, maxHours, h))
+            return false;
+        if (p < end && *p == ':')
+        {
+            p++;
+            if (!sParseNumber(p, end, 59, m))
+                return false;
+            if (p < end && *p == ':')
+            {
+                p++;
+                if (!sParseNumber(p, end, 59, s))
+                    return false;
+            }
+        }
+        seconds = sign * (h * 3600 + m * 60 + s);
+        return true;
+    }
+
+    static bool sParseDate(const char*& p, const char* end, timezone_rule_t::date_rule_t& date)
+    {
+        date.mMonth = 0;
+        date.mWeek  = 0;
+        date.mDay   = 0;
+        date.mTime  = 2 * 3600;
+        if (p < end && *p == 'M')
+        {
+            p++;
+            date.mKind = timezone_rule_t::DateMonthWeekDay;
+            if (!sParseNumber(p, end, 12, date.mMonth) || date.mMonth < 1 || p == end || *p++ != '.')
+                return false;
+            if (!sParseNumber(p, end, 5, date.mWeek) || date.mWeek < 1 || p == end || *p++ != '.')
+                return false;
+            if (!sParseNumber(p, end, 6, date.mDay))
+                return false;
+        }
+        else if (p < end && *p == 'J')
+        {
+            p++;
+            date.mKind = timezone_rule_t::DateJulian1;
+            if (!sParseNumber(p, end, 365, date.mDay) || date.mDay < 1)
+                return false;
+        }
+        else
+        {
+            date.mKind = timezone_rule_t::DateJulian0;
+            if (!sParseNumber(p, end, 365, date.mDay))
+                return false;
+        }
+        if (p < end && *p == '/')
+        {
+            p++;
+            return sParseTime(p, end, 167, date.mTime);
+        }
+        return true;
+    }
+
+    // Day number (since 0001-01-01) of a date rule in a specific year
+    static s32 sDayOfDateRule(timezone_rule_t::date_rule_t const& date, s32 year)
+    {
+        s32 const jan1 = daysFromCivil(year, 1, 1);
+        if (date.mKind == timezone_rule_t::DateJulian0)
+            return jan1 + date.mDay;
+        if (date.mKind == timezone_rule_t::DateJulian1)
+            return jan1 + date.mDay - 1 + ((isLeapYear(year) && date.mDay >= 60) ? 1 : 0);
+
+        s32 const first = daysFromCivil(year, date.mMonth, 1);
+        s32       day   = first + ((date.mDay - dayOfWeek(first) + 7) % 7) + (date.mWeek - 1) * 7;
+        s32 const last  = first + daysInMonth(year, date.mMonth);
+        while (day >= last)
+            day -= 7;
+        return day;
+    }
+
+    /**
+     *  Summary:
+     *      Compiles a POSIX TZ string, returns false when it cannot be parsed or when it
+     *      has no daylight saving time rule (the table then covers all time).
+     */
+    bool timezone_rule_t::parse(const char* str, s32 len)
+    {
+        const char*       p   = str;
+        const char* const end = str + len;
+
+        s32 offset;
+        if (!sParseName(p, end) || !sParseTime(p, end, 24, offset))
+            return false;
+        mStdOffset = -offset;
+        if (p == end)
+            return false;
+
+        if (!sParseName(p, end))
+            return false;
+        mDstOffset = mStdOffset + 3600;
+        if (p < end && *p != ',')
+        {
+            if (!sParseTime(p, end, 24, offset))
+                return false;
+            mDstOffset = -offset;
+        }
+
+        // Without a rule the transitions are implementation defined, the table is used instead
+        if (p == end || *p++ != ',')
+            return false;
+        if (!sParseDate(p, end, mStart) || p == end || *p++ != ',')
+            return false;
+        if (!sParseDate(p, end, mEnd) || p != end)
+            return false;
+
+        for (s32 i = 0; i < NumYears; ++i)
+            mYears[i].mYear = 0;
+        mLock.clear();
+        return true;
+    }
+
+    void timezone_rule_t::transitionsOfYear(s32 year, s64& start, s64& end)
+    {
+        year_t& slot = mYears[year & (NumYears - 1)];
+        while (mLock.test_and_set(std::memory_order_acquire))
+        {
+        }
+        bool const hit = slot.mYear == year;
+        if (hit)
+        {
+            start = slot.mStart;
+            end   = slot.mEnd;
+        }
+        mLock.clear(std::memory_order_release);
+        if (hit)
+            return;
+
+        // DST starts at a local standard time and ends at a local daylight saving time
+        start = ((s64)(sDayOfDateRule(mStart, year) - DaysTo1970) * 86400) + mStart.mTime - mStdOffset;
+        end   = ((s64)(sDayOfDateRule(mEnd, year) - DaysTo1970) * 86400) + mEnd.mTime - mDstOffset;
+
+        while (mLock.test_and_set(std::memory_order_acquire))
+        {
+        }
+        slot.mYear  = year;
+        slot.mStart = start;
+        slot.mEnd   = end;
+        mLock.clear(std::memory_order_release);
+    }
+
+    // ------------------------------------------------------------------------------------------
+    // Process-wide zone cache, a fixed set of slots filled on demand. Zones are immutable once
+    // published so only finding and publishing takes the lock, conversions never do. Files are
+    // mapped and parsed without the lock, names that were not found are remembered.
+
+    struct timezone_cache_t
+    {
+        enum
+        {
+            MaxZones  = 128,
+            MaxMisses = 32,
+        };
+
+        static timezone_t* sFindLocked(const char* name)
+        {
+            for (s32 i = 0; i < sNumZones; ++i)
+            {
+                if (sStrEqual(sZones[i].mName, name))
+                    return &sZones[i];
+            }
+            return nullptr;
+        }
+
+        // Copies a loaded zone into the next slot, its footer is compiled into the rule of that slot
+        static timezone_t* sPublishLocked(timezone_t const& zone)
+        {
+            timezone_t*      slot = &sZones[sNumZones];
+            timezone_rule_t* rule = &sRules[sNumZones];
+            *slot                 = zone;
+            slot->mRule           = (zone.mFooter != nullptr && rule->parse(zone.mFooter, zone.mFooterLength)) ? rule : nullptr;
+            sNumZones += 1;
+            return slot;
+        }
+
+        static bool sIsMissLocked(const char* name)
+        {
+            s32 const count = sNumMisses < MaxMisses ? sNumMisses : MaxMisses;
+            for (s32 i = 0; i < count; ++i)
+            {
+                if (sStrEqual(sMisses[i], name))
+                    return true;
+            }
+            return false;
+        }
+
+        // The oldest miss is replaced when all are in use
+        static void sAddMissLocked(const char* name)
+        {
+            char* miss = sMisses[sNumMisses % MaxMisses];
+            s32   n    = 0;
+            for (; name[n] != 0 && n < 63; ++n)
+                miss[n] = name[n];
+            miss[n] = 0;
+            sNumMisses += 1;
+        }
+
+        static timezone_t sMakeUtc()
+        {
+            timezone_t zone;
+            zone.mName[0] = 'U';
+            zone.mName[1] = 'T';
+            zone.mName[2] = 'C';
+            zone.mName[3] = 0;
+            return zone;
+        }
+
+        static void sLock()
+        {
+            while (sLockFlag.test_and_set(std::memory_order_acquire))
+            {
+            }
+        }
+        static void sUnlock() { sLockFlag.clear(std::memory_order_release); }
+
+        static timezone_t       sZones[MaxZones];
+        static timezone_rule_t  sRules[MaxZones];
+        static s32              sNumZones;
+        static char             sMisses[MaxMisses][64];
+        static s32              sNumMisses;
+        static std::atomic_flag sLockFlag;
+        static char             sZoneInfoPath[256];
+    };
+
+    timezone_t       timezone_cache_t::sZones[timezone_cache_t::MaxZones];
+    timezone_rule_t  timezone_cache_t::sRules[timezone_cache_t::MaxZones];
+    s32              timezone_cache_t::sNumZones = 0;
+    char             timezone_cache_t::sMisses[timezone_cache_t::MaxMisses][64];
+    s32              timezone_cache_t::sNumMisses = 0;
+    std::atomic_flag timezone_cache_t::sLockFlag = ATOMIC_FLAG_INIT;
+    char             timezone_cache_t::sZoneInfoPath[256] = "/usr/share/zoneinfo";
+
+    // ------------------------------------------------------------------------------------------
+    // timezone_t
+
+    timezone_t::timezone_t()
+        : mData(nullptr)
+        , mSize(0)
+        , mMapped(false)
+        , mTimes(nullptr)
+        , mTypeIndices(nullptr)
+        , mTypes(nullptr)
+        , mFooter(nullptr)
+        , mRule(nullptr)
+        , mNumTimes(0)
+        , mNumTypes(0)
+        , mTimeSize(8)
+        , mFooterLength(0)
+    {
+        mName[0] = 0;
+    }
+
+    bool timezone_t::init(const char* name, const u8* data, u64 size, bool mapped)
+    {
+        // Header: magic(4) version(1) unused(15) isutcnt isstdcnt leapcnt timecnt typecnt charcnt
+        if (data == nullptr || size < 44 || data[0] != 'T' || data[1] != 'Z' || data[2] != 'i' || data[3] != 'f')
+            return false;
+
+        u8 const  version = data[4];
+        const u8* header  = data;
+        u64       offset  = 44;
+        s32       tsize   = 4;
+        if (version >= '2')
+        {
+            // Skip the version 1 data block, the version 2+ block follows with 64-bit times
+            u64 const v1 = (u64)sReadU32(header + 32) * 5 + (u64)sReadU32(header + 36) * 6 + sReadU32(header + 40) + (u64)sReadU32(header + 28) * 8 + sReadU32(header + 24) + sReadU32(header + 20);
+            if ((offset + v1 + 44) > size)
+                return false;
+            header = data + offset + v1;
+            if (header[0] != 'T' || header[1] != 'Z' || header[2] != 'i' || header[3] != 'f')
+                return false;
+            offset = offset + v1 + 44;
+            tsize  = 8;
+        }
+
+        u32 const isutcnt = sReadU32(header + 20);
+        u32 const isstdcnt = sReadU32(header + 24);
+        u32 const leapcnt = sReadU32(header + 28);
+        u32 const timecnt = sReadU32(header + 32);
+        u32 const typecnt = sReadU32(header + 36);
+        u32 const charcnt = sReadU32(header + 40);
+        if (typecnt == 0 || typecnt > 256)
+            return false;
+
+        u64 const block = (u64)timecnt * (tsize + 1) + (u64)typecnt * 6 + charcnt + (u64)leapcnt * (tsize + 4) + isstdcnt + isutcnt;
+        if ((offset + block) > size)
+            return false;
+
+        mTimes       = data + offset;
+        mTypeIndices = mTimes + (u64)timecnt * tsize;
+        mTypes       = mTypeIndices + timecnt;
+        mNumTimes    = (s32)timecnt;
+        mNumTypes    = (s32)typecnt;
+        mTimeSize    = tsize;
+        for (u32 i = 0; i < timecnt; ++i)
+        {
+            if (mTypeIndices[i] >= typecnt)
+                return false;
+        }
+
+        // Footer of version 2+ files: '\n' <POSIX TZ string> '\n'
+        mFooter       = nullptr;
+        mFooterLength = 0;
+        u64 footer    = offset + block;
+        if (tsize == 8 && footer < size && data[footer] == '\n')
+        {
+            u64 end = footer + 1;
+            while (end < size && data[end] != '\n')
+                end++;
+            if (end < size)
+            {
+                mFooter       = (const char*)data + footer + 1;
+                mFooterLength = (s32)(end - footer - 1);
+            }
+        }
+
+        // The footer is compiled when the zone is published to the cache
+        mRule = nullptr;
+
+        s32 n = 0;
+        for (; name[n] != 0 && n < (s32)(sizeof(mName) - 1); ++n)
+            mName[n] = name[n];
+        mName[n] = 0;
+        mData    = data;
+        mSize    = size;
+        mMapped  = mapped;
+        return true;
+    }
+
+    s64 timezone_t::transitionAt(s32 index) const
+    {
+        const u8* p = mTimes + (u64)index * mTimeSize;
+        return (mTimeSize == 8) ? sReadS64(p) : (s64)(s32)sReadU32(p);
+    }
+
+    s32 timezone_t::offsetOfType(s32 type) const { return (mNumTypes == 0) ? 0 : (s32)sReadU32(mTypes + type * 6); }
+
+    // Local time before the first transition is given by time type 0 (RFC 8536, 3.2)
+    s32 timezone_t::offsetOfTransition(s32 index) const { return offsetOfType(index < 0 ? 0 : mTypeIndices[index]); }
+
+    s32 timezone_t::findTransition(s64 seconds) const
+    {
+        // Number of transitions <= seconds, minus one
+        s32 lo = 0;
+        s32 n  = mNumTimes;
+        while (n > 0)
+        {
+            s32 const half = n >> 1;
+            if (transitionAt(lo + half) <= seconds)
+            {
+                lo += half + 1;
+                n -= half + 1;
+            }
+            else
+            {
+                n = half;
+            }
+        }
+        return lo - 1;
+    }
+
+    /**
+     *  Summary:
+     *      Gets the offset from UTC of this zone at a specific instant.
+     *
+     *  Parameters:
+     *    utc:
+     *      The instant, expressed in UTC.
+     *
+     *  Returns:
+     *      The offset in seconds east of UTC (local = utc + offset).
+     */
+    s32 timezone_t::offsetAt(datetime_t utc) const { return offsetAtTicks((s64)utc.ticks()); }
+
+    s32 timezone_t::offsetAtTicks(s64 ticks) const
+    {
+        timezone_period_t& period = tPeriodCache.mSlots[timezone_period_cache_t::sSlot(this)];
+        if (period.mZone == this && ticks >= period.mStart && ticks < period.mEnd)
+        {
+            tPeriodCache.mHits += 1;
+            return period.mOffset;
+        }
+        tPeriodCache.mMisses += 1;
+        lookupPeriod(ticks, period.mStart, period.mEnd, period.mOffset);
+        period.mZone = this;
+        return period.mOffset;
+    }
+
+    void timezone_t::lookupPeriod(s64 ticks, s64& start, s64& end, s32& offset) const
+    {
+        if (!rulePeriod(ticks, start, end, offset))
+            periodOfTransition(findTransition(sTicksToSeconds(ticks)), start, end, offset);
+    }
+
+    bool timezone_t::rulePeriod(s64 ticks, s64& start, s64& end, s32& offset) const
+    {
+        s64 const seconds = sTicksToSeconds(ticks);
+        s64 const last    = (mNumTimes > 0) ? transitionAt(mNumTimes - 1) : D_CONSTANT_S64(-0x7fffffffffffffff);
+        if (mRule == nullptr || seconds < last)
+            return false;
+
+        // The transitions of the surrounding years bound the period, the period that starts
+        // at the last transition of the table ends at the first transition of the rule.
+        s64 days = seconds / 86400;
+        days     = ((seconds < 0) && (days * 86400) != seconds) ? (days - 1) : days;
+        s32 year, month, day;
+        civilFromDays((s32)(days + DaysTo1970), year, month, day);
+        year = year < 2 ? 2 : year;
+
+        s64 first = last;
+        s64 next  = D_CONSTANT_S64(0x7fffffffffffffff);
+        offset    = offsetOfTransition(mNumTimes - 1);
+        for (s32 y = year - 1; y <= year + 2; ++y)
+        {
+            s64 t[2];
+            s32 o[2];
+            mRule->transitionsOfYear(y, t[0], t[1]);
+            o[0] = mRule->mDstOffset;
+            o[1] = mRule->mStdOffset;
+            for (s32 k = 0; k < 2; ++k)
+            {
+                if (t[k] <= last)
+                    continue;
+                if (t[k] <= seconds && t[k] >= first)
+                {
+                    first  = t[k];
+                    offset = o[k];
+                }
+                else if (t[k] > seconds && t[k] < next)
+                {
+                    next = t[k];
+                }
+            }
+        }
+        start = (mNumTimes > 0 || first != last) ? sSecondsToTicks(first) : D_CONSTANT_S64(-0x7fffffffffffffff);
+        end   = (next != D_CONSTANT_S64(0x7fffffffffffffff)) ? sSecondsToTicks(next) : next;
+        return true;
+    }
+
+    void timezone_t::periodOfTransition(s32 i, s64& start, s64& end, s32& offset) const
+    {
+        start  = (i < 0) ? D_CONSTANT_S64(-0x7fffffffffffffff) : sSecondsToTicks(transitionAt(i));
+        end    = ((i + 1) < mNumTimes) ? sSecondsToTicks(transitionAt(i + 1)) : D_CONSTANT_S64(0x7fffffffffffffff);
+        offset = offsetOfTransition(i);
+    }
+
+    /**
+     *  Summary:
+     *      Converts an instant in UTC to the local time of this zone.
+     */
+    datetime_t timezone_t::utcToLocal(datetime_t utc) const { return sClampTicks((s64)utc.ticks() + (s64)offsetAtTicks((s64)utc.ticks()) * TicksPerSecond); }
+
+    static const u64 sTicksMask = D_CONSTANT_U64(0x3fffffffffffffff);
+
+    // Adds a constant to a run of ticks with saturation, written so that it vectorizes
+    static void sAddTicks(const u64* src, u64* dst, s64 count, s64 delta)
+    {
+        for (s64 i = 0; i < count; ++i)
+        {
+            s64 v  = (s64)(src[i] & sTicksMask) + delta;
+            v      = v < 0 ? 0 : v;
+            v      = v > MaxTicks ? MaxTicks : v;
+            dst[i] = (u64)v;
+        }
+    }
+
+    // First index in [from, count) with a value >= 'end', the values must be sorted
+    static s64 sRunEnd(const u64* src, s64 from, s64 count, s64 end)
+    {
+        // Gallop forward, then binary search the last step
+        s64 lo   = from;
+        s64 step = 1;
+        while ((lo + step) < count && (s64)(src[lo + step] & sTicksMask) < end)
+        {
+            lo += step;
+            step <<= 1;
+        }
+        s64 hi = (lo + step) < count ? (lo + step) : count;
+        while (lo < hi)
+        {
+            s64 const mid = lo + ((hi - lo) >> 1);
+            if ((s64)(src[mid] & sTicksMask) < end)
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+        return lo;
+    }
+
+    /**
+     *  Summary:
+     *      Converts an array of UTC instants to local time, 'in' and 'out' may be the same array.
+     *
+     *  Remarks:
+     *      Sorted input is merged with the transition table in one pass, every run of
+     *      elements between two transitions gets the same offset added in a tight loop.
+     *      Unsorted input falls back to a lookup per element.
+     */
+    void timezone_t::utcToLocal(const datetime_t* in, datetime_t* out, s64 count) const
+    {
+        // datetime_t is a single u64 of ticks, its high 2 bits are masked out
+        static_assert(sizeof(datetime_t) == sizeof(u64), "datetime_t must be a plain 64-bit value");
+        const u64* src = reinterpret_cast<const u64*>(in);
+        u64*       dst = reinterpret_cast<u64*>(out);
+        if (count <= 0)
+            return;
+
+        bool sorted = true;
+        for (s64 i = 1; i < count && sorted; ++i)
+            sorted = (src[i] & sTicksMask) >= (src[i - 1] & sTicksMask);
+
+        if (!sorted)
+        {
+            for (s64 i = 0; i < count; ++i)
+            {
+                s64 const t = (s64)(src[i] & sTicksMask);
+                sAddTicks(src + i, dst + i, 1, (s64)offsetAtTicks(t) * TicksPerSecond);
+            }
+            return;
+        }
+
+        s32 index = findTransition(sTicksToSeconds((s64)(src[0] & sTicksMask)));
+        s64 i     = 0;
+        while (i < count)
+        {
+            // Past the table the periods come from the rule
+            s64 start, end;
+            s32 offset;
+            if ((index + 1) < mNumTimes)
+                periodOfTransition(index, start, end, offset);
+            else
+                lookupPeriod((s64)(src[i] & sTicksMask), start, end, offset);
+
+            // A period ending at MaxTicks + 1 (saturated) does not cover the ticks beyond it, the
+            // element at 'i' still takes the offset it was looked up with
+            s64 j = sRunEnd(src, i, count, end);
+            j     = (j > i) ? j : (i + 1);
+            sAddTicks(src + i, dst + i, j - i, (s64)offset * TicksPerSecond);
+            i = j;
+
+            // Step to the transition that covers the next element
+            if (i < count && (index + 1) < mNumTimes)
+            {
+                s64 const t = (s64)(src[i] & sTicksMask);
+                index += 1;
+                while ((index + 1) < mNumTimes && sSecondsToTicks(transitionAt(index + 1)) <= t)
+                    index += 1;
+            }
+        }
+    }
+
+    // Outcome of resolving a local time
+    enum
+    {
+        LocalUnique  = 0,
+        LocalGap     = 1,
+        LocalOverlap = 2,
+    };
+
+    static inline bool sIsFarInside(timezone_period_t const& period, s64 utc)
+    {
+        // No other period can produce the same local time when 'utc' is this far from both ends
+        return (utc - period.mStart) >= (2 * sMaxOffsetSeconds * TicksPerSecond) && (period.mEnd - utc) > (2 * sMaxOffsetSeconds * TicksPerSecond);
+    }
+
+    /**
+     *  Summary:
+     *      Finds the UTC instants (in ticks) that have 'local' as their local time.
+     *
+     *  Returns:
+     *      LocalUnique with earlier == later, LocalOverlap with both instants or LocalGap
+     *      with the local time interpreted with the offset after (earlier) and before
+     *      (later) the transition.
+     */
+    s32 timezone_t::resolveLocal(s64 local, s64& earlier, s64& later) const
+    {
+        // Every period for which 'local - offset' falls inside the period is a solution, only
+        // the periods around 'local' can contribute.
+        s64 const window = sMaxOffsetSeconds * TicksPerSecond;
+        s64       start, end;
+        s32       off;
+        lookupPeriod(local - window, start, end, off);
+        s32  before    = off;
+        s32  after     = off;
+        s32  solutions = 0;
+        bool gap       = false;
+        while (true)
+        {
+            s64 const u = local - (s64)off * TicksPerSecond;
+            if (u >= start && u < end)
+            {
+                if (solutions == 0)
+                    earlier = u;
+                later = u;
+                solutions += 1;
+            }
+            else if (u >= end)
+            {
+                before = off;
+            }
+            else if (solutions == 0 && !gap)
+            {
+                after = off;
+                gap   = true;
+            }
+            if (end > (local + window))
+                break;
+            s64 const from = end;
+            lookupPeriod(from, start, end, off);
+            if (end <= from)
+                break;
+        }
+
+        if (solutions > 0)
+            return solutions == 1 ? LocalUnique : LocalOverlap;
+        earlier = local - (s64)after * TicksPerSecond;
+        later   = local - (s64)before * TicksPerSecond;
+        return LocalGap;
+    }
+
+    /**
+     *  Summary:
+     *      Converts a local time of this zone to UTC.
+     *
+     *  Returns:
+     *      When the local time occurs twice (the clock is turned back) the earliest
+     *      instant is returned, when it does not exist (the clock is turned forward)
+     *      it is interpreted with the offset from before the transition, which
+     *      shifts it forward by the length of the gap.
+     */
+    datetime_t timezone_t::localToUtc(datetime_t local) const
+    {
+        datetime_t utc;
+        localToUtc(local, LocalTimeShiftForward, utc);
+        return utc;
+    }
+
+    /**
+     *  Summary:
+     *      Converts a local time of this zone to UTC, resolving gaps and overlaps as
+     *      specified by 'policy'.
+     *
+     *  Returns:
+     *      False when the local time is in a gap or an overlap and the policy is
+     *      LocalTimeReject, 'utc' is not changed in that case.
+     */
+    bool timezone_t::localToUtc(datetime_t local, ELocalTimePolicy policy, datetime_t& utc) const
+    {
+        timezone_period_t& period = tPeriodCache.mSlots[timezone_period_cache_t::sSlot(this)];
+        if (period.mZone == this)
+        {
+            s64 const u = (s64)local.ticks() - (s64)period.mOffset * TicksPerSecond;
+            if (sIsFarInside(period, u))
+            {
+                tPeriodCache.mHits += 1;
+                utc = sClampTicks(u);
+                return true;
+            }
+        }
+        tPeriodCache.mMisses += 1;
+
+        s64       earlier, later;
+        s32 const kind = resolveLocal((s64)local.ticks(), earlier, later);
+        if (kind == LocalUnique)
+        {
+            lookupPeriod(earlier, period.mStart, period.mEnd, period.mOffset);
+            period.mZone = this;
+        }
+        if (kind != LocalUnique && policy == LocalTimeReject)
+            return false;
+        bool const late = (policy == LocalTimeLatest) || (kind == LocalGap && policy == LocalTimeShiftForward);
+        utc             = sClampTicks(late ? later : earlier);
+        return true;
+    }
+
+    /**
+     *  Remarks:
+     *      The period of the previous result is kept, most elements are converted with
+     *      two compares and a subtraction. Rejected elements are copied unconverted.
+     */
+    s64 timezone_t::localToUtc(const datetime_t* in, datetime_t* out, s64 count, ELocalTimePolicy policy, u64* gapMask, u64* overlapMask) const
+    {
+        const u64* src = reinterpret_cast<const u64*>(in);
+        u64*       dst = reinterpret_cast<u64*>(out);
+        if (count <= 0)
+            return 0;
+
+        s64 const words = (count + 63) >> 6;
+        for (s64 w = 0; w < words; ++w)
+        {
+            if (gapMask != nullptr)
+                gapMask[w] = 0;
+            if (overlapMask != nullptr)
+                overlapMask[w] = 0;
+        }
+
+        timezone_period_t period;
+        period.mZone   = this;
+        period.mStart  = 0;
+        period.mEnd    = 0;
+        period.mOffset = 0;
+
+        s64 converted = 0;
+        for (s64 i = 0; i < count; ++i)
+        {
+            s64 const local = (s64)(src[i] & sTicksMask);
+            s64 const u     = local - (s64)period.mOffset * TicksPerSecond;
+            if (sIsFarInside(period, u))
+            {
+                dst[i] = (u64)sClampTicks(u).ticks();
+                converted += 1;
+                continue;
+            }
+
+            s64       earlier, later;
+            s32 const kind = resolveLocal(local, earlier, later);
+            if (kind == LocalGap && gapMask != nullptr)
+                gapMask[i >> 6] |= (u64)1 << (i & 63);
+            if (kind == LocalOverlap && overlapMask != nullptr)
+                overlapMask[i >> 6] |= (u64)1 << (i & 63);
+
+            if (kind != LocalUnique && policy == LocalTimeReject)
+            {
+                dst[i] = (u64)local;
+                continue;
+            }
+            bool const late = (policy == LocalTimeLatest) || (kind == LocalGap && policy == LocalTimeShiftForward);
+            dst[i]          = (u64)sClampTicks(late ? later : earlier).ticks();
+            converted += 1;
+
+            if (kind == LocalUnique)
+                lookupPeriod(earlier, period.mStart, period.mEnd, period.mOffset);
+        }
+        return converted;
+    }
+
+    void timezone_t::sGetCacheStats(u64& hits, u64& misses)
+    {
+        hits   = tPeriodCache.mHits;
+        misses = tPeriodCache.mMisses;
+    }
+
+    void timezone_t::sResetCacheStats()
+    {
+        tPeriodCache.mHits   = 0;
+        tPeriodCache.mMisses = 0;
+    }
+
+    // ------------------------------------------------------------------------------------------
+    // Zone cache
+
+    const timezone_t* timezone_t::sUtc()
+    {
+        static timezone_t const sUtcZone = timezone_cache_t::sMakeUtc();
+        return &sUtcZone;
+    }
+
+    void timezone_t::sSetZoneInfoPath(const char* path)
+    {
+        timezone_cache_t::sLock();
+        s32 n = 0;
+        for (; path[n] != 0 && n < (s32)(sizeof(timezone_cache_t::sZoneInfoPath) - 1); ++n)
+            timezone_cache_t::sZoneInfoPath[n] = path[n];
+        timezone_cache_t::sZoneInfoPath[n] = 0;
+        timezone_cache_t::sNumMisses       = 0; // They may be found in the new directory
+        timezone_cache_t::sUnlock();
+    }
+
+    const timezone_t* timezone_t::sRegister(const char* name, const u8* tzif, u64 size)
+    {
+        // Names that do not fit mName would be truncated and could alias another zone
+        if (name == nullptr)
+            return nullptr;
+        s32 const len = sStrLen(name);
+        if (len == 0 || len >= 64)
+            return nullptr;
+
+        timezone_t loaded;
+        if (!loaded.init(name, tzif, size, false))
+            return nullptr;
+
+        timezone_cache_t::sLock();
+        timezone_t* zone = timezone_cache_t::sFindLocked(name);
+        if (zone == nullptr && timezone_cache_t::sNumZones < timezone_cache_t::MaxZones)
+            zone = timezone_cache_t::sPublishLocked(loaded);
+        timezone_cache_t::sUnlock();
+        return zone;
+    }
+
+    const timezone_t* timezone_t::sFind(const char* name)
+    {
+        if (name == nullptr)
+            return nullptr;
+        if (sStrEqual(name, "UTC"))
+            return sUtc();
+
+        // Only relative names within the zoneinfo directory
+        s32 const len = sStrLen(name);
+        if (len == 0 || len >= 64 || name[0] == '/')
+            return nullptr;
+        for (s32 i = 0; (i + 1) < len; ++i)
+        {
+            if (name[i] == '.' && name[i + 1] == '.')
+                return nullptr;
+        }
+
+        char path[256 + 64 + 2];
+        timezone_cache_t::sLock();
+        timezone_t* zone   = timezone_cache_t::sFindLocked(name);
+        bool const  missed = zone == nullptr && timezone_cache_t::sIsMissLocked(name);
+        s32         n      = 0;
+        for (const char* root = timezone_cache_t::sZoneInfoPath; *root != 0; ++root)
+            path[n++] = *root;
+        timezone_cache_t::sUnlock();
+        if (zone != nullptr || missed)
+            return zone;
+
+        // Loaded without the lock. The zoneinfo directory first, it has the full history of the
+        // zone. The compiled-in zones (no transitions before 1970) are the fallback when it is
+        // not available.
+        path[n++] = '/';
+        for (s32 i = 0; i <= len; ++i)
+            path[n++] = name[i];
+
+        timezone_t loaded;
+        bool       found = false;
+        u64        size  = 0;
+        const u8*  data  = ntime::mapFile(path, size);
+        if (data != nullptr)
+        {
+            found = loaded.init(name, data, size, true);
+            if (!found)
+                ntime::unmapFile(data, size);
+        }
+        if (!found)
+        {
+            const timezone_data_t* builtin = sFindBuiltin(name);
+            found                          = builtin != nullptr && loaded.init(name, builtin->mData, builtin->mSize, false);
+        }
+
+        // Another thread may have published the zone in the meantime, its instance is kept
+        bool published = false;
+        timezone_cache_t::sLock();
+        zone = timezone_cache_t::sFindLocked(name);
+        if (zone == nullptr && found && timezone_cache_t::sNumZones < timezone_cache_t::MaxZones)
+        {
+            zone      = timezone_cache_t::sPublishLocked(loaded);
+            published = true;
+        }
+        else if (zone == nullptr && !found)
+        {
+            timezone_cache_t::sAddMissLocked(name);
+        }
+        timezone_cache_t::sUnlock();
+
+        if (found && !published && loaded.mMapped)
+            ntime::unmapFile(loaded.mData, loaded.mSize);
+        return zone;
+    }
+
+}; // namespace ncore
@@ -0,0 +1,727 @@
+// Generated by package/tzdata, do not edit.
+// 16 zones, transitions from 1970.
+#include "ccore/c_target.h"
+
+#include "ctime/private/c_timezone_data.h"
+
+namespace ncore
+{
+    namespace ntzdata
+    {
+        // Africa/Johannesburg, 0 transitions
+        static constexpr u8 sZone0[118] = {
+          0x54,0x5a,0x69,0x66,0x32,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+          0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,
+          0x00,0x00,0x00,0x54,0x5a,0x69,0x66,0x32,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+          0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x09,0x00,
+          0x00,0x1c,0x20,0x00,0x04,0x4c,0x4d,0x54,0x00,0x53,0x41,0x53,0x54,0x00,0x0a,0x53,0x41,0x53,0x54,0x2d,0x32,0x0a,
+        };
+
+        // America/Chicago, 136 transitions
+        static constexpr u8 sZone1[1379] = {
+          0x54,0x5a,0x69,0x66,0x32,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+          0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,
+          0x00,0x00,0x00,0x54,0x5a,0x69,0x66,0x32,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+          0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x88,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x18,0x00,
+          0x00,0x00,0x00,0x00,0x98,0x0d,0x00,0x00,0x00,0x00,0x00,0x01,0x87,0xef,0xf0,0x00,0x00,0x00,0x00,0x02,0x77,0xef,0x00,0x00,
+          0x00,0x00,0x00,0x03,0x71,0x0c,0x70,0x00,0x00,0x00,0x00,0x04,0x61,0x0b,0x80,0x00,0x00,0x00,0x00,0x05,0x50,0xee,0x70,0x00,
+          0x00,0x00,0x00,0x06,0x40,0xed,0x80,0x00,0x00,0x00,0x00,0x07,0x30,0xd0,0x70,0x00,0x00,0x00,0x00,0x07,0x8d,0x27,0x80,0x00,
+          0x00,0x00,0x00,0x09,0x10,0xb2,0x70,0x00,0x00,0x00,0x00,0x09,0xad,0xa3,0x00,0x00,0x00,0x00,0x00,0x0a,0xf0,0x94,0x70,0x00,
+          0x00,0x00,0x00,0x0b,0xe0,0x93,0x80,0x00,0x00,0x00,0x00,0x0c,0xd9,0xb0,0xf0,0x00,0x00,0x00,0x00,0x0d,0xc0,0x75,0x80,0x00,
+          0x00,0x00,0x00,0x0e,0xb9,0x92,0xf0,0x00,0x00,0x00,0x00,0x0f,0xa9,0x92,0x00,0x00,0x00,0x00,0x00,0x10,0x99,0x74,0xf0,0x00,
+          0x00,0x00,0x00,0x11,0x89,0x74,0x00,0x00,0x00,0x00,0x00,0x12,0x79,0x56,0xf0,0x00,0x00,0x00,0x00,0x13,0x69,0x56,0x00,0x00,
+          0x00,0x00,0x00,0x14,0x59,0x38,0xf0,0x00,0x00,0x00,0x00,0x15,0x49,0x38,0x00,0x00,0x00,0x00,0x00,0x16,0x39,0x1a,0xf0,0x00,
+          0x00,0x00,0x00,0x17,0x29,0x1a,0x00,0x00,0x00,0x00,0x00,0x18,0x22,0x37,0x70,0x00,0x00,0x00,0x00,0x19,0x08,0xfc,0x00,0x00,
+          0x00,0x00,0x00,0x1a,0x02,0x19,0x70,0x00,0x00,0x00,0x00,0x1a,0xf2,0x18,0x80,0x00,0x00,0x00,0x00,0x1b,0xe1,0xfb,0x70,0x00,
+          0x00,0x00,0x00,0x1c,0xd1,0xfa,0x80,0x00,0x00,0x00,0x00,0x1d,0xc1,0xdd,0x70,0x00,0x00,0x00,0x00,0x1e,0xb1,0xdc,0x80,0x00,
+          0x00,0x00,0x00,0x1f,0xa1,0xbf,0x70,0x00,0x00,0x00,0x00,0x20,0x76,0x0f,0x00,0x00,0x00,0x00,0x00,0x21,0x81,0xa1,0x70,0x00,
+          0x00,0x00,0x00,0x22,0x55,0xf1,0x00,0x00,0x00,0x00,0x00,0x23,0x6a,0xbd,0xf0,0x00,0x00,0x00,0x00,0x24,0x35,0xd3,0x00,0x00,
+          0x00,0x00,0x00,0x25,0x4a,0x9f,0xf0,0x00,0x00,0x00,0x00,0x26,0x15,0xb5,0x00,0x00,0x00,0x00,0x00,0x27,0x2a,0x81,0xf0,0x00,
+          0x00,0x00,0x00,0x27,0xfe,0xd1,0x80,0x00,0x00,0x00,0x00,0x29,0x0a,0x63,0xf0,0x00,0x00,0x00,0x00,0x29,0xde,0xb3,0x80,0x00,
+          0x00,0x00,0x00,0x2a,0xea,0x45,0xf0,0x00,0x00,0x00,0x00,0x2b,0xbe,0x95,0x80,0x00,0x00,0x00,0x00,0x2c,0xd3,0x62,0x70,0x00,
+          0x00,0x00,0x00,0x2d,0x9e,0x77,0x80,0x00,0x00,0x00,0x00,0x2e,0xb3,0x44,0x70,0x00,0x00,0x00,0x00,0x2f,0x7e,0x59,0x80,0x00,
+          0x00,0x00,0x00,0x30,0x93,0x26,0x70,0x00,0x00,0x00,0x00,0x31,0x67,0x76,0x00,0x00,0x00,0x00,0x00,0x32,0x73,0x08,0x70,0x00,
+          0x00,0x00,0x00,0x33,0x47,0x58,0x00,0x00,0x00,0x00,0x00,0x34,0x52,0xea,0x70,0x00,0x00,0x00,0x00,0x35,0x27,0x3a,0x00,0x00,
+          0x00,0x00,0x00,0x36,0x32,0xcc,0x70,0x00,0x00,0x00,0x00,0x37,0x07,0x1c,0x00,0x00,0x00,0x00,0x00,0x38,0x1b,0xe8,0xf0,0x00,
+          0x00,0x00,0x00,0x38,0xe6,0xfe,0x00,0x00,0x00,0x00,0x00,0x39,0xfb,0xca,0xf0,0x00,0x00,0x00,0x00,0x3a,0xc6,0xe0,0x00,0x00,
+          0x00,0x00,0x00,0x3b,0xdb,0xac,0xf0,0x00,0x00,0x00,0x00,0x3c,0xaf,0xfc,0x80,0x00,0x00,0x00,0x00,0x3d,0xbb,0x8e,0xf0,0x00,
+          0x00,0x00,0x00,0x3e,0x8f,0xde,0x80,0x00,0x00,0x00,0x00,0x3f,0x9b,0x70,0xf0,0x00,0x00,0x00,0x00,0x40,0x6f,0xc0,0x80,0x00,
+          0x00,0x00,0x00,0x41,0x84,0x8d,0x70,0x00,0x00,0x00,0x00,0x42,0x4f,0xa2,0x80,0x00,0x00,0x00,0x00,0x43,0x64,0x6f,0x70,0x00,
+          0x00,0x00,0x00,0x44,0x2f,0x84,0x80,0x00,0x00,0x00,0x00,0x45,0x44,0x51,0x70,0x00,0x00,0x00,0x00,0x45,0xf3,0xb7,0x00,0x00,
+          0x00,0x00,0x00,0x47,0x2d,0x6d,0xf0,0x00,0x00,0x00,0x00,0x47,0xd3,0x99,0x00,0x00,0x00,0x00,0x00,0x49,0x0d,0x4f,0xf0,0x00,
+          0x00,0x00,0x00,0x49,0xb3,0x7b,0x00,0x00,0x00,0x00,0x00,0x4a,0xed,0x31,0xf0,0x00,0x00,0x00,0x00,0x4b,0x9c,0x97,0x80,0x00,
+          0x00,0x00,0x00,0x4c,0xd6,0x4e,0x70,0x00,0x00,0x00,0x00,0x4d,0x7c,0x79,0x80,0x00,0x00,0x00,0x00,0x4e,0xb6,0x30,0x70,0x00,
+          0x00,0x00,0x00,0x4f,0x5c,0x5b,0x80,0x00,0x00,0x00,0x00,0x50,0x96,0x12,0x70,0x00,0x00,0x00,0x00,0x51,0x3c,0x3d,0x80,0x00,
+          0x00,0x00,0x00,0x52,0x75,0xf4,0x70,0x00,0x00,0x00,0x00,0x53,0x1c,0x1f,0x80,0x00,0x00,0x00,0x00,0x54,0x55,0xd6,0x70,0x00,
+          0x00,0x00,0x00,0x54,0xfc,0x01,0x80,0x00,0x00,0x00,0x00,0x56,0x35,0xb8,0x70,0x00,0x00,0x00,0x00,0x56,0xe5,0x1e,0x00,0x00,
+          0x00,0x00,0x00,0x58,0x1e,0xd4,0xf0,0x00,0x00,0x00,0x00,0x58,0xc5,0x00,0x00,0x00,0x00,0x00,0x00,0x59,0xfe,0xb6,0xf0,0x00,
+          0x00,0x00,0x00,0x5a,0xa4,0xe2,0x00,0x00,0x00,0x00,0x00,0x5b,0xde,0x98,0xf0,0x00,0x00,0x00,0x00,0x5c,0x84,0xc4,0x00,0x00,
+          0x00,0x00,0x00,0x5d,0xbe,0x7a,0xf0,0x00,0x00,0x00,0x00,0x5e,0x64,0xa6,0x00,0x00,0x00,0x00,0x00,0x5f,0x9e,0x5c,0xf0,0x00,
+          0x00,0x00,0x00,0x60,0x4d,0xc2,0x80,0x00,0x00,0x00,0x00,0x61,0x87,0x79,0x70,0x00,0x00,0x00,0x00,0x62,0x2d,0xa4,0x80,0x00,
+          0x00,0x00,0x00,0x63,0x67,0x5b,0x70,0x00,0x00,0x00,0x00,0x64,0x0d,0x86,0x80,0x00,0x00,0x00,0x00,0x65,0x47,0x3d,0x70,0x00,
+          0x00,0x00,0x00,0x65,0xed,0x68,0x80,0x00,0x00,0x00,0x00,0x67,0x27,0x1f,0x70,0x00,0x00,0x00,0x00,0x67,0xcd,0x4a,0x80,0x00,
+          0x00,0x00,0x00,0x69,0x07,0x01,0x70,0x00,0x00,0x00,0x00,0x69,0xad,0x2c,0x80,0x00,0x00,0x00,0x00,0x6a,0xe6,0xe3,0x70,0x00,
+          0x00,0x00,0x00,0x6b,0x96,0x49,0x00,0x00,0x00,0x00,0x00,0x6c,0xcf,0xff,0xf0,0x00,0x00,0x00,0x00,0x6d,0x76,0x2b,0x00,0x00,
+          0x00,0x00,0x00,0x6e,0xaf,0xe1,0xf0,0x00,0x00,0x00,0x00,0x6f,0x56,0x0d,0x00,0x00,0x00,0x00,0x00,0x70,0x8f,0xc3,0xf0,0x00,
+          0x00,0x00,0x00,0x71,0x35,0xef,0x00,0x00,0x00,0x00,0x00,0x72,0x6f,0xa5,0xf0,0x00,0x00,0x00,0x00,0x73,0x15,0xd1,0x00,0x00,
+          0x00,0x00,0x00,0x74,0x4f,0x87,0xf0,0x00,0x00,0x00,0x00,0x74,0xfe,0xed,0x80,0x00,0x00,0x00,0x00,0x76,0x38,0xa4,0x70,0x00,
+          0x00,0x00,0x00,0x76,0xde,0xcf,0x80,0x00,0x00,0x00,0x00,0x78,0x18,0x86,0x70,0x00,0x00,0x00,0x00,0x78,0xbe,0xb1,0x80,0x00,
+          0x00,0x00,0x00,0x79,0xf8,0x68,0x70,0x00,0x00,0x00,0x00,0x7a,0x9e,0x93,0x80,0x00,0x00,0x00,0x00,0x7b,0xd8,0x4a,0x70,0x00,
+          0x00,0x00,0x00,0x7c,0x7e,0x75,0x80,0x00,0x00,0x00,0x00,0x7d,0xb8,0x2c,0x70,0x00,0x00,0x00,0x00,0x7e,0x5e,0x57,0x80,0x00,
+          0x00,0x00,0x00,0x7f,0x98,0x0e,0x70,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,
+          0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,
+          0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,
+          0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,
+          0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,
+          0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0xff,
+          0xff,0xab,0xa0,0x00,0x08,0xff,0xff,0xb9,0xb0,0x01,0x04,0x4c,0x4d,0x54,0x00,0x43,0x44,0x54,0x00,0x43,0x53,0x54,0x00,0x45,
+          0x53,0x54,0x00,0x43,0x57,0x54,0x00,0x43,0x50,0x54,0x00,0x0a,0x43,0x53,0x54,0x36,0x43,0x44,0x54,0x2c,0x4d,0x33,0x2e,0x32,
+          0x2e,0x30,0x2c,0x4d,0x31,0x31,0x2e,0x31,0x2e,0x30,0x0a,
+        };
+
+        // America/Denver, 136 transitions
+        static constexpr u8 sZone2[1375] = {
+          0x54,0x5a,0x69,0x66,0x32,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+          0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,
+          0x00,0x00,0x00,0x54,0x5a,0x69,0x66,0x32,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+          0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x88,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x14,0x00,
+          0x00,0x00,0x00,0x00,0x98,0x1b,0x10,0x00,0x00,0x00,0x00,0x01,0x87,0xfe,0x00,0x00,0x00,0x00,0x00,0x02,0x77,0xfd,0x10,0x00,
+          0x00,0x00,0x00,0x03,0x71,0x1a,0x80,0x00,0x00,0x00,0x00,0x04,0x61,0x19,0x90,0x00,0x00,0x00,0x00,0x05,0x50,0xfc,0x80,0x00,
+          0x00,0x00,0x00,0x06,0x40,0xfb,0x90,0x00,0x00,0x00,0x00,0x07,0x30,0xde,0x80,0x00,0x00,0x00,0x00,0x07,0x8d,0x35,0x90,0x00,
+          0x00,0x00,0x00,0x09,0x10,0xc0,0x80,0x00,0x00,0x00,0x00,0x09,0xad,0xb1,0x10,0x00,0x00,0x00,0x00,0x0a,0xf0,0xa2,0x80,0x00,
+          0x00,0x00,0x00,0x0b,0xe0,0xa1,0x90,0x00,0x00,0x00,0x00,0x0c,0xd9,0xbf,0x00,0x00,0x00,0x00,0x00,0x0d,0xc0,0x83,0x90,0x00,
+          0x00,0x00,0x00,0x0e,0xb9,0xa1,0x00,0x00,0x00,0x00,0x00,0x0f,0xa9,0xa0,0x10,0x00,0x00,0x00,0x00,0x10,0x99,0x83,0x00,0x00,
+          0x00,0x00,0x00,0x11,0x89,0x82,0x10,0x00,0x00,0x00,0x00,0x12,0x79,0x65,0x00,0x00,0x00,0x00,0x00,0x13,0x69,0x64,0x10,0x00,
+          0x00,0x00,0x00,0x14,0x59,0x47,0x00,0x00,0x00,0x00,0x00,0x15,0x49,0x46,0x10,0x00,0x00,0x00,0x00,0x16,0x39,0x29,0x00,0x00,
+          0x00,0x00,0x00,0x17,0x29,0x28,0x10,0x00,0x00,0x00,0x00,0x18,0x22,0x45,0x80,0x00,0x00,0x00,0x00,0x19,0x09,0x0a,0x10,0x00,
+          0x00,0x00,0x00,0x1a,0x02,0x27,0x80,0x00,0x00,0x00,0x00,0x1a,0xf2,0x26,0x90,0x00,0x00,0x00,0x00,0x1b,0xe2,0x09,0x80,0x00,
+          0x00,0x00,0x00,0x1c,0xd2,0x08,0x90,0x00,0x00,0x00,0x00,0x1d,0xc1,0xeb,0x80,0x00,0x00,0x00,0x00,0x1e,0xb1,0xea,0x90,0x00,
+          0x00,0x00,0x00,0x1f,0xa1,0xcd,0x80,0x00,0x00,0x00,0x00,0x20,0x76,0x1d,0x10,0x00,0x00,0x00,0x00,0x21,0x81,0xaf,0x80,0x00,
+          0x00,0x00,0x00,0x22,0x55,0xff,0x10,0x00,0x00,0x00,0x00,0x23,0x6a,0xcc,0x00,0x00,0x00,0x00,0x00,0x24,0x35,0xe1,0x10,0x00,
+          0x00,0x00,0x00,0x25,0x4a,0xae,0x00,0x00,0x00,0x00,0x00,0x26,0x15,0xc3,0x10,0x00,0x00,0x00,0x00,0x27,0x2a,0x90,0x00,0x00,
+          0x00,0x00,0x00,0x27,0xfe,0xdf,0x90,0x00,0x00,0x00,0x00,0x29,0x0a,0x72,0x00,0x00,0x00,0x00,0x00,0x29,0xde,0xc1,0x90,0x00,
+          0x00,0x00,0x00,0x2a,0xea,0x54,0x00,0x00,0x00,0x00,0x00,0x2b,0xbe,0xa3,0x90,0x00,0x00,0x00,0x00,0x2c,0xd3,0x70,0x80,0x00,
+          0x00,0x00,0x00,0x2d,0x9e,0x85,0x90,0x00,0x00,0x00,0x00,0x2e,0xb3,0x52,0x80,0x00,0x00,0x00,0x00,0x2f,0x7e,0x67,0x90,0x00,
+          0x00,0x00,0x00,0x30,0x93,0x34,0x80,0x00,0x00,0x00,0x00,0x31,0x67,0x84,0x10,0x00,0x00,0x00,0x00,0x32,0x73,0x16,0x80,0x00,
+          0x00,0x00,0x00,0x33,0x47,0x66,0x10,0x00,0x00,0x00,0x00,0x34,0x52,0xf8,0x80,0x00,0x00,0x00,0x00,0x35,0x27,0x48,0x10,0x00,
+          0x00,0x00,0x00,0x36,0x32,0xda,0x80,0x00,0x00,0x00,0x00,0x37,0x07,0x2a,0x10,0x00,0x00,0x00,0x00,0x38,0x1b,0xf7,0x00,0x00,
+          0x00,0x00,0x00,0x38,0xe7,0x0c,0x10,0x00,0x00,0x00,0x00,0x39,0xfb,0xd9,0x00,0x00,0x00,0x00,0x00,0x3a,0xc6,0xee,0x10,0x00,
+          0x00,0x00,0x00,0x3b,0xdb,0xbb,0x00,0x00,0x00,0x00,0x00,0x3c,0xb0,0x0a,0x90,0x00,0x00,0x00,0x00,0x3d,0xbb,0x9d,0x00,0x00,
+          0x00,0x00,0x00,0x3e,0x8f,0xec,0x90,0x00,0x00,0x00,0x00,0x3f,0x9b,0x7f,0x00,0x00,0x00,0x00,0x00,0x40,0x6f,0xce,0x90,0x00,
+          0x00,0x00,0x00,0x41,0x84,0x9b,0x80,0x00,0x00,0x00,0x00,0x42,0x4f,0xb0,0x90,0x00,0x00,0x00,0x00,0x43,0x64,0x7d,0x80,0x00,
+          0x00,0x00,0x00,0x44,0x2f,0x92,0x90,0x00,0x00,0x00,0x00,0x45,0x44,0x5f,0x80,0x00,0x00,0x00,0x00,0x45,0xf3,0xc5,0x10,0x00,
+          0x00,0x00,0x00,0x47,0x2d,0x7c,0x00,0x00,0x00,0x00,0x00,0x47,0xd3,0xa7,0x10,0x00,0x00,0x00,0x00,0x49,0x0d,0x5e,0x00,0x00,
+          0x00,0x00,0x00,0x49,0xb3,0x89,0x10,0x00,0x00,0x00,0x00,0x4a,0xed,0x40,0x00,0x00,0x00,0x00,0x00,0x4b,0x9c,0xa5,0x90,0x00,
+          0x00,0x00,0x00,0x4c,0xd6,0x5c,0x80,0x00,0x00,0x00,0x00,0x4d,0x7c,0x87,0x90,0x00,0x00,0x00,0x00,0x4e,0xb6,0x3e,0x80,0x00,
+          0x00,0x00,0x00,0x4f,0x5c,0x69,0x90,0x00,0x00,0x00,0x00,0x50,0x96,0x20,0x80,0x00,0x00,0x00,0x00,0x51,0x3c,0x4b,0x90,0x00,
+          0x00,0x00,0x00,0x52,0x76,0x02,0x80,0x00,0x00,0x00,0x00,0x53,0x1c,0x2d,0x90,0x00,0x00,0x00,0x00,0x54,0x55,0xe4,0x80,0x00,
+          0x00,0x00,0x00,0x54,0xfc,0x0f,0x90,0x00,0x00,0x00,0x00,0x56,0x35,0xc6,0x80,0x00,0x00,0x00,0x00,0x56,0xe5,0x2c,0x10,0x00,
+          0x00,0x00,0x00,0x58,0x1e,0xe3,0x00,0x00,0x00,0x00,0x00,0x58,0xc5,0x0e,0x10,0x00,0x00,0x00,0x00,0x59,0xfe,0xc5,0x00,0x00,
+          0x00,0x00,0x00,0x5a,0xa4,0xf0,0x10,0x00,0x00,0x00,0x00,0x5b,0xde,0xa7,0x00,0x00,0x00,0x00,0x00,0x5c,0x84,0xd2,0x10,0x00,
+          0x00,0x00,0x00,0x5d,0xbe,0x89,0x00,0x00,0x00,0x00,0x00,0x5e,0x64,0xb4,0x10,0x00,0x00,0x00,0x00,0x5f,0x9e,0x6b,0x00,0x00,
+          0x00,0x00,0x00,0x60,0x4d,0xd0,0x90,0x00,0x00,0x00,0x00,0x61,0x87,0x87,0x80,0x00,0x00,0x00,0x00,0x62,0x2d,0xb2,0x90,0x00,
+          0x00,0x00,0x00,0x63,0x67,0x69,0x80,0x00,0x00,0x00,0x00,0x64,0x0d,0x94,0x90,0x00,0x00,0x00,0x00,0x65,0x47,0x4b,0x80,0x00,
+          0x00,0x00,0x00,0x65,0xed,0x76,0x90,0x00,0x00,0x00,0x00,0x67,0x27,0x2d,0x80,0x00,0x00,0x00,0x00,0x67,0xcd,0x58,0x90,0x00,
+          0x00,0x00,0x00,0x69,0x07,0x0f,0x80,0x00,0x00,0x00,0x00,0x69,0xad,0x3a,0x90,0x00,0x00,0x00,0x00,0x6a,0xe6,0xf1,0x80,0x00,
+          0x00,0x00,0x00,0x6b,0x96,0x57,0x10,0x00,0x00,0x00,0x00,0x6c,0xd0,0x0e,0x00,0x00,0x00,0x00,0x00,0x6d,0x76,0x39,0x10,0x00,
+          0x00,0x00,0x00,0x6e,0xaf,0xf0,0x00,0x00,0x00,0x00,0x00,0x6f,0x56,0x1b,0x10,0x00,0x00,0x00,0x00,0x70,0x8f,0xd2,0x00,0x00,
+          0x00,0x00,0x00,0x71,0x35,0xfd,0x10,0x00,0x00,0x00,0x00,0x72,0x6f,0xb4,0x00,0x00,0x00,0x00,0x00,0x73,0x15,0xdf,0x10,0x00,
+          0x00,0x00,0x00,0x74,0x4f,0x96,0x00,0x00,0x00,0x00,0x00,0x74,0xfe,0xfb,0x90,0x00,0x00,0x00,0x00,0x76,0x38,0xb2,0x80,0x00,
+          0x00,0x00,0x00,0x76,0xde,0xdd,0x90,0x00,0x00,0x00,0x00,0x78,0x18,0x94,0x80,0x00,0x00,0x00,0x00,0x78,0xbe,0xbf,0x90,0x00,
+          0x00,0x00,0x00,0x79,0xf8,0x76,0x80,0x00,0x00,0x00,0x00,0x7a,0x9e,0xa1,0x90,0x00,0x00,0x00,0x00,0x7b,0xd8,0x58,0x80,0x00,
+          0x00,0x00,0x00,0x7c,0x7e,0x83,0x90,0x00,0x00,0x00,0x00,0x7d,0xb8,0x3a,0x80,0x00,0x00,0x00,0x00,0x7e,0x5e,0x65,0x90,0x00,
+          0x00,0x00,0x00,0x7f,0x98,0x1c,0x80,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,
+          0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,
+          0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,
+          0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,
+          0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,
+          0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0xff,
+          0xff,0x9d,0x90,0x00,0x08,0xff,0xff,0xab,0xa0,0x01,0x04,0x4c,0x4d,0x54,0x00,0x4d,0x44,0x54,0x00,0x4d,0x53,0x54,0x00,0x4d,
+          0x57,0x54,0x00,0x4d,0x50,0x54,0x00,0x0a,0x4d,0x53,0x54,0x37,0x4d,0x44,0x54,0x2c,0x4d,0x33,0x2e,0x32,0x2e,0x30,0x2c,0x4d,
+          0x31,0x31,0x2e,0x31,0x2e,0x30,0x0a,
+        };
+
+        // America/Los_Angeles, 136 transitions
+        static constexpr u8 sZone3[1375] = {
+          0x54,0x5a,0x69,0x66,0x32,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+          0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,
+          0x00,0x00,0x00,0x54,0x5a,0x69,0x66,0x32,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+          0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x88,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x14,0x00,
+          0x00,0x00,0x00,0x00,0x98,0x29,0x20,0x00,0x00,0x00,0x00,0x01,0x88,0x0c,0x10,0x00,0x00,0x00,0x00,0x02,0x78,0x0b,0x20,0x00,
+          0x00,0x00,0x00,0x03,0x71,0x28,0x90,0x00,0x00,0x00,0x00,0x04,0x61,0x27,0xa0,0x00,0x00,0x00,0x00,0x05,0x51,0x0a,0x90,0x00,
+          0x00,0x00,0x00,0x06,0x41,0x09,0xa0,0x00,0x00,0x00,0x00,0x07,0x30,0xec,0x90,0x00,0x00,0x00,0x00,0x07,0x8d,0x43,0xa0,0x00,
+          0x00,0x00,0x00,0x09,0x10,0xce,0x90,0x00,0x00,0x00,0x00,0x09,0xad,0xbf,0x20,0x00,0x00,0x00,0x00,0x0a,0xf0,0xb0,0x90,0x00,
+          0x00,0x00,0x00,0x0b,0xe0,0xaf,0xa0,0x00,0x00,0x00,0x00,0x0c,0xd9,0xcd,0x10,0x00,0x00,0x00,0x00,0x0d,0xc0,0x91,0xa0,0x00,
+          0x00,0x00,0x00,0x0e,0xb9,0xaf,0x10,0x00,0x00,0x00,0x00,0x0f,0xa9,0xae,0x20,0x00,0x00,0x00,0x00,0x10,0x99,0x91,0x10,0x00,
+          0x00,0x00,0x00,0x11,0x89,0x90,0x20,0x00,0x00,0x00,0x00,0x12,0x79,0x73,0x10,0x00,0x00,0x00,0x00,0x13,0x69,0x72,0x20,0x00,
+          0x00,0x00,0x00,0x14,0x59,0x55,0x10,0x00,0x00,0x00,0x00,0x15,0x49,0x54,0x20,0x00,0x00,0x00,0x00,0x16,0x39,0x37,0x10,0x00,
+          0x00,0x00,0x00,0x17,0x29,0x36,0x20,0x00,0x00,0x00,0x00,0x18,0x22,0x53,0x90,0x00,0x00,0x00,0x00,0x19,0x09,0x18,0x20,0x00,
+          0x00,0x00,0x00,0x1a,0x02,0x35,0x90,0x00,0x00,0x00,0x00,0x1a,0xf2,0x34,0xa0,0x00,0x00,0x00,0x00,0x1b,0xe2,0x17,0x90,0x00,
+          0x00,0x00,0x00,0x1c,0xd2,0x16,0xa0,0x00,0x00,0x00,0x00,0x1d,0xc1,0xf9,0x90,0x00,0x00,0x00,0x00,0x1e,0xb1,0xf8,0xa0,0x00,
+          0x00,0x00,0x00,0x1f,0xa1,0xdb,0x90,0x00,0x00,0x00,0x00,0x20,0x76,0x2b,0x20,0x00,0x00,0x00,0x00,0x21,0x81,0xbd,0x90,0x00,
+          0x00,0x00,0x00,0x22,0x56,0x0d,0x20,0x00,0x00,0x00,0x00,0x23,0x6a,0xda,0x10,0x00,0x00,0x00,0x00,0x24,0x35,0xef,0x20,0x00,
+          0x00,0x00,0x00,0x25,0x4a,0xbc,0x10,0x00,0x00,0x00,0x00,0x26,0x15,0xd1,0x20,0x00,0x00,0x00,0x00,0x27,0x2a,0x9e,0x10,0x00,
+          0x00,0x00,0x00,0x27,0xfe,0xed,0xa0,0x00,0x00,0x00,0x00,0x29,0x0a,0x80,0x10,0x00,0x00,0x00,0x00,0x29,0xde,0xcf,0xa0,0x00,
+          0x00,0x00,0x00,0x2a,0xea,0x62,0x10,0x00,0x00,0x00,0x00,0x2b,0xbe,0xb1,0xa0,0x00,0x00,0x00,0x00,0x2c,0xd3,0x7e,0x90,0x00,
+          0x00,0x00,0x00,0x2d,0x9e,0x93,0xa0,0x00,0x00,0x00,0x00,0x2e,0xb3,0x60,0x90,0x00,0x00,0x00,0x00,0x2f,0x7e,0x75,0xa0,0x00,
+          0x00,0x00,0x00,0x30,0x93,0x42,0x90,0x00,0x00,0x00,0x00,0x31,0x67,0x92,0x20,0x00,0x00,0x00,0x00,0x32,0x73,0x24,0x90,0x00,
+          0x00,0x00,0x00,0x33,0x47,0x74,0x20,0x00,0x00,0x00,0x00,0x34,0x53,0x06,0x90,0x00,0x00,0x00,0x00,0x35,0x27,0x56,0x20,0x00,
+          0x00,0x00,0x00,0x36,0x32,0xe8,0x90,0x00,0x00,0x00,0x00,0x37,0x07,0x38,0x20,0x00,0x00,0x00,0x00,0x38,0x1c,0x05,0x10,0x00,
+          0x00,0x00,0x00,0x38,0xe7,0x1a,0x20,0x00,0x00,0x00,0x00,0x39,0xfb,0xe7,0x10,0x00,0x00,0x00,0x00,0x3a,0xc6,0xfc,0x20,0x00,
+          0x00,0x00,0x00,0x3b,0xdb,0xc9,0x10,0x00,0x00,0x00,0x00,0x3c,0xb0,0x18,0xa0,0x00,0x00,0x00,0x00,0x3d,0xbb,0xab,0x10,0x00,
+          0x00,0x00,0x00,0x3e,0x8f,0xfa,0xa0,0x00,0x00,0x00,0x00,0x3f,0x9b,0x8d,0x10,0x00,0x00,0x00,0x00,0x40,0x6f,0xdc,0xa0,0x00,
+          0x00,0x00,0x00,0x41,0x84,0xa9,0x90,0x00,0x00,0x00,0x00,0x42,0x4f,0xbe,0xa0,0x00,0x00,0x00,0x00,0x43,0x64,0x8b,0x90,0x00,
+          0x00,0x00,0x00,0x44,0x2f,0xa0,0xa0,0x00,0x00,0x00,0x00,0x45,0x44,0x6d,0x90,0x00,0x00,0x00,0x00,0x45,0xf3,0xd3,0x20,0x00,
+          0x00,0x00,0x00,0x47,0x2d,0x8a,0x10,0x00,0x00,0x00,0x00,0x47,0xd3,0xb5,0x20,0x00,0x00,0x00,0x00,0x49,0x0d,0x6c,0x10,0x00,
+          0x00,0x00,0x00,0x49,0xb3,0x97,0x20,0x00,0x00,0x00,0x00,0x4a,0xed,0x4e,0x10,0x00,0x00,0x00,0x00,0x4b,0x9c,0xb3,0xa0,0x00,
+          0x00,0x00,0x00,0x4c,0xd6,0x6a,0x90,0x00,0x00,0x00,0x00,0x4d,0x7c,0x95,0xa0,0x00,0x00,0x00,0x00,0x4e,0xb6,0x4c,0x90,0x00,
+          0x00,0x00,0x00,0x4f,0x5c,0x77,0xa0,0x00,0x00,0x00,0x00,0x50,0x96,0x2e,0x90,0x00,0x00,0x00,0x00,0x51,0x3c,0x59,0xa0,0x00,
+          0x00,0x00,0x00,0x52,0x76,0x10,0x90,0x00,0x00,0x00,0x00,0x53,0x1c,0x3b,0xa0,0x00,0x00,0x00,0x00,0x54,0x55,0xf2,0x90,0x00,
+          0x00,0x00,0x00,0x54,0xfc,0x1d,0xa0,0x00,0x00,0x00,0x00,0x56,0x35,0xd4,0x90,0x00,0x00,0x00,0x00,0x56,0xe5,0x3a,0x20,0x00,
+          0x00,0x00,0x00,0x58,0x1e,0xf1,0x10,0x00,0x00,0x00,0x00,0x58,0xc5,0x1c,0x20,0x00,0x00,0x00,0x00,0x59,0xfe,0xd3,0x10,0x00,
+          0x00,0x00,0x00,0x5a,0xa4,0xfe,0x20,0x00,0x00,0x00,0x00,0x5b,0xde,0xb5,0x10,0x00,0x00,0x00,0x00,0x5c,0x84,0xe0,0x20,0x00,
+          0x00,0x00,0x00,0x5d,0xbe,0x97,0x10,0x00,0x00,0x00,0x00,0x5e,0x64,0xc2,0x20,0x00,0x00,0x00,0x00,0x5f,0x9e,0x79,0x10,0x00,
+          0x00,0x00,0x00,0x60,0x4d,0xde,0xa0,0x00,0x00,0x00,0x00,0x61,0x87,0x95,0x90,0x00,0x00,0x00,0x00,0x62,0x2d,0xc0,0xa0,0x00,
+          0x00,0x00,0x00,0x63,0x67,0x77,0x90,0x00,0x00,0x00,0x00,0x64,0x0d,0xa2,0xa0,0x00,0x00,0x00,0x00,0x65,0x47,0x59,0x90,0x00,
+          0x00,0x00,0x00,0x65,0xed,0x84,0xa0,0x00,0x00,0x00,0x00,0x67,0x27,0x3b,0x90,0x00,0x00,0x00,0x00,0x67,0xcd,0x66,0xa0,0x00,
+          0x00,0x00,0x00,0x69,0x07,0x1d,0x90,0x00,0x00,0x00,0x00,0x69,0xad,0x48,0xa0,0x00,0x00,0x00,0x00,0x6a,0xe6,0xff,0x90,0x00,
+          0x00,0x00,0x00,0x6b,0x96,0x65,0x20,0x00,0x00,0x00,0x00,0x6c,0xd0,0x1c,0x10,0x00,0x00,0x00,0x00,0x6d,0x76,0x47,0x20,0x00,
+          0x00,0x00,0x00,0x6e,0xaf,0xfe,0x10,0x00,0x00,0x00,0x00,0x6f,0x56,0x29,0x20,0x00,0x00,0x00,0x00,0x70,0x8f,0xe0,0x10,0x00,
+          0x00,0x00,0x00,0x71,0x36,0x0b,0x20,0x00,0x00,0x00,0x00,0x72,0x6f,0xc2,0x10,0x00,0x00,0x00,0x00,0x73,0x15,0xed,0x20,0x00,
+          0x00,0x00,0x00,0x74,0x4f,0xa4,0x10,0x00,0x00,0x00,0x00,0x74,0xff,0x09,0xa0,0x00,0x00,0x00,0x00,0x76,0x38,0xc0,0x90,0x00,
+          0x00,0x00,0x00,0x76,0xde,0xeb,0xa0,0x00,0x00,0x00,0x00,0x78,0x18,0xa2,0x90,0x00,0x00,0x00,0x00,0x78,0xbe,0xcd,0xa0,0x00,
+          0x00,0x00,0x00,0x79,0xf8,0x84,0x90,0x00,0x00,0x00,0x00,0x7a,0x9e,0xaf,0xa0,0x00,0x00,0x00,0x00,0x7b,0xd8,0x66,0x90,0x00,
+          0x00,0x00,0x00,0x7c,0x7e,0x91,0xa0,0x00,0x00,0x00,0x00,0x7d,0xb8,0x48,0x90,0x00,0x00,0x00,0x00,0x7e,0x5e,0x73,0xa0,0x00,
+          0x00,0x00,0x00,0x7f,0x98,0x2a,0x90,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,
+          0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,
+          0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,
+          0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,
+          0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,
+          0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0xff,
+          0xff,0x8f,0x80,0x00,0x08,0xff,0xff,0x9d,0x90,0x01,0x04,0x4c,0x4d,0x54,0x00,0x50,0x44,0x54,0x00,0x50,0x53,0x54,0x00,0x50,
+          0x57,0x54,0x00,0x50,0x50,0x54,0x00,0x0a,0x50,0x53,0x54,0x38,0x50,0x44,0x54,0x2c,0x4d,0x33,0x2e,0x32,0x2e,0x30,0x2c,0x4d,
+          0x31,0x31,0x2e,0x31,0x2e,0x30,0x0a,
+        };
+
+        // America/New_York, 136 transitions
+        static constexpr u8 sZone4[1375] = {
+          0x54,0x5a,0x69,0x66,0x32,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+          0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,
+          0x00,0x00,0x00,0x54,0x5a,0x69,0x66,0x32,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+          0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x88,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x14,0x00,
+          0x00,0x00,0x00,0x00,0x97,0xfe,0xf0,0x00,0x00,0x00,0x00,0x01,0x87,0xe1,0xe0,0x00,0x00,0x00,0x00,0x02,0x77,0xe0,0xf0,0x00,
+          0x00,0x00,0x00,0x03,0x70,0xfe,0x60,0x00,0x00,0x00,0x00,0x04,0x60,0xfd,0x70,0x00,0x00,0x00,0x00,0x05,0x50,0xe0,0x60,0x00,
+          0x00,0x00,0x00,0x06,0x40,0xdf,0x70,0x00,0x00,0x00,0x00,0x07,0x30,0xc2,0x60,0x00,0x00,0x00,0x00,0x07,0x8d,0x19,0x70,0x00,
+          0x00,0x00,0x00,0x09,0x10,0xa4,0x60,0x00,0x00,0x00,0x00,0x09,0xad,0x94,0xf0,0x00,0x00,0x00,0x00,0x0a,0xf0,0x86,0x60,0x00,
+          0x00,0x00,0x00,0x0b,0xe0,0x85,0x70,0x00,0x00,0x00,0x00,0x0c,0xd9,0xa2,0xe0,0x00,0x00,0x00,0x00,0x0d,0xc0,0x67,0x70,0x00,
+          0x00,0x00,0x00,0x0e,0xb9,0x84,0xe0,0x00,0x00,0x00,0x00,0x0f,0xa9,0x83,0xf0,0x00,0x00,0x00,0x00,0x10,0x99,0x66,0xe0,0x00,
+          0x00,0x00,0x00,0x11,0x89,0x65,0xf0,0x00,0x00,0x00,0x00,0x12,0x79,0x48,0xe0,0x00,0x00,0x00,0x00,0x13,0x69,0x47,0xf0,0x00,
+          0x00,0x00,0x00,0x14,0x59,0x2a,0xe0,0x00,0x00,0x00,0x00,0x15,0x49,0x29,0xf0,0x00,0x00,0x00,0x00,0x16,0x39,0x0c,0xe0,0x00,
+          0x00,0x00,0x00,0x17,0x29,0x0b,0xf0,0x00,0x00,0x00,0x00,0x18,0x22,0x29,0x60,0x00,0x00,0x00,0x00,0x19,0x08,0xed,0xf0,0x00,
+          0x00,0x00,0x00,0x1a,0x02,0x0b,0x60,0x00,0x00,0x00,0x00,0x1a,0xf2,0x0a,0x70,0x00,0x00,0x00,0x00,0x1b,0xe1,0xed,0x60,0x00,
+          0x00,0x00,0x00,0x1c,0xd1,0xec,0x70,0x00,0x00,0x00,0x00,0x1d,0xc1,0xcf,0x60,0x00,0x00,0x00,0x00,0x1e,0xb1,0xce,0x70,0x00,
+          0x00,0x00,0x00,0x1f,0xa1,0xb1,0x60,0x00,0x00,0x00,0x00,0x20,0x76,0x00,0xf0,0x00,0x00,0x00,0x00,0x21,0x81,0x93,0x60,0x00,
+          0x00,0x00,0x00,0x22,0x55,0xe2,0xf0,0x00,0x00,0x00,0x00,0x23,0x6a,0xaf,0xe0,0x00,0x00,0x00,0x00,0x24,0x35,0xc4,0xf0,0x00,
+          0x00,0x00,0x00,0x25,0x4a,0x91,0xe0,0x00,0x00,0x00,0x00,0x26,0x15,0xa6,0xf0,0x00,0x00,0x00,0x00,0x27,0x2a,0x73,0xe0,0x00,
+          0x00,0x00,0x00,0x27,0xfe,0xc3,0x70,0x00,0x00,0x00,0x00,0x29,0x0a,0x55,0xe0,0x00,0x00,0x00,0x00,0x29,0xde,0xa5,0x70,0x00,
+          0x00,0x00,0x00,0x2a,0xea,0x37,0xe0,0x00,0x00,0x00,0x00,0x2b,0xbe,0x87,0x70,0x00,0x00,0x00,0x00,0x2c,0xd3,0x54,0x60,0x00,
+          0x00,0x00,0x00,0x2d,0x9e,0x69,0x70,0x00,0x00,0x00,0x00,0x2e,0xb3,0x36,0x60,0x00,0x00,0x00,0x00,0x2f,0x7e,0x4b,0x70,0x00,
+          0x00,0x00,0x00,0x30,0x93,0x18,0x60,0x00,0x00,0x00,0x00,0x31,0x67,0x67,0xf0,0x00,0x00,0x00,0x00,0x32,0x72,0xfa,0x60,0x00,
+          0x00,0x00,0x00,0x33,0x47,0x49,0xf0,0x00,0x00,0x00,0x00,0x34,0x52,0xdc,0x60,0x00,0x00,0x00,0x00,0x35,0x27,0x2b,0xf0,0x00,
+          0x00,0x00,0x00,0x36,0x32,0xbe,0x60,0x00,0x00,0x00,0x00,0x37,0x07,0x0d,0xf0,0x00,0x00,0x00,0x00,0x38,0x1b,0xda,0xe0,0x00,
+          0x00,0x00,0x00,0x38,0xe6,0xef,0xf0,0x00,0x00,0x00,0x00,0x39,0xfb,0xbc,0xe0,0x00,0x00,0x00,0x00,0x3a,0xc6,0xd1,0xf0,0x00,
+          0x00,0x00,0x00,0x3b,0xdb,0x9e,0xe0,0x00,0x00,0x00,0x00,0x3c,0xaf,0xee,0x70,0x00,0x00,0x00,0x00,0x3d,0xbb,0x80,0xe0,0x00,
+          0x00,0x00,0x00,0x3e,0x8f,0xd0,0x70,0x00,0x00,0x00,0x00,0x3f,0x9b,0x62,0xe0,0x00,0x00,0x00,0x00,0x40,0x6f,0xb2,0x70,0x00,
+          0x00,0x00,0x00,0x41,0x84,0x7f,0x60,0x00,0x00,0x00,0x00,0x42,0x4f,0x94,0x70,0x00,0x00,0x00,0x00,0x43,0x64,0x61,0x60,0x00,
+          0x00,0x00,0x00,0x44,0x2f,0x76,0x70,0x00,0x00,0x00,0x00,0x45,0x44,0x43,0x60,0x00,0x00,0x00,0x00,0x45,0xf3,0xa8,0xf0,0x00,
+          0x00,0x00,0x00,0x47,0x2d,0x5f,0xe0,0x00,0x00,0x00,0x00,0x47,0xd3,0x8a,0xf0,0x00,0x00,0x00,0x00,0x49,0x0d,0x41,0xe0,0x00,
+          0x00,0x00,0x00,0x49,0xb3,0x6c,0xf0,0x00,0x00,0x00,0x00,0x4a,0xed,0x23,0xe0,0x00,0x00,0x00,0x00,0x4b,0x9c,0x89,0x70,0x00,
+          0x00,0x00,0x00,0x4c,0xd6,0x40,0x60,0x00,0x00,0x00,0x00,0x4d,0x7c,0x6b,0x70,0x00,0x00,0x00,0x00,0x4e,0xb6,0x22,0x60,0x00,
+          0x00,0x00,0x00,0x4f,0x5c,0x4d,0x70,0x00,0x00,0x00,0x00,0x50,0x96,0x04,0x60,0x00,0x00,0x00,0x00,0x51,0x3c,0x2f,0x70,0x00,
+          0x00,0x00,0x00,0x52,0x75,0xe6,0x60,0x00,0x00,0x00,0x00,0x53,0x1c,0x11,0x70,0x00,0x00,0x00,0x00,0x54,0x55,0xc8,0x60,0x00,
+          0x00,0x00,0x00,0x54,0xfb,0xf3,0x70,0x00,0x00,0x00,0x00,0x56,0x35,0xaa,0x60,0x00,0x00,0x00,0x00,0x56,0xe5,0x0f,0xf0,0x00,
+          0x00,0x00,0x00,0x58,0x1e,0xc6,0xe0,0x00,0x00,0x00,0x00,0x58,0xc4,0xf1,0xf0,0x00,0x00,0x00,0x00,0x59,0xfe,0xa8,0xe0,0x00,
+          0x00,0x00,0x00,0x5a,0xa4,0xd3,0xf0,0x00,0x00,0x00,0x00,0x5b,0xde,0x8a,0xe0,0x00,0x00,0x00,0x00,0x5c,0x84,0xb5,0xf0,0x00,
+          0x00,0x00,0x00,0x5d,0xbe,0x6c,0xe0,0x00,0x00,0x00,0x00,0x5e,0x64,0x97,0xf0,0x00,0x00,0x00,0x00,0x5f,0x9e,0x4e,0xe0,0x00,
+          0x00,0x00,0x00,0x60,0x4d,0xb4,0x70,0x00,0x00,0x00,0x00,0x61,0x87,0x6b,0x60,0x00,0x00,0x00,0x00,0x62,0x2d,0x96,0x70,0x00,
+          0x00,0x00,0x00,0x63,0x67,0x4d,0x60,0x00,0x00,0x00,0x00,0x64,0x0d,0x78,0x70,0x00,0x00,0x00,0x00,0x65,0x47,0x2f,0x60,0x00,
+          0x00,0x00,0x00,0x65,0xed,0x5a,0x70,0x00,0x00,0x00,0x00,0x67,0x27,0x11,0x60,0x00,0x00,0x00,0x00,0x67,0xcd,0x3c,0x70,0x00,
+          0x00,0x00,0x00,0x69,0x06,0xf3,0x60,0x00,0x00,0x00,0x00,0x69,0xad,0x1e,0x70,0x00,0x00,0x00,0x00,0x6a,0xe6,0xd5,0x60,0x00,
+          0x00,0x00,0x00,0x6b,0x96,0x3a,0xf0,0x00,0x00,0x00,0x00,0x6c,0xcf,0xf1,0xe0,0x00,0x00,0x00,0x00,0x6d,0x76,0x1c,0xf0,0x00,
+          0x00,0x00,0x00,0x6e,0xaf,0xd3,0xe0,0x00,0x00,0x00,0x00,0x6f,0x55,0xfe,0xf0,0x00,0x00,0x00,0x00,0x70,0x8f,0xb5,0xe0,0x00,
+          0x00,0x00,0x00,0x71,0x35,0xe0,0xf0,0x00,0x00,0x00,0x00,0x72,0x6f,0x97,0xe0,0x00,0x00,0x00,0x00,0x73,0x15,0xc2,0xf0,0x00,
+          0x00,0x00,0x00,0x74,0x4f,0x79,0xe0,0x00,0x00,0x00,0x00,0x74,0xfe,0xdf,0x70,0x00,0x00,0x00,0x00,0x76,0x38,0x96,0x60,0x00,
+          0x00,0x00,0x00,0x76,0xde,0xc1,0x70,0x00,0x00,0x00,0x00,0x78,0x18,0x78,0x60,0x00,0x00,0x00,0x00,0x78,0xbe,0xa3,0x70,0x00,
+          0x00,0x00,0x00,0x79,0xf8,0x5a,0x60,0x00,0x00,0x00,0x00,0x7a,0x9e,0x85,0x70,0x00,0x00,0x00,0x00,0x7b,0xd8,0x3c,0x60,0x00,
+          0x00,0x00,0x00,0x7c,0x7e,0x67,0x70,0x00,0x00,0x00,0x00,0x7d,0xb8,0x1e,0x60,0x00,0x00,0x00,0x00,0x7e,0x5e,0x49,0x70,0x00,
+          0x00,0x00,0x00,0x7f,0x98,0x00,0x60,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,
+          0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,
+          0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,
+          0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,
+          0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,
+          0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0xff,
+          0xff,0xb9,0xb0,0x00,0x08,0xff,0xff,0xc7,0xc0,0x01,0x04,0x4c,0x4d,0x54,0x00,0x45,0x44,0x54,0x00,0x45,0x53,0x54,0x00,0x45,
+          0x57,0x54,0x00,0x45,0x50,0x54,0x00,0x0a,0x45,0x53,0x54,0x35,0x45,0x44,0x54,0x2c,0x4d,0x33,0x2e,0x32,0x2e,0x30,0x2c,0x4d,
+          0x31,0x31,0x2e,0x31,0x2e,0x30,0x0a,
+        };
+
+        // America/Sao_Paulo, 69 transitions
+        static constexpr u8 sZone5[748] = {
+          0x54,0x5a,0x69,0x66,0x32,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+          0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,
+          0x00,0x00,0x00,0x54,0x5a,0x69,0x66,0x32,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+          0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x45,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x0c,0x00,
+          0x00,0x00,0x00,0x1d,0xc9,0x8e,0x30,0x00,0x00,0x00,0x00,0x1e,0x78,0xd7,0xa0,0x00,0x00,0x00,0x00,0x1f,0xa0,0x35,0xb0,0x00,
+          0x00,0x00,0x00,0x20,0x33,0xcf,0xa0,0x00,0x00,0x00,0x00,0x21,0x81,0x69,0x30,0x00,0x00,0x00,0x00,0x22,0x0b,0xc8,0xa0,0x00,
+          0x00,0x00,0x00,0x23,0x58,0x10,0xb0,0x00,0x00,0x00,0x00,0x23,0xe2,0x70,0x20,0x00,0x00,0x00,0x00,0x25,0x37,0xf2,0xb0,0x00,
+          0x00,0x00,0x00,0x25,0xd4,0xc7,0x20,0x00,0x00,0x00,0x00,0x27,0x21,0x0f,0x30,0x00,0x00,0x00,0x00,0x27,0xbd,0xe3,0xa0,0x00,
+          0x00,0x00,0x00,0x29,0x00,0xf1,0x30,0x00,0x00,0x00,0x00,0x29,0x94,0x8b,0x20,0x00,0x00,0x00,0x00,0x2a,0xea,0x0d,0xb0,0x00,
+          0x00,0x00,0x00,0x2b,0x6b,0x32,0xa0,0x00,0x00,0x00,0x00,0x2c,0xc0,0xb5,0x30,0x00,0x00,0x00,0x00,0x2d,0x66,0xc4,0x20,0x00,
+          0x00,0x00,0x00,0x2e,0xa0,0x97,0x30,0x00,0x00,0x00,0x00,0x2f,0x46,0xa6,0x20,0x00,0x00,0x00,0x00,0x30,0x80,0x79,0x30,0x00,
+          0x00,0x00,0x00,0x31,0x1d,0x4d,0xa0,0x00,0x00,0x00,0x00,0x32,0x57,0x20,0xb0,0x00,0x00,0x00,0x00,0x33,0x06,0x6a,0x20,0x00,
+          0x00,0x00,0x00,0x34,0x38,0x54,0x30,0x00,0x00,0x00,0x00,0x34,0xf8,0xc1,0x20,0x00,0x00,0x00,0x00,0x36,0x20,0x1f,0x30,0x00,
+          0x00,0x00,0x00,0x36,0xcf,0x68,0xa0,0x00,0x00,0x00,0x00,0x37,0xf6,0xc6,0xb0,0x00,0x00,0x00,0x00,0x38,0xb8,0x85,0x20,0x00,
+          0x00,0x00,0x00,0x39,0xdf,0xe3,0x30,0x00,0x00,0x00,0x00,0x3a,0x8f,0x2c,0xa0,0x00,0x00,0x00,0x00,0x3b,0xc8,0xff,0xb0,0x00,
+          0x00,0x00,0x00,0x3c,0x6f,0x0e,0xa0,0x00,0x00,0x00,0x00,0x3d,0xc4,0x91,0x30,0x00,0x00,0x00,0x00,0x3e,0x4e,0xf0,0xa0,0x00,
+          0x00,0x00,0x00,0x3f,0x91,0xfe,0x30,0x00,0x00,0x00,0x00,0x40,0x2e,0xd2,0xa0,0x00,0x00,0x00,0x00,0x41,0x86,0xf8,0x30,0x00,
+          0x00,0x00,0x00,0x42,0x17,0xef,0x20,0x00,0x00,0x00,0x00,0x43,0x51,0xc2,0x30,0x00,0x00,0x00,0x00,0x43,0xf7,0xd1,0x20,0x00,
+          0x00,0x00,0x00,0x45,0x4d,0x53,0xb0,0x00,0x00,0x00,0x00,0x45,0xe0,0xed,0xa0,0x00,0x00,0x00,0x00,0x47,0x11,0x86,0x30,0x00,
+          0x00,0x00,0x00,0x47,0xb7,0x95,0x20,0x00,0x00,0x00,0x00,0x48,0xfa,0xa2,0xb0,0x00,0x00,0x00,0x00,0x49,0x97,0x77,0x20,0x00,
+          0x00,0x00,0x00,0x4a,0xda,0x84,0xb0,0x00,0x00,0x00,0x00,0x4b,0x80,0x93,0xa0,0x00,0x00,0x00,0x00,0x4c,0xba,0x66,0xb0,0x00,
+          0x00,0x00,0x00,0x4d,0x60,0x75,0xa0,0x00,0x00,0x00,0x00,0x4e,0x9a,0x48,0xb0,0x00,0x00,0x00,0x00,0x4f,0x49,0x92,0x20,0x00,
+          0x00,0x00,0x00,0x50,0x83,0x65,0x30,0x00,0x00,0x00,0x00,0x51,0x20,0x39,0xa0,0x00,0x00,0x00,0x00,0x52,0x63,0x47,0x30,0x00,
+          0x00,0x00,0x00,0x53,0x00,0x1b,0xa0,0x00,0x00,0x00,0x00,0x54,0x43,0x29,0x30,0x00,0x00,0x00,0x00,0x54,0xe9,0x38,0x20,0x00,
+          0x00,0x00,0x00,0x56,0x23,0x0b,0x30,0x00,0x00,0x00,0x00,0x56,0xc9,0x1a,0x20,0x00,0x00,0x00,0x00,0x58,0x02,0xed,0x30,0x00,
+          0x00,0x00,0x00,0x58,0xa8,0xfc,0x20,0x00,0x00,0x00,0x00,0x59,0xe2,0xcf,0x30,0x00,0x00,0x00,0x00,0x5a,0x88,0xde,0x20,0x00,
+          0x00,0x00,0x00,0x5b,0xde,0x60,0xb0,0x00,0x00,0x00,0x00,0x5c,0x68,0xc0,0x20,0x00,0x00,0x00,0x00,0x7f,0xff,0xff,0xff,0x01,
+          0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,
+          0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,
+          0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x00,0xff,0xff,0xd5,0xd0,
+          0x00,0x08,0xff,0xff,0xe3,0xe0,0x01,0x04,0x4c,0x4d,0x54,0x00,0x2d,0x30,0x32,0x00,0x2d,0x30,0x33,0x00,0x0a,0x3c,0x2d,0x30,
+          0x33,0x3e,0x33,0x0a,
+        };
+
+        // Asia/Kolkata, 0 transitions
+        static constexpr u8 sZone6[133] = {
+          0x54,0x5a,0x69,0x66,0x32,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+          0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,
+          0x00,0x00,0x00,0x54,0x5a,0x69,0x66,0x32,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+          0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x16,0x00,
+          0x00,0x4d,0x58,0x00,0x0c,0x4c,0x4d,0x54,0x00,0x48,0x4d,0x54,0x00,0x4d,0x4d,0x54,0x00,0x49,0x53,0x54,0x00,0x2b,0x30,0x36,
+          0x33,0x30,0x00,0x0a,0x49,0x53,0x54,0x2d,0x35,0x3a,0x33,0x30,0x0a,
+        };
+
+        // Asia/Shanghai, 12 transitions
+        static constexpr u8 sZone7[234] = {
+          0x54,0x5a,0x69,0x66,0x32,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+          0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,
+          0x00,0x00,0x00,0x54,0x5a,0x69,0x66,0x32,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+          0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x0c,0x00,
+          0x00,0x00,0x00,0x1e,0xba,0x52,0x20,0x00,0x00,0x00,0x00,0x1f,0x69,0x9b,0x90,0x00,0x00,0x00,0x00,0x20,0x7e,0x84,0xa0,0x00,
+          0x00,0x00,0x00,0x21,0x49,0x7d,0x90,0x00,0x00,0x00,0x00,0x22,0x67,0xa1,0x20,0x00,0x00,0x00,0x00,0x23,0x29,0x5f,0x90,0x00,
+          0x00,0x00,0x00,0x24,0x47,0x83,0x20,0x00,0x00,0x00,0x00,0x25,0x12,0x7c,0x10,0x00,0x00,0x00,0x00,0x26,0x27,0x65,0x20,0x00,
+          0x00,0x00,0x00,0x26,0xf2,0x5e,0x10,0x00,0x00,0x00,0x00,0x28,0x07,0x47,0x20,0x00,0x00,0x00,0x00,0x28,0xd2,0x40,0x10,0x01,
+          0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x00,0x00,0x70,0x80,0x00,0x08,0x00,0x00,0x7e,0x90,0x01,0x04,0x4c,
+          0x4d,0x54,0x00,0x43,0x44,0x54,0x00,0x43,0x53,0x54,0x00,0x0a,0x43,0x53,0x54,0x2d,0x38,0x0a,
+        };
+
+        // Asia/Singapore, 2 transitions
+        static constexpr u8 sZone8[166] = {
+          0x54,0x5a,0x69,0x66,0x32,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+          0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,
+          0x00,0x00,0x00,0x54,0x5a,0x69,0x66,0x32,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+          0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x20,0x00,
+          0x00,0x00,0x00,0x16,0x91,0xee,0x00,0x00,0x00,0x00,0x00,0x7f,0xff,0xff,0xff,0x01,0x01,0x00,0x00,0x69,0x78,0x00,0x12,0x00,
+          0x00,0x70,0x80,0x00,0x1c,0x4c,0x4d,0x54,0x00,0x53,0x4d,0x54,0x00,0x2b,0x30,0x37,0x00,0x2b,0x30,0x37,0x32,0x30,0x00,0x2b,
+          0x30,0x37,0x33,0x30,0x00,0x2b,0x30,0x39,0x00,0x2b,0x30,0x38,0x00,0x0a,0x3c,0x2b,0x30,0x38,0x3e,0x2d,0x38,0x0a,
+        };
+
+        // Asia/Tokyo, 0 transitions
+        static constexpr u8 sZone9[120] = {
+          0x54,0x5a,0x69,0x66,0x32,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+          0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,
+          0x00,0x00,0x00,0x54,0x5a,0x69,0x66,0x32,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+          0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x0c,0x00,
+          0x00,0x7e,0x90,0x00,0x08,0x4c,0x4d,0x54,0x00,0x4a,0x44,0x54,0x00,0x4a,0x53,0x54,0x00,0x0a,0x4a,0x53,0x54,0x2d,0x39,0x0a,
+        };
+
+        // Australia/Sydney, 133 transitions
+        static constexpr u8 sZone10[1348] = {
+          0x54,0x5a,0x69,0x66,0x32,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+          0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,
+          0x00,0x00,0x00,0x54,0x5a,0x69,0x66,0x32,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+          0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x85,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x0e,0x00,
+          0x00,0x00,0x00,0x03,0x70,0x39,0x80,0x00,0x00,0x00,0x00,0x04,0x0d,0x1c,0x00,0x00,0x00,0x00,0x00,0x05,0x50,0x1b,0x80,0x00,
+          0x00,0x00,0x00,0x05,0xf6,0x38,0x80,0x00,0x00,0x00,0x00,0x07,0x2f,0xfd,0x80,0x00,0x00,0x00,0x00,0x07,0xd6,0x1a,0x80,0x00,
+          0x00,0x00,0x00,0x09,0x0f,0xdf,0x80,0x00,0x00,0x00,0x00,0x09,0xb5,0xfc,0x80,0x00,0x00,0x00,0x00,0x0a,0xef,0xc1,0x80,0x00,
+          0x00,0x00,0x00,0x0b,0x9f,0x19,0x00,0x00,0x00,0x00,0x00,0x0c,0xd8,0xde,0x00,0x00,0x00,0x00,0x00,0x0d,0x7e,0xfb,0x00,0x00,
+          0x00,0x00,0x00,0x0e,0xb8,0xc0,0x00,0x00,0x00,0x00,0x00,0x0f,0x5e,0xdd,0x00,0x00,0x00,0x00,0x00,0x10,0x98,0xa2,0x00,0x00,
+          0x00,0x00,0x00,0x11,0x3e,0xbf,0x00,0x00,0x00,0x00,0x00,0x12,0x78,0x84,0x00,0x00,0x00,0x00,0x00,0x13,0x1e,0xa1,0x00,0x00,
+          0x00,0x00,0x00,0x14,0x58,0x66,0x00,0x00,0x00,0x00,0x00,0x14,0xfe,0x83,0x00,0x00,0x00,0x00,0x00,0x16,0x38,0x48,0x00,0x00,
+          0x00,0x00,0x00,0x17,0x0c,0x89,0x80,0x00,0x00,0x00,0x00,0x18,0x21,0x64,0x80,0x00,0x00,0x00,0x00,0x18,0xc7,0x81,0x80,0x00,
+          0x00,0x00,0x00,0x1a,0x01,0x46,0x80,0x00,0x00,0x00,0x00,0x1a,0xa7,0x63,0x80,0x00,0x00,0x00,0x00,0x1b,0xe1,0x28,0x80,0x00,
+          0x00,0x00,0x00,0x1c,0x87,0x45,0x80,0x00,0x00,0x00,0x00,0x1d,0xc1,0x0a,0x80,0x00,0x00,0x00,0x00,0x1e,0x79,0x9c,0x80,0x00,
+          0x00,0x00,0x00,0x1f,0x97,0xb2,0x00,0x00,0x00,0x00,0x00,0x20,0x59,0x7e,0x80,0x00,0x00,0x00,0x00,0x21,0x80,0xce,0x80,0x00,
+          0x00,0x00,0x00,0x22,0x42,0x9b,0x00,0x00,0x00,0x00,0x00,0x23,0x69,0xeb,0x00,0x00,0x00,0x00,0x00,0x24,0x22,0x7d,0x00,0x00,
+          0x00,0x00,0x00,0x25,0x49,0xcd,0x00,0x00,0x00,0x00,0x00,0x25,0xef,0xea,0x00,0x00,0x00,0x00,0x00,0x27,0x29,0xaf,0x00,0x00,
+          0x00,0x00,0x00,0x27,0xcf,0xcc,0x00,0x00,0x00,0x00,0x00,0x29,0x09,0x91,0x00,0x00,0x00,0x00,0x00,0x29,0xaf,0xae,0x00,0x00,
+          0x00,0x00,0x00,0x2a,0xe9,0x73,0x00,0x00,0x00,0x00,0x00,0x2b,0x98,0xca,0x80,0x00,0x00,0x00,0x00,0x2c,0xd2,0x8f,0x80,0x00,
+          0x00,0x00,0x00,0x2d,0x78,0xac,0x80,0x00,0x00,0x00,0x00,0x2e,0xb2,0x71,0x80,0x00,0x00,0x00,0x00,0x2f,0x58,0x8e,0x80,0x00,
+          0x00,0x00,0x00,0x30,0x92,0x53,0x80,0x00,0x00,0x00,0x00,0x31,0x5d,0x5a,0x80,0x00,0x00,0x00,0x00,0x32,0x72,0x35,0x80,0x00,
+          0x00,0x00,0x00,0x33,0x3d,0x3c,0x80,0x00,0x00,0x00,0x00,0x34,0x52,0x17,0x80,0x00,0x00,0x00,0x00,0x35,0x1d,0x1e,0x80,0x00,
+          0x00,0x00,0x00,0x36,0x31,0xf9,0x80,0x00,0x00,0x00,0x00,0x36,0xfd,0x00,0x80,0x00,0x00,0x00,0x00,0x38,0x1b,0x16,0x00,0x00,
+          0x00,0x00,0x00,0x38,0xdc,0xe2,0x80,0x00,0x00,0x00,0x00,0x39,0xa7,0xe9,0x80,0x00,0x00,0x00,0x00,0x3a,0xbc,0xc4,0x80,0x00,
+          0x00,0x00,0x00,0x3b,0xda,0xda,0x00,0x00,0x00,0x00,0x00,0x3c,0xa5,0xe1,0x00,0x00,0x00,0x00,0x00,0x3d,0xba,0xbc,0x00,0x00,
+          0x00,0x00,0x00,0x3e,0x85,0xc3,0x00,0x00,0x00,0x00,0x00,0x3f,0x9a,0x9e,0x00,0x00,0x00,0x00,0x00,0x40,0x65,0xa5,0x00,0x00,
+          0x00,0x00,0x00,0x41,0x83,0xba,0x80,0x00,0x00,0x00,0x00,0x42,0x45,0x87,0x00,0x00,0x00,0x00,0x00,0x43,0x63,0x9c,0x80,0x00,
+          0x00,0x00,0x00,0x44,0x2e,0xa3,0x80,0x00,0x00,0x00,0x00,0x45,0x43,0x7e,0x80,0x00,0x00,0x00,0x00,0x46,0x05,0x4b,0x00,0x00,
+          0x00,0x00,0x00,0x47,0x23,0x60,0x80,0x00,0x00,0x00,0x00,0x47,0xf7,0xa2,0x00,0x00,0x00,0x00,0x00,0x48,0xe7,0x93,0x00,0x00,
+          0x00,0x00,0x00,0x49,0xd7,0x84,0x00,0x00,0x00,0x00,0x00,0x4a,0xc7,0x75,0x00,0x00,0x00,0x00,0x00,0x4b,0xb7,0x66,0x00,0x00,
+          0x00,0x00,0x00,0x4c,0xa7,0x57,0x00,0x00,0x00,0x00,0x00,0x4d,0x97,0x48,0x00,0x00,0x00,0x00,0x00,0x4e,0x87,0x39,0x00,0x00,
+          0x00,0x00,0x00,0x4f,0x77,0x2a,0x00,0x00,0x00,0x00,0x00,0x50,0x70,0x55,0x80,0x00,0x00,0x00,0x00,0x51,0x60,0x46,0x80,0x00,
+          0x00,0x00,0x00,0x52,0x50,0x37,0x80,0x00,0x00,0x00,0x00,0x53,0x40,0x28,0x80,0x00,0x00,0x00,0x00,0x54,0x30,0x19,0x80,0x00,
+          0x00,0x00,0x00,0x55,0x20,0x0a,0x80,0x00,0x00,0x00,0x00,0x56,0x0f,0xfb,0x80,0x00,0x00,0x00,0x00,0x56,0xff,0xec,0x80,0x00,
+          0x00,0x00,0x00,0x57,0xef,0xdd,0x80,0x00,0x00,0x00,0x00,0x58,0xdf,0xce,0x80,0x00,0x00,0x00,0x00,0x59,0xcf,0xbf,0x80,0x00,
+          0x00,0x00,0x00,0x5a,0xbf,0xb0,0x80,0x00,0x00,0x00,0x00,0x5b,0xb8,0xdc,0x00,0x00,0x00,0x00,0x00,0x5c,0xa8,0xcd,0x00,0x00,
+          0x00,0x00,0x00,0x5d,0x98,0xbe,0x00,0x00,0x00,0x00,0x00,0x5e,0x88,0xaf,0x00,0x00,0x00,0x00,0x00,0x5f,0x78,0xa0,0x00,0x00,
+          0x00,0x00,0x00,0x60,0x68,0x91,0x00,0x00,0x00,0x00,0x00,0x61,0x58,0x82,0x00,0x00,0x00,0x00,0x00,0x62,0x48,0x73,0x00,0x00,
+          0x00,0x00,0x00,0x63,0x38,0x64,0x00,0x00,0x00,0x00,0x00,0x64,0x28,0x55,0x00,0x00,0x00,0x00,0x00,0x65,0x18,0x46,0x00,0x00,
+          0x00,0x00,0x00,0x66,0x11,0x71,0x80,0x00,0x00,0x00,0x00,0x67,0x01,0x62,0x80,0x00,0x00,0x00,0x00,0x67,0xf1,0x53,0x80,0x00,
+          0x00,0x00,0x00,0x68,0xe1,0x44,0x80,0x00,0x00,0x00,0x00,0x69,0xd1,0x35,0x80,0x00,0x00,0x00,0x00,0x6a,0xc1,0x26,0x80,0x00,
+          0x00,0x00,0x00,0x6b,0xb1,0x17,0x80,0x00,0x00,0x00,0x00,0x6c,0xa1,0x08,0x80,0x00,0x00,0x00,0x00,0x6d,0x90,0xf9,0x80,0x00,
+          0x00,0x00,0x00,0x6e,0x80,0xea,0x80,0x00,0x00,0x00,0x00,0x6f,0x70,0xdb,0x80,0x00,0x00,0x00,0x00,0x70,0x6a,0x07,0x00,0x00,
+          0x00,0x00,0x00,0x71,0x59,0xf8,0x00,0x00,0x00,0x00,0x00,0x72,0x49,0xe9,0x00,0x00,0x00,0x00,0x00,0x73,0x39,0xda,0x00,0x00,
+          0x00,0x00,0x00,0x74,0x29,0xcb,0x00,0x00,0x00,0x00,0x00,0x75,0x19,0xbc,0x00,0x00,0x00,0x00,0x00,0x76,0x09,0xad,0x00,0x00,
+          0x00,0x00,0x00,0x76,0xf9,0x9e,0x00,0x00,0x00,0x00,0x00,0x77,0xe9,0x8f,0x00,0x00,0x00,0x00,0x00,0x78,0xd9,0x80,0x00,0x00,
+          0x00,0x00,0x00,0x79,0xc9,0x71,0x00,0x00,0x00,0x00,0x00,0x7a,0xb9,0x62,0x00,0x00,0x00,0x00,0x00,0x7b,0xb2,0x8d,0x80,0x00,
+          0x00,0x00,0x00,0x7c,0xa2,0x7e,0x80,0x00,0x00,0x00,0x00,0x7d,0x92,0x6f,0x80,0x00,0x00,0x00,0x00,0x7e,0x82,0x60,0x80,0x00,
+          0x00,0x00,0x00,0x7f,0x72,0x51,0x80,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,
+          0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,
+          0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,
+          0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,
+          0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,
+          0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x00,0x8c,0xa0,
+          0x00,0x09,0x00,0x00,0x9a,0xb0,0x01,0x04,0x4c,0x4d,0x54,0x00,0x41,0x45,0x44,0x54,0x00,0x41,0x45,0x53,0x54,0x00,0x0a,0x41,
+          0x45,0x53,0x54,0x2d,0x31,0x30,0x41,0x45,0x44,0x54,0x2c,0x4d,0x31,0x30,0x2e,0x31,0x2e,0x30,0x2c,0x4d,0x34,0x2e,0x31,0x2e,
+          0x30,0x2f,0x33,0x0a,
+        };
+
+        // Europe/Amsterdam, 122 transitions
+        static constexpr u8 sZone11[1272] = {
+          0x54,0x5a,0x69,0x66,0x32,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+          0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,
+          0x00,0x00,0x00,0x54,0x5a,0x69,0x66,0x32,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+          0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7a,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x21,0x00,
+          0x00,0x00,0x00,0x0d,0xa4,0x63,0x90,0x00,0x00,0x00,0x00,0x0e,0x8b,0x1a,0x10,0x00,0x00,0x00,0x00,0x0f,0x84,0x45,0x90,0x00,
+          0x00,0x00,0x00,0x10,0x74,0x36,0x90,0x00,0x00,0x00,0x00,0x11,0x64,0x27,0x90,0x00,0x00,0x00,0x00,0x12,0x54,0x18,0x90,0x00,
+          0x00,0x00,0x00,0x13,0x4d,0x44,0x10,0x00,0x00,0x00,0x00,0x14,0x33,0xfa,0x90,0x00,0x00,0x00,0x00,0x15,0x23,0xeb,0x90,0x00,
+          0x00,0x00,0x00,0x16,0x13,0xdc,0x90,0x00,0x00,0x00,0x00,0x17,0x03,0xcd,0x90,0x00,0x00,0x00,0x00,0x17,0xf3,0xbe,0x90,0x00,
+          0x00,0x00,0x00,0x18,0xe3,0xaf,0x90,0x00,0x00,0x00,0x00,0x19,0xd3,0xa0,0x90,0x00,0x00,0x00,0x00,0x1a,0xc3,0x91,0x90,0x00,
+          0x00,0x00,0x00,0x1b,0xbc,0xbd,0x10,0x00,0x00,0x00,0x00,0x1c,0xac,0xae,0x10,0x00,0x00,0x00,0x00,0x1d,0x9c,0x9f,0x10,0x00,
+          0x00,0x00,0x00,0x1e,0x8c,0x90,0x10,0x00,0x00,0x00,0x00,0x1f,0x7c,0x81,0x10,0x00,0x00,0x00,0x00,0x20,0x6c,0x72,0x10,0x00,
+          0x00,0x00,0x00,0x21,0x5c,0x63,0x10,0x00,0x00,0x00,0x00,0x22,0x4c,0x54,0x10,0x00,0x00,0x00,0x00,0x23,0x3c,0x45,0x10,0x00,
+          0x00,0x00,0x00,0x24,0x2c,0x36,0x10,0x00,0x00,0x00,0x00,0x25,0x1c,0x27,0x10,0x00,0x00,0x00,0x00,0x26,0x0c,0x18,0x10,0x00,
+          0x00,0x00,0x00,0x27,0x05,0x43,0x90,0x00,0x00,0x00,0x00,0x27,0xf5,0x34,0x90,0x00,0x00,0x00,0x00,0x28,0xe5,0x25,0x90,0x00,
+          0x00,0x00,0x00,0x29,0xd5,0x16,0x90,0x00,0x00,0x00,0x00,0x2a,0xc5,0x07,0x90,0x00,0x00,0x00,0x00,0x2b,0xb4,0xf8,0x90,0x00,
+          0x00,0x00,0x00,0x2c,0xa4,0xe9,0x90,0x00,0x00,0x00,0x00,0x2d,0x94,0xda,0x90,0x00,0x00,0x00,0x00,0x2e,0x84,0xcb,0x90,0x00,
+          0x00,0x00,0x00,0x2f,0x74,0xbc,0x90,0x00,0x00,0x00,0x00,0x30,0x64,0xad,0x90,0x00,0x00,0x00,0x00,0x31,0x5d,0xd9,0x10,0x00,
+          0x00,0x00,0x00,0x32,0x72,0xb4,0x10,0x00,0x00,0x00,0x00,0x33,0x3d,0xbb,0x10,0x00,0x00,0x00,0x00,0x34,0x52,0x96,0x10,0x00,
+          0x00,0x00,0x00,0x35,0x1d,0x9d,0x10,0x00,0x00,0x00,0x00,0x36,0x32,0x78,0x10,0x00,0x00,0x00,0x00,0x36,0xfd,0x7f,0x10,0x00,
+          0x00,0x00,0x00,0x38,0x1b,0x94,0x90,0x00,0x00,0x00,0x00,0x38,0xdd,0x61,0x10,0x00,0x00,0x00,0x00,0x39,0xfb,0x76,0x90,0x00,
+          0x00,0x00,0x00,0x3a,0xbd,0x43,0x10,0x00,0x00,0x00,0x00,0x3b,0xdb,0x58,0x90,0x00,0x00,0x00,0x00,0x3c,0xa6,0x5f,0x90,0x00,
+          0x00,0x00,0x00,0x3d,0xbb,0x3a,0x90,0x00,0x00,0x00,0x00,0x3e,0x86,0x41,0x90,0x00,0x00,0x00,0x00,0x3f,0x9b,0x1c,0x90,0x00,
+          0x00,0x00,0x00,0x40,0x66,0x23,0x90,0x00,0x00,0x00,0x00,0x41,0x84,0x39,0x10,0x00,0x00,0x00,0x00,0x42,0x46,0x05,0x90,0x00,
+          0x00,0x00,0x00,0x43,0x64,0x1b,0x10,0x00,0x00,0x00,0x00,0x44,0x25,0xe7,0x90,0x00,0x00,0x00,0x00,0x45,0x43,0xfd,0x10,0x00,
+          0x00,0x00,0x00,0x46,0x05,0xc9,0x90,0x00,0x00,0x00,0x00,0x47,0x23,0xdf,0x10,0x00,0x00,0x00,0x00,0x47,0xee,0xe6,0x10,0x00,
+          0x00,0x00,0x00,0x49,0x03,0xc1,0x10,0x00,0x00,0x00,0x00,0x49,0xce,0xc8,0x10,0x00,0x00,0x00,0x00,0x4a,0xe3,0xa3,0x10,0x00,
+          0x00,0x00,0x00,0x4b,0xae,0xaa,0x10,0x00,0x00,0x00,0x00,0x4c,0xcc,0xbf,0x90,0x00,0x00,0x00,0x00,0x4d,0x8e,0x8c,0x10,0x00,
+          0x00,0x00,0x00,0x4e,0xac,0xa1,0x90,0x00,0x00,0x00,0x00,0x4f,0x6e,0x6e,0x10,0x00,0x00,0x00,0x00,0x50,0x8c,0x83,0x90,0x00,
+          0x00,0x00,0x00,0x51,0x57,0x8a,0x90,0x00,0x00,0x00,0x00,0x52,0x6c,0x65,0x90,0x00,0x00,0x00,0x00,0x53,0x37,0x6c,0x90,0x00,
+          0x00,0x00,0x00,0x54,0x4c,0x47,0x90,0x00,0x00,0x00,0x00,0x55,0x17,0x4e,0x90,0x00,0x00,0x00,0x00,0x56,0x2c,0x29,0x90,0x00,
+          0x00,0x00,0x00,0x56,0xf7,0x30,0x90,0x00,0x00,0x00,0x00,0x58,0x15,0x46,0x10,0x00,0x00,0x00,0x00,0x58,0xd7,0x12,0x90,0x00,
+          0x00,0x00,0x00,0x59,0xf5,0x28,0x10,0x00,0x00,0x00,0x00,0x5a,0xb6,0xf4,0x90,0x00,0x00,0x00,0x00,0x5b,0xd5,0x0a,0x10,0x00,
+          0x00,0x00,0x00,0x5c,0xa0,0x11,0x10,0x00,0x00,0x00,0x00,0x5d,0xb4,0xec,0x10,0x00,0x00,0x00,0x00,0x5e,0x7f,0xf3,0x10,0x00,
+          0x00,0x00,0x00,0x5f,0x94,0xce,0x10,0x00,0x00,0x00,0x00,0x60,0x5f,0xd5,0x10,0x00,0x00,0x00,0x00,0x61,0x7d,0xea,0x90,0x00,
+          0x00,0x00,0x00,0x62,0x3f,0xb7,0x10,0x00,0x00,0x00,0x00,0x63,0x5d,0xcc,0x90,0x00,0x00,0x00,0x00,0x64,0x1f,0x99,0x10,0x00,
+          0x00,0x00,0x00,0x65,0x3d,0xae,0x90,0x00,0x00,0x00,0x00,0x66,0x08,0xb5,0x90,0x00,0x00,0x00,0x00,0x67,0x1d,0x90,0x90,0x00,
+          0x00,0x00,0x00,0x67,0xe8,0x97,0x90,0x00,0x00,0x00,0x00,0x68,0xfd,0x72,0x90,0x00,0x00,0x00,0x00,0x69,0xc8,0x79,0x90,0x00,
+          0x00,0x00,0x00,0x6a,0xdd,0x54,0x90,0x00,0x00,0x00,0x00,0x6b,0xa8,0x5b,0x90,0x00,0x00,0x00,0x00,0x6c,0xc6,0x71,0x10,0x00,
+          0x00,0x00,0x00,0x6d,0x88,0x3d,0x90,0x00,0x00,0x00,0x00,0x6e,0xa6,0x53,0x10,0x00,0x00,0x00,0x00,0x6f,0x68,0x1f,0x90,0x00,
+          0x00,0x00,0x00,0x70,0x86,0x35,0x10,0x00,0x00,0x00,0x00,0x71,0x51,0x3c,0x10,0x00,0x00,0x00,0x00,0x72,0x66,0x17,0x10,0x00,
+          0x00,0x00,0x00,0x73,0x31,0x1e,0x10,0x00,0x00,0x00,0x00,0x74,0x45,0xf9,0x10,0x00,0x00,0x00,0x00,0x75,0x11,0x00,0x10,0x00,
+          0x00,0x00,0x00,0x76,0x2f,0x15,0x90,0x00,0x00,0x00,0x00,0x76,0xf0,0xe2,0x10,0x00,0x00,0x00,0x00,0x78,0x0e,0xf7,0x90,0x00,
+          0x00,0x00,0x00,0x78,0xd0,0xc4,0x10,0x00,0x00,0x00,0x00,0x79,0xee,0xd9,0x90,0x00,0x00,0x00,0x00,0x7a,0xb0,0xa6,0x10,0x00,
+          0x00,0x00,0x00,0x7b,0xce,0xbb,0x90,0x00,0x00,0x00,0x00,0x7c,0x99,0xc2,0x90,0x00,0x00,0x00,0x00,0x7d,0xae,0x9d,0x90,0x00,
+          0x00,0x00,0x00,0x7e,0x79,0xa4,0x90,0x00,0x00,0x00,0x00,0x7f,0x8e,0x7f,0x90,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,
+          0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,
+          0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,
+          0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,
+          0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,
+          0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x00,0x00,0x0e,0x10,0x00,0x18,0x00,
+          0x00,0x1c,0x20,0x01,0x1c,0x00,0x00,0x0e,0x10,0x00,0x18,0x4c,0x4d,0x54,0x00,0x4e,0x53,0x54,0x00,0x41,0x4d,0x54,0x00,0x2b,
+          0x30,0x30,0x32,0x30,0x00,0x2b,0x30,0x31,0x32,0x30,0x00,0x43,0x45,0x54,0x00,0x43,0x45,0x53,0x54,0x00,0x0a,0x43,0x45,0x54,
+          0x2d,0x31,0x43,0x45,0x53,0x54,0x2c,0x4d,0x33,0x2e,0x35,0x2e,0x30,0x2c,0x4d,0x31,0x30,0x2e,0x35,0x2e,0x30,0x2f,0x33,0x0a,
+        };
+
+        // Europe/Berlin, 116 transitions
+        static constexpr u8 sZone12[1203] = {
+          0x54,0x5a,0x69,0x66,0x32,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+          0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,
+          0x00,0x00,0x00,0x54,0x5a,0x69,0x66,0x32,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+          0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x74,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x12,0x00,
+          0x00,0x00,0x00,0x13,0x4d,0x44,0x10,0x00,0x00,0x00,0x00,0x14,0x33,0xfa,0x90,0x00,0x00,0x00,0x00,0x15,0x23,0xeb,0x90,0x00,
+          0x00,0x00,0x00,0x16,0x13,0xdc,0x90,0x00,0x00,0x00,0x00,0x17,0x03,0xcd,0x90,0x00,0x00,0x00,0x00,0x17,0xf3,0xbe,0x90,0x00,
+          0x00,0x00,0x00,0x18,0xe3,0xaf,0x90,0x00,0x00,0x00,0x00,0x19,0xd3,0xa0,0x90,0x00,0x00,0x00,0x00,0x1a,0xc3,0x91,0x90,0x00,
+          0x00,0x00,0x00,0x1b,0xbc,0xbd,0x10,0x00,0x00,0x00,0x00,0x1c,0xac,0xae,0x10,0x00,0x00,0x00,0x00,0x1d,0x9c,0x9f,0x10,0x00,
+          0x00,0x00,0x00,0x1e,0x8c,0x90,0x10,0x00,0x00,0x00,0x00,0x1f,0x7c,0x81,0x10,0x00,0x00,0x00,0x00,0x20,0x6c,0x72,0x10,0x00,
+          0x00,0x00,0x00,0x21,0x5c,0x63,0x10,0x00,0x00,0x00,0x00,0x22,0x4c,0x54,0x10,0x00,0x00,0x00,0x00,0x23,0x3c,0x45,0x10,0x00,
+          0x00,0x00,0x00,0x24,0x2c,0x36,0x10,0x00,0x00,0x00,0x00,0x25,0x1c,0x27,0x10,0x00,0x00,0x00,0x00,0x26,0x0c,0x18,0x10,0x00,
+          0x00,0x00,0x00,0x27,0x05,0x43,0x90,0x00,0x00,0x00,0x00,0x27,0xf5,0x34,0x90,0x00,0x00,0x00,0x00,0x28,0xe5,0x25,0x90,0x00,
+          0x00,0x00,0x00,0x29,0xd5,0x16,0x90,0x00,0x00,0x00,0x00,0x2a,0xc5,0x07,0x90,0x00,0x00,0x00,0x00,0x2b,0xb4,0xf8,0x90,0x00,
+          0x00,0x00,0x00,0x2c,0xa4,0xe9,0x90,0x00,0x00,0x00,0x00,0x2d,0x94,0xda,0x90,0x00,0x00,0x00,0x00,0x2e,0x84,0xcb,0x90,0x00,
+          0x00,0x00,0x00,0x2f,0x74,0xbc,0x90,0x00,0x00,0x00,0x00,0x30,0x64,0xad,0x90,0x00,0x00,0x00,0x00,0x31,0x5d,0xd9,0x10,0x00,
+          0x00,0x00,0x00,0x32,0x72,0xb4,0x10,0x00,0x00,0x00,0x00,0x33,0x3d,0xbb,0x10,0x00,0x00,0x00,0x00,0x34,0x52,0x96,0x10,0x00,
+          0x00,0x00,0x00,0x35,0x1d,0x9d,0x10,0x00,0x00,0x00,0x00,0x36,0x32,0x78,0x10,0x00,0x00,0x00,0x00,0x36,0xfd,0x7f,0x10,0x00,
+          0x00,0x00,0x00,0x38,0x1b,0x94,0x90,0x00,0x00,0x00,0x00,0x38,0xdd,0x61,0x10,0x00,0x00,0x00,0x00,0x39,0xfb,0x76,0x90,0x00,
+          0x00,0x00,0x00,0x3a,0xbd,0x43,0x10,0x00,0x00,0x00,0x00,0x3b,0xdb,0x58,0x90,0x00,0x00,0x00,0x00,0x3c,0xa6,0x5f,0x90,0x00,
+          0x00,0x00,0x00,0x3d,0xbb,0x3a,0x90,0x00,0x00,0x00,0x00,0x3e,0x86,0x41,0x90,0x00,0x00,0x00,0x00,0x3f,0x9b,0x1c,0x90,0x00,
+          0x00,0x00,0x00,0x40,0x66,0x23,0x90,0x00,0x00,0x00,0x00,0x41,0x84,0x39,0x10,0x00,0x00,0x00,0x00,0x42,0x46,0x05,0x90,0x00,
+          0x00,0x00,0x00,0x43,0x64,0x1b,0x10,0x00,0x00,0x00,0x00,0x44,0x25,0xe7,0x90,0x00,0x00,0x00,0x00,0x45,0x43,0xfd,0x10,0x00,
+          0x00,0x00,0x00,0x46,0x05,0xc9,0x90,0x00,0x00,0x00,0x00,0x47,0x23,0xdf,0x10,0x00,0x00,0x00,0x00,0x47,0xee,0xe6,0x10,0x00,
+          0x00,0x00,0x00,0x49,0x03,0xc1,0x10,0x00,0x00,0x00,0x00,0x49,0xce,0xc8,0x10,0x00,0x00,0x00,0x00,0x4a,0xe3,0xa3,0x10,0x00,
+          0x00,0x00,0x00,0x4b,0xae,0xaa,0x10,0x00,0x00,0x00,0x00,0x4c,0xcc,0xbf,0x90,0x00,0x00,0x00,0x00,0x4d,0x8e,0x8c,0x10,0x00,
+          0x00,0x00,0x00,0x4e,0xac,0xa1,0x90,0x00,0x00,0x00,0x00,0x4f,0x6e,0x6e,0x10,0x00,0x00,0x00,0x00,0x50,0x8c,0x83,0x90,0x00,
+          0x00,0x00,0x00,0x51,0x57,0x8a,0x90,0x00,0x00,0x00,0x00,0x52,0x6c,0x65,0x90,0x00,0x00,0x00,0x00,0x53,0x37,0x6c,0x90,0x00,
+          0x00,0x00,0x00,0x54,0x4c,0x47,0x90,0x00,0x00,0x00,0x00,0x55,0x17,0x4e,0x90,0x00,0x00,0x00,0x00,0x56,0x2c,0x29,0x90,0x00,
+          0x00,0x00,0x00,0x56,0xf7,0x30,0x90,0x00,0x00,0x00,0x00,0x58,0x15,0x46,0x10,0x00,0x00,0x00,0x00,0x58,0xd7,0x12,0x90,0x00,
+          0x00,0x00,0x00,0x59,0xf5,0x28,0x10,0x00,0x00,0x00,0x00,0x5a,0xb6,0xf4,0x90,0x00,0x00,0x00,0x00,0x5b,0xd5,0x0a,0x10,0x00,
+          0x00,0x00,0x00,0x5c,0xa0,0x11,0x10,0x00,0x00,0x00,0x00,0x5d,0xb4,0xec,0x10,0x00,0x00,0x00,0x00,0x5e,0x7f,0xf3,0x10,0x00,
+          0x00,0x00,0x00,0x5f,0x94,0xce,0x10,0x00,0x00,0x00,0x00,0x60,0x5f,0xd5,0x10,0x00,0x00,0x00,0x00,0x61,0x7d,0xea,0x90,0x00,
+          0x00,0x00,0x00,0x62,0x3f,0xb7,0x10,0x00,0x00,0x00,0x00,0x63,0x5d,0xcc,0x90,0x00,0x00,0x00,0x00,0x64,0x1f,0x99,0x10,0x00,
+          0x00,0x00,0x00,0x65,0x3d,0xae,0x90,0x00,0x00,0x00,0x00,0x66,0x08,0xb5,0x90,0x00,0x00,0x00,0x00,0x67,0x1d,0x90,0x90,0x00,
+          0x00,0x00,0x00,0x67,0xe8,0x97,0x90,0x00,0x00,0x00,0x00,0x68,0xfd,0x72,0x90,0x00,0x00,0x00,0x00,0x69,0xc8,0x79,0x90,0x00,
+          0x00,0x00,0x00,0x6a,0xdd,0x54,0x90,0x00,0x00,0x00,0x00,0x6b,0xa8,0x5b,0x90,0x00,0x00,0x00,0x00,0x6c,0xc6,0x71,0x10,0x00,
+          0x00,0x00,0x00,0x6d,0x88,0x3d,0x90,0x00,0x00,0x00,0x00,0x6e,0xa6,0x53,0x10,0x00,0x00,0x00,0x00,0x6f,0x68,0x1f,0x90,0x00,
+          0x00,0x00,0x00,0x70,0x86,0x35,0x10,0x00,0x00,0x00,0x00,0x71,0x51,0x3c,0x10,0x00,0x00,0x00,0x00,0x72,0x66,0x17,0x10,0x00,
+          0x00,0x00,0x00,0x73,0x31,0x1e,0x10,0x00,0x00,0x00,0x00,0x74,0x45,0xf9,0x10,0x00,0x00,0x00,0x00,0x75,0x11,0x00,0x10,0x00,
+          0x00,0x00,0x00,0x76,0x2f,0x15,0x90,0x00,0x00,0x00,0x00,0x76,0xf0,0xe2,0x10,0x00,0x00,0x00,0x00,0x78,0x0e,0xf7,0x90,0x00,
+          0x00,0x00,0x00,0x78,0xd0,0xc4,0x10,0x00,0x00,0x00,0x00,0x79,0xee,0xd9,0x90,0x00,0x00,0x00,0x00,0x7a,0xb0,0xa6,0x10,0x00,
+          0x00,0x00,0x00,0x7b,0xce,0xbb,0x90,0x00,0x00,0x00,0x00,0x7c,0x99,0xc2,0x90,0x00,0x00,0x00,0x00,0x7d,0xae,0x9d,0x90,0x00,
+          0x00,0x00,0x00,0x7e,0x79,0xa4,0x90,0x00,0x00,0x00,0x00,0x7f,0x8e,0x7f,0x90,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,
+          0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,
+          0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,
+          0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,
+          0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,
+          0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x00,0x00,0x0e,0x10,0x00,0x09,0x00,0x00,0x1c,0x20,0x01,0x04,0x00,
+          0x00,0x0e,0x10,0x00,0x09,0x4c,0x4d,0x54,0x00,0x43,0x45,0x53,0x54,0x00,0x43,0x45,0x54,0x00,0x43,0x45,0x4d,0x54,0x00,0x0a,
+          0x43,0x45,0x54,0x2d,0x31,0x43,0x45,0x53,0x54,0x2c,0x4d,0x33,0x2e,0x35,0x2e,0x30,0x2c,0x4d,0x31,0x30,0x2e,0x35,0x2e,0x30,
+          0x2f,0x33,0x0a,
+        };
+
+        // Europe/London, 133 transitions
+        static constexpr u8 sZone13[1365] = {
+          0x54,0x5a,0x69,0x66,0x32,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+          0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,
+          0x00,0x00,0x00,0x54,0x5a,0x69,0x66,0x32,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+          0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x85,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x11,0x00,
+          0x00,0x00,0x00,0x03,0x70,0xc6,0x20,0x00,0x00,0x00,0x00,0x04,0x29,0x58,0x20,0x00,0x00,0x00,0x00,0x05,0x50,0xa8,0x20,0x00,
+          0x00,0x00,0x00,0x06,0x09,0x3a,0x20,0x00,0x00,0x00,0x00,0x07,0x30,0x8a,0x20,0x00,0x00,0x00,0x00,0x07,0xe9,0x1c,0x20,0x00,
+          0x00,0x00,0x00,0x09,0x10,0x6c,0x20,0x00,0x00,0x00,0x00,0x09,0xc8,0xfe,0x20,0x00,0x00,0x00,0x00,0x0a,0xf0,0x4e,0x20,0x00,
+          0x00,0x00,0x00,0x0b,0xb2,0x1a,0xa0,0x00,0x00,0x00,0x00,0x0c,0xd0,0x30,0x20,0x00,0x00,0x00,0x00,0x0d,0x91,0xfc,0xa0,0x00,
+          0x00,0x00,0x00,0x0e,0xb0,0x12,0x20,0x00,0x00,0x00,0x00,0x0f,0x71,0xde,0xa0,0x00,0x00,0x00,0x00,0x10,0x99,0x2e,0xa0,0x00,
+          0x00,0x00,0x00,0x11,0x51,0xc0,0xa0,0x00,0x00,0x00,0x00,0x12,0x79,0x10,0xa0,0x00,0x00,0x00,0x00,0x13,0x31,0xa2,0xa0,0x00,
+          0x00,0x00,0x00,0x14,0x58,0xf2,0xa0,0x00,0x00,0x00,0x00,0x15,0x23,0xeb,0x90,0x00,0x00,0x00,0x00,0x16,0x38,0xc6,0x90,0x00,
+          0x00,0x00,0x00,0x17,0x03,0xcd,0x90,0x00,0x00,0x00,0x00,0x18,0x18,0xa8,0x90,0x00,0x00,0x00,0x00,0x18,0xe3,0xaf,0x90,0x00,
+          0x00,0x00,0x00,0x19,0xf8,0x8a,0x90,0x00,0x00,0x00,0x00,0x1a,0xc3,0x91,0x90,0x00,0x00,0x00,0x00,0x1b,0xe1,0xa7,0x10,0x00,
+          0x00,0x00,0x00,0x1c,0xac,0xae,0x10,0x00,0x00,0x00,0x00,0x1d,0xc1,0x89,0x10,0x00,0x00,0x00,0x00,0x1e,0x8c,0x90,0x10,0x00,
+          0x00,0x00,0x00,0x1f,0xa1,0x6b,0x10,0x00,0x00,0x00,0x00,0x20,0x6c,0x72,0x10,0x00,0x00,0x00,0x00,0x21,0x81,0x4d,0x10,0x00,
+          0x00,0x00,0x00,0x22,0x4c,0x54,0x10,0x00,0x00,0x00,0x00,0x23,0x61,0x2f,0x10,0x00,0x00,0x00,0x00,0x24,0x2c,0x36,0x10,0x00,
+          0x00,0x00,0x00,0x25,0x4a,0x4b,0x90,0x00,0x00,0x00,0x00,0x26,0x0c,0x18,0x10,0x00,0x00,0x00,0x00,0x27,0x2a,0x2d,0x90,0x00,
+          0x00,0x00,0x00,0x27,0xf5,0x34,0x90,0x00,0x00,0x00,0x00,0x29,0x0a,0x0f,0x90,0x00,0x00,0x00,0x00,0x29,0xd5,0x16,0x90,0x00,
+          0x00,0x00,0x00,0x2a,0xe9,0xf1,0x90,0x00,0x00,0x00,0x00,0x2b,0xb4,0xf8,0x90,0x00,0x00,0x00,0x00,0x2c,0xc9,0xd3,0x90,0x00,
+          0x00,0x00,0x00,0x2d,0x94,0xda,0x90,0x00,0x00,0x00,0x00,0x2e,0xa9,0xb5,0x90,0x00,0x00,0x00,0x00,0x2f,0x74,0xbc,0x90,0x00,
+          0x00,0x00,0x00,0x30,0x89,0x97,0x90,0x00,0x00,0x00,0x00,0x31,0x5d,0xd9,0x10,0x00,0x00,0x00,0x00,0x32,0x72,0xb4,0x10,0x00,
+          0x00,0x00,0x00,0x33,0x3d,0xbb,0x10,0x00,0x00,0x00,0x00,0x34,0x52,0x96,0x10,0x00,0x00,0x00,0x00,0x35,0x1d,0x9d,0x10,0x00,
+          0x00,0x00,0x00,0x36,0x32,0x78,0x10,0x00,0x00,0x00,0x00,0x36,0xfd,0x7f,0x10,0x00,0x00,0x00,0x00,0x38,0x1b,0x94,0x90,0x00,
+          0x00,0x00,0x00,0x38,0xdd,0x61,0x10,0x00,0x00,0x00,0x00,0x39,0xfb,0x76,0x90,0x00,0x00,0x00,0x00,0x3a,0xbd,0x43,0x10,0x00,
+          0x00,0x00,0x00,0x3b,0xdb,0x58,0x90,0x00,0x00,0x00,0x00,0x3c,0xa6,0x5f,0x90,0x00,0x00,0x00,0x00,0x3d,0xbb,0x3a,0x90,0x00,
+          0x00,0x00,0x00,0x3e,0x86,0x41,0x90,0x00,0x00,0x00,0x00,0x3f,0x9b,0x1c,0x90,0x00,0x00,0x00,0x00,0x40,0x66,0x23,0x90,0x00,
+          0x00,0x00,0x00,0x41,0x84,0x39,0x10,0x00,0x00,0x00,0x00,0x42,0x46,0x05,0x90,0x00,0x00,0x00,0x00,0x43,0x64,0x1b,0x10,0x00,
+          0x00,0x00,0x00,0x44,0x25,0xe7,0x90,0x00,0x00,0x00,0x00,0x45,0x43,0xfd,0x10,0x00,0x00,0x00,0x00,0x46,0x05,0xc9,0x90,0x00,
+          0x00,0x00,0x00,0x47,0x23,0xdf,0x10,0x00,0x00,0x00,0x00,0x47,0xee,0xe6,0x10,0x00,0x00,0x00,0x00,0x49,0x03,0xc1,0x10,0x00,
+          0x00,0x00,0x00,0x49,0xce,0xc8,0x10,0x00,0x00,0x00,0x00,0x4a,0xe3,0xa3,0x10,0x00,0x00,0x00,0x00,0x4b,0xae,0xaa,0x10,0x00,
+          0x00,0x00,0x00,0x4c,0xcc,0xbf,0x90,0x00,0x00,0x00,0x00,0x4d,0x8e,0x8c,0x10,0x00,0x00,0x00,0x00,0x4e,0xac,0xa1,0x90,0x00,
+          0x00,0x00,0x00,0x4f,0x6e,0x6e,0x10,0x00,0x00,0x00,0x00,0x50,0x8c,0x83,0x90,0x00,0x00,0x00,0x00,0x51,0x57,0x8a,0x90,0x00,
+          0x00,0x00,0x00,0x52,0x6c,0x65,0x90,0x00,0x00,0x00,0x00,0x53,0x37,0x6c,0x90,0x00,0x00,0x00,0x00,0x54,0x4c,0x47,0x90,0x00,
+          0x00,0x00,0x00,0x55,0x17,0x4e,0x90,0x00,0x00,0x00,0x00,0x56,0x2c,0x29,0x90,0x00,0x00,0x00,0x00,0x56,0xf7,0x30,0x90,0x00,
+          0x00,0x00,0x00,0x58,0x15,0x46,0x10,0x00,0x00,0x00,0x00,0x58,0xd7,0x12,0x90,0x00,0x00,0x00,0x00,0x59,0xf5,0x28,0x10,0x00,
+          0x00,0x00,0x00,0x5a,0xb6,0xf4,0x90,0x00,0x00,0x00,0x00,0x5b,0xd5,0x0a,0x10,0x00,0x00,0x00,0x00,0x5c,0xa0,0x11,0x10,0x00,
+          0x00,0x00,0x00,0x5d,0xb4,0xec,0x10,0x00,0x00,0x00,0x00,0x5e,0x7f,0xf3,0x10,0x00,0x00,0x00,0x00,0x5f,0x94,0xce,0x10,0x00,
+          0x00,0x00,0x00,0x60,0x5f,0xd5,0x10,0x00,0x00,0x00,0x00,0x61,0x7d,0xea,0x90,0x00,0x00,0x00,0x00,0x62,0x3f,0xb7,0x10,0x00,
+          0x00,0x00,0x00,0x63,0x5d,0xcc,0x90,0x00,0x00,0x00,0x00,0x64,0x1f,0x99,0x10,0x00,0x00,0x00,0x00,0x65,0x3d,0xae,0x90,0x00,
+          0x00,0x00,0x00,0x66,0x08,0xb5,0x90,0x00,0x00,0x00,0x00,0x67,0x1d,0x90,0x90,0x00,0x00,0x00,0x00,0x67,0xe8,0x97,0x90,0x00,
+          0x00,0x00,0x00,0x68,0xfd,0x72,0x90,0x00,0x00,0x00,0x00,0x69,0xc8,0x79,0x90,0x00,0x00,0x00,0x00,0x6a,0xdd,0x54,0x90,0x00,
+          0x00,0x00,0x00,0x6b,0xa8,0x5b,0x90,0x00,0x00,0x00,0x00,0x6c,0xc6,0x71,0x10,0x00,0x00,0x00,0x00,0x6d,0x88,0x3d,0x90,0x00,
+          0x00,0x00,0x00,0x6e,0xa6,0x53,0x10,0x00,0x00,0x00,0x00,0x6f,0x68,0x1f,0x90,0x00,0x00,0x00,0x00,0x70,0x86,0x35,0x10,0x00,
+          0x00,0x00,0x00,0x71,0x51,0x3c,0x10,0x00,0x00,0x00,0x00,0x72,0x66,0x17,0x10,0x00,0x00,0x00,0x00,0x73,0x31,0x1e,0x10,0x00,
+          0x00,0x00,0x00,0x74,0x45,0xf9,0x10,0x00,0x00,0x00,0x00,0x75,0x11,0x00,0x10,0x00,0x00,0x00,0x00,0x76,0x2f,0x15,0x90,0x00,
+          0x00,0x00,0x00,0x76,0xf0,0xe2,0x10,0x00,0x00,0x00,0x00,0x78,0x0e,0xf7,0x90,0x00,0x00,0x00,0x00,0x78,0xd0,0xc4,0x10,0x00,
+          0x00,0x00,0x00,0x79,0xee,0xd9,0x90,0x00,0x00,0x00,0x00,0x7a,0xb0,0xa6,0x10,0x00,0x00,0x00,0x00,0x7b,0xce,0xbb,0x90,0x00,
+          0x00,0x00,0x00,0x7c,0x99,0xc2,0x90,0x00,0x00,0x00,0x00,0x7d,0xae,0x9d,0x90,0x00,0x00,0x00,0x00,0x7e,0x79,0xa4,0x90,0x00,
+          0x00,0x00,0x00,0x7f,0x8e,0x7f,0x90,0x01,0x02,0x03,0x02,0x03,0x02,0x03,0x02,0x03,0x02,0x03,0x02,0x03,0x02,0x03,0x02,0x03,
+          0x02,0x03,0x04,0x01,0x04,0x01,0x04,0x01,0x04,0x01,0x04,0x01,0x04,0x01,0x04,0x01,0x04,0x01,0x04,0x01,0x04,0x01,0x04,0x01,
+          0x04,0x01,0x04,0x01,0x04,0x01,0x04,0x01,0x04,0x01,0x04,0x01,0x04,0x01,0x04,0x01,0x04,0x01,0x04,0x01,0x04,0x01,0x04,0x01,
+          0x04,0x01,0x04,0x01,0x04,0x01,0x04,0x01,0x04,0x01,0x04,0x01,0x04,0x01,0x04,0x01,0x04,0x01,0x04,0x01,0x04,0x01,0x04,0x01,
+          0x04,0x01,0x04,0x01,0x04,0x01,0x04,0x01,0x04,0x01,0x04,0x01,0x04,0x01,0x04,0x01,0x04,0x01,0x04,0x01,0x04,0x01,0x04,0x01,
+          0x04,0x01,0x04,0x01,0x04,0x01,0x04,0x01,0x04,0x01,0x04,0x01,0x04,0x01,0x04,0x01,0x04,0x01,0x04,0x01,0x00,0x00,0x0e,0x10,
+          0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x0e,0x10,0x01,0x04,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x0e,0x10,
+          0x01,0x04,0x4c,0x4d,0x54,0x00,0x42,0x53,0x54,0x00,0x47,0x4d,0x54,0x00,0x42,0x44,0x53,0x54,0x00,0x0a,0x47,0x4d,0x54,0x30,
+          0x42,0x53,0x54,0x2c,0x4d,0x33,0x2e,0x35,0x2e,0x30,0x2f,0x31,0x2c,0x4d,0x31,0x30,0x2e,0x35,0x2e,0x30,0x0a,
+        };
+
+        // Europe/Paris, 124 transitions
+        static constexpr u8 sZone14[1294] = {
+          0x54,0x5a,0x69,0x66,0x32,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+          0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,
+          0x00,0x00,0x00,0x54,0x5a,0x69,0x66,0x32,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+          0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x1f,0x00,
+          0x00,0x00,0x00,0x0b,0xbb,0x39,0x00,0x00,0x00,0x00,0x00,0x0c,0xab,0x1b,0xf0,0x00,0x00,0x00,0x00,0x0d,0xa4,0x63,0x90,0x00,
+          0x00,0x00,0x00,0x0e,0x8b,0x1a,0x10,0x00,0x00,0x00,0x00,0x0f,0x84,0x45,0x90,0x00,0x00,0x00,0x00,0x10,0x74,0x36,0x90,0x00,
+          0x00,0x00,0x00,0x11,0x64,0x27,0x90,0x00,0x00,0x00,0x00,0x12,0x54,0x18,0x90,0x00,0x00,0x00,0x00,0x13,0x4d,0x44,0x10,0x00,
+          0x00,0x00,0x00,0x14,0x33,0xfa,0x90,0x00,0x00,0x00,0x00,0x15,0x23,0xeb,0x90,0x00,0x00,0x00,0x00,0x16,0x13,0xdc,0x90,0x00,
+          0x00,0x00,0x00,0x17,0x03,0xcd,0x90,0x00,0x00,0x00,0x00,0x17,0xf3,0xbe,0x90,0x00,0x00,0x00,0x00,0x18,0xe3,0xaf,0x90,0x00,
+          0x00,0x00,0x00,0x19,0xd3,0xa0,0x90,0x00,0x00,0x00,0x00,0x1a,0xc3,0x91,0x90,0x00,0x00,0x00,0x00,0x1b,0xbc,0xbd,0x10,0x00,
+          0x00,0x00,0x00,0x1c,0xac,0xae,0x10,0x00,0x00,0x00,0x00,0x1d,0x9c,0x9f,0x10,0x00,0x00,0x00,0x00,0x1e,0x8c,0x90,0x10,0x00,
+          0x00,0x00,0x00,0x1f,0x7c,0x81,0x10,0x00,0x00,0x00,0x00,0x20,0x6c,0x72,0x10,0x00,0x00,0x00,0x00,0x21,0x5c,0x63,0x10,0x00,
+          0x00,0x00,0x00,0x22,0x4c,0x54,0x10,0x00,0x00,0x00,0x00,0x23,0x3c,0x45,0x10,0x00,0x00,0x00,0x00,0x24,0x2c,0x36,0x10,0x00,
+          0x00,0x00,0x00,0x25,0x1c,0x27,0x10,0x00,0x00,0x00,0x00,0x26,0x0c,0x18,0x10,0x00,0x00,0x00,0x00,0x27,0x05,0x43,0x90,0x00,
+          0x00,0x00,0x00,0x27,0xf5,0x34,0x90,0x00,0x00,0x00,0x00,0x28,0xe5,0x25,0x90,0x00,0x00,0x00,0x00,0x29,0xd5,0x16,0x90,0x00,
+          0x00,0x00,0x00,0x2a,0xc5,0x07,0x90,0x00,0x00,0x00,0x00,0x2b,0xb4,0xf8,0x90,0x00,0x00,0x00,0x00,0x2c,0xa4,0xe9,0x90,0x00,
+          0x00,0x00,0x00,0x2d,0x94,0xda,0x90,0x00,0x00,0x00,0x00,0x2e,0x84,0xcb,0x90,0x00,0x00,0x00,0x00,0x2f,0x74,0xbc,0x90,0x00,
+          0x00,0x00,0x00,0x30,0x64,0xad,0x90,0x00,0x00,0x00,0x00,0x31,0x5d,0xd9,0x10,0x00,0x00,0x00,0x00,0x32,0x72,0xb4,0x10,0x00,
+          0x00,0x00,0x00,0x33,0x3d,0xbb,0x10,0x00,0x00,0x00,0x00,0x34,0x52,0x96,0x10,0x00,0x00,0x00,0x00,0x35,0x1d,0x9d,0x10,0x00,
+          0x00,0x00,0x00,0x36,0x32,0x78,0x10,0x00,0x00,0x00,0x00,0x36,0xfd,0x7f,0x10,0x00,0x00,0x00,0x00,0x38,0x1b,0x94,0x90,0x00,
+          0x00,0x00,0x00,0x38,0xdd,0x61,0x10,0x00,0x00,0x00,0x00,0x39,0xfb,0x76,0x90,0x00,0x00,0x00,0x00,0x3a,0xbd,0x43,0x10,0x00,
+          0x00,0x00,0x00,0x3b,0xdb,0x58,0x90,0x00,0x00,0x00,0x00,0x3c,0xa6,0x5f,0x90,0x00,0x00,0x00,0x00,0x3d,0xbb,0x3a,0x90,0x00,
+          0x00,0x00,0x00,0x3e,0x86,0x41,0x90,0x00,0x00,0x00,0x00,0x3f,0x9b,0x1c,0x90,0x00,0x00,0x00,0x00,0x40,0x66,0x23,0x90,0x00,
+          0x00,0x00,0x00,0x41,0x84,0x39,0x10,0x00,0x00,0x00,0x00,0x42,0x46,0x05,0x90,0x00,0x00,0x00,0x00,0x43,0x64,0x1b,0x10,0x00,
+          0x00,0x00,0x00,0x44,0x25,0xe7,0x90,0x00,0x00,0x00,0x00,0x45,0x43,0xfd,0x10,0x00,0x00,0x00,0x00,0x46,0x05,0xc9,0x90,0x00,
+          0x00,0x00,0x00,0x47,0x23,0xdf,0x10,0x00,0x00,0x00,0x00,0x47,0xee,0xe6,0x10,0x00,0x00,0x00,0x00,0x49,0x03,0xc1,0x10,0x00,
+          0x00,0x00,0x00,0x49,0xce,0xc8,0x10,0x00,0x00,0x00,0x00,0x4a,0xe3,0xa3,0x10,0x00,0x00,0x00,0x00,0x4b,0xae,0xaa,0x10,0x00,
+          0x00,0x00,0x00,0x4c,0xcc,0xbf,0x90,0x00,0x00,0x00,0x00,0x4d,0x8e,0x8c,0x10,0x00,0x00,0x00,0x00,0x4e,0xac,0xa1,0x90,0x00,
+          0x00,0x00,0x00,0x4f,0x6e,0x6e,0x10,0x00,0x00,0x00,0x00,0x50,0x8c,0x83,0x90,0x00,0x00,0x00,0x00,0x51,0x57,0x8a,0x90,0x00,
+          0x00,0x00,0x00,0x52,0x6c,0x65,0x90,0x00,0x00,0x00,0x00,0x53,0x37,0x6c,0x90,0x00,0x00,0x00,0x00,0x54,0x4c,0x47,0x90,0x00,
+          0x00,0x00,0x00,0x55,0x17,0x4e,0x90,0x00,0x00,0x00,0x00,0x56,0x2c,0x29,0x90,0x00,0x00,0x00,0x00,0x56,0xf7,0x30,0x90,0x00,
+          0x00,0x00,0x00,0x58,0x15,0x46,0x10,0x00,0x00,0x00,0x00,0x58,0xd7,0x12,0x90,0x00,0x00,0x00,0x00,0x59,0xf5,0x28,0x10,0x00,
+          0x00,0x00,0x00,0x5a,0xb6,0xf4,0x90,0x00,0x00,0x00,0x00,0x5b,0xd5,0x0a,0x10,0x00,0x00,0x00,0x00,0x5c,0xa0,0x11,0x10,0x00,
+          0x00,0x00,0x00,0x5d,0xb4,0xec,0x10,0x00,0x00,0x00,0x00,0x5e,0x7f,0xf3,0x10,0x00,0x00,0x00,0x00,0x5f,0x94,0xce,0x10,0x00,
+          0x00,0x00,0x00,0x60,0x5f,0xd5,0x10,0x00,0x00,0x00,0x00,0x61,0x7d,0xea,0x90,0x00,0x00,0x00,0x00,0x62,0x3f,0xb7,0x10,0x00,
+          0x00,0x00,0x00,0x63,0x5d,0xcc,0x90,0x00,0x00,0x00,0x00,0x64,0x1f,0x99,0x10,0x00,0x00,0x00,0x00,0x65,0x3d,0xae,0x90,0x00,
+          0x00,0x00,0x00,0x66,0x08,0xb5,0x90,0x00,0x00,0x00,0x00,0x67,0x1d,0x90,0x90,0x00,0x00,0x00,0x00,0x67,0xe8,0x97,0x90,0x00,
+          0x00,0x00,0x00,0x68,0xfd,0x72,0x90,0x00,0x00,0x00,0x00,0x69,0xc8,0x79,0x90,0x00,0x00,0x00,0x00,0x6a,0xdd,0x54,0x90,0x00,
+          0x00,0x00,0x00,0x6b,0xa8,0x5b,0x90,0x00,0x00,0x00,0x00,0x6c,0xc6,0x71,0x10,0x00,0x00,0x00,0x00,0x6d,0x88,0x3d,0x90,0x00,
+          0x00,0x00,0x00,0x6e,0xa6,0x53,0x10,0x00,0x00,0x00,0x00,0x6f,0x68,0x1f,0x90,0x00,0x00,0x00,0x00,0x70,0x86,0x35,0x10,0x00,
+          0x00,0x00,0x00,0x71,0x51,0x3c,0x10,0x00,0x00,0x00,0x00,0x72,0x66,0x17,0x10,0x00,0x00,0x00,0x00,0x73,0x31,0x1e,0x10,0x00,
+          0x00,0x00,0x00,0x74,0x45,0xf9,0x10,0x00,0x00,0x00,0x00,0x75,0x11,0x00,0x10,0x00,0x00,0x00,0x00,0x76,0x2f,0x15,0x90,0x00,
+          0x00,0x00,0x00,0x76,0xf0,0xe2,0x10,0x00,0x00,0x00,0x00,0x78,0x0e,0xf7,0x90,0x00,0x00,0x00,0x00,0x78,0xd0,0xc4,0x10,0x00,
+          0x00,0x00,0x00,0x79,0xee,0xd9,0x90,0x00,0x00,0x00,0x00,0x7a,0xb0,0xa6,0x10,0x00,0x00,0x00,0x00,0x7b,0xce,0xbb,0x90,0x00,
+          0x00,0x00,0x00,0x7c,0x99,0xc2,0x90,0x00,0x00,0x00,0x00,0x7d,0xae,0x9d,0x90,0x00,0x00,0x00,0x00,0x7e,0x79,0xa4,0x90,0x00,
+          0x00,0x00,0x00,0x7f,0x8e,0x7f,0x90,0x01,0x00,0x02,0x03,0x02,0x03,0x02,0x03,0x02,0x03,0x02,0x03,0x02,0x03,0x02,0x03,0x02,
+          0x03,0x02,0x03,0x02,0x03,0x02,0x03,0x02,0x03,0x02,0x03,0x02,0x03,0x02,0x03,0x02,0x03,0x02,0x03,0x02,0x03,0x02,0x03,0x02,
+          0x03,0x02,0x03,0x02,0x03,0x02,0x03,0x02,0x03,0x02,0x03,0x02,0x03,0x02,0x03,0x02,0x03,0x02,0x03,0x02,0x03,0x02,0x03,0x02,
+          0x03,0x02,0x03,0x02,0x03,0x02,0x03,0x02,0x03,0x02,0x03,0x02,0x03,0x02,0x03,0x02,0x03,0x02,0x03,0x02,0x03,0x02,0x03,0x02,
+          0x03,0x02,0x03,0x02,0x03,0x02,0x03,0x02,0x03,0x02,0x03,0x02,0x03,0x02,0x03,0x02,0x03,0x02,0x03,0x02,0x03,0x02,0x03,0x02,
+          0x03,0x02,0x03,0x02,0x03,0x02,0x03,0x02,0x03,0x02,0x03,0x00,0x00,0x0e,0x10,0x00,0x11,0x00,0x00,0x1c,0x20,0x01,0x15,0x00,
+          0x00,0x1c,0x20,0x01,0x15,0x00,0x00,0x0e,0x10,0x00,0x11,0x4c,0x4d,0x54,0x00,0x50,0x4d,0x54,0x00,0x57,0x45,0x53,0x54,0x00,
+          0x57,0x45,0x54,0x00,0x43,0x45,0x54,0x00,0x43,0x45,0x53,0x54,0x00,0x57,0x45,0x4d,0x54,0x00,0x0a,0x43,0x45,0x54,0x2d,0x31,
+          0x43,0x45,0x53,0x54,0x2c,0x4d,0x33,0x2e,0x35,0x2e,0x30,0x2c,0x4d,0x31,0x30,0x2e,0x35,0x2e,0x30,0x2f,0x33,0x0a,
+        };
+
+        // Pacific/Auckland, 127 transitions
+        static constexpr u8 sZone15[1304] = {
+          0x54,0x5a,0x69,0x66,0x32,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+          0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,
+          0x00,0x00,0x00,0x54,0x5a,0x69,0x66,0x32,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+          0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x13,0x00,
+          0x00,0x00,0x00,0x09,0x18,0xfd,0xe0,0x00,0x00,0x00,0x00,0x09,0xac,0xa5,0xe0,0x00,0x00,0x00,0x00,0x0a,0xef,0xa5,0x60,0x00,
+          0x00,0x00,0x00,0x0b,0x9e,0xfc,0xe0,0x00,0x00,0x00,0x00,0x0c,0xd8,0xc1,0xe0,0x00,0x00,0x00,0x00,0x0d,0x7e,0xde,0xe0,0x00,
+          0x00,0x00,0x00,0x0e,0xb8,0xa3,0xe0,0x00,0x00,0x00,0x00,0x0f,0x5e,0xc0,0xe0,0x00,0x00,0x00,0x00,0x10,0x98,0x85,0xe0,0x00,
+          0x00,0x00,0x00,0x11,0x3e,0xa2,0xe0,0x00,0x00,0x00,0x00,0x12,0x78,0x67,0xe0,0x00,0x00,0x00,0x00,0x13,0x1e,0x84,0xe0,0x00,
+          0x00,0x00,0x00,0x14,0x58,0x49,0xe0,0x00,0x00,0x00,0x00,0x14,0xfe,0x66,0xe0,0x00,0x00,0x00,0x00,0x16,0x38,0x2b,0xe0,0x00,
+          0x00,0x00,0x00,0x16,0xe7,0x83,0x60,0x00,0x00,0x00,0x00,0x18,0x21,0x48,0x60,0x00,0x00,0x00,0x00,0x18,0xc7,0x65,0x60,0x00,
+          0x00,0x00,0x00,0x1a,0x01,0x2a,0x60,0x00,0x00,0x00,0x00,0x1a,0xa7,0x47,0x60,0x00,0x00,0x00,0x00,0x1b,0xe1,0x0c,0x60,0x00,
+          0x00,0x00,0x00,0x1c,0x87,0x29,0x60,0x00,0x00,0x00,0x00,0x1d,0xc0,0xee,0x60,0x00,0x00,0x00,0x00,0x1e,0x67,0x0b,0x60,0x00,
+          0x00,0x00,0x00,0x1f,0xa0,0xd0,0x60,0x00,0x00,0x00,0x00,0x20,0x46,0xed,0x60,0x00,0x00,0x00,0x00,0x21,0x80,0xb2,0x60,0x00,
+          0x00,0x00,0x00,0x22,0x30,0x09,0xe0,0x00,0x00,0x00,0x00,0x23,0x69,0xce,0xe0,0x00,0x00,0x00,0x00,0x24,0x0f,0xeb,0xe0,0x00,
+          0x00,0x00,0x00,0x25,0x2e,0x01,0x60,0x00,0x00,0x00,0x00,0x26,0x02,0x42,0xe0,0x00,0x00,0x00,0x00,0x27,0x0d,0xe3,0x60,0x00,
+          0x00,0x00,0x00,0x27,0xe2,0x24,0xe0,0x00,0x00,0x00,0x00,0x28,0xed,0xc5,0x60,0x00,0x00,0x00,0x00,0x29,0xc2,0x06,0xe0,0x00,
+          0x00,0x00,0x00,0x2a,0xcd,0xa7,0x60,0x00,0x00,0x00,0x00,0x2b,0xab,0x23,0x60,0x00,0x00,0x00,0x00,0x2c,0xad,0x89,0x60,0x00,
+          0x00,0x00,0x00,0x2d,0x8b,0x05,0x60,0x00,0x00,0x00,0x00,0x2e,0x8d,0x6b,0x60,0x00,0x00,0x00,0x00,0x2f,0x6a,0xe7,0x60,0x00,
+          0x00,0x00,0x00,0x30,0x6d,0x4d,0x60,0x00,0x00,0x00,0x00,0x31,0x4a,0xc9,0x60,0x00,0x00,0x00,0x00,0x32,0x56,0x69,0xe0,0x00,
+          0x00,0x00,0x00,0x33,0x2a,0xab,0x60,0x00,0x00,0x00,0x00,0x34,0x36,0x4b,0xe0,0x00,0x00,0x00,0x00,0x35,0x0a,0x8d,0x60,0x00,
+          0x00,0x00,0x00,0x36,0x16,0x2d,0xe0,0x00,0x00,0x00,0x00,0x36,0xf3,0xa9,0xe0,0x00,0x00,0x00,0x00,0x37,0xf6,0x0f,0xe0,0x00,
+          0x00,0x00,0x00,0x38,0xd3,0x8b,0xe0,0x00,0x00,0x00,0x00,0x39,0xd5,0xf1,0xe0,0x00,0x00,0x00,0x00,0x3a,0xb3,0x6d,0xe0,0x00,
+          0x00,0x00,0x00,0x3b,0xbf,0x0e,0x60,0x00,0x00,0x00,0x00,0x3c,0x93,0x4f,0xe0,0x00,0x00,0x00,0x00,0x3d,0x9e,0xf0,0x60,0x00,
+          0x00,0x00,0x00,0x3e,0x73,0x31,0xe0,0x00,0x00,0x00,0x00,0x3f,0x7e,0xd2,0x60,0x00,0x00,0x00,0x00,0x40,0x5c,0x4e,0x60,0x00,
+          0x00,0x00,0x00,0x41,0x5e,0xb4,0x60,0x00,0x00,0x00,0x00,0x42,0x3c,0x30,0x60,0x00,0x00,0x00,0x00,0x43,0x3e,0x96,0x60,0x00,
+          0x00,0x00,0x00,0x44,0x1c,0x12,0x60,0x00,0x00,0x00,0x00,0x45,0x1e,0x78,0x60,0x00,0x00,0x00,0x00,0x45,0xfb,0xf4,0x60,0x00,
+          0x00,0x00,0x00,0x46,0xfe,0x5a,0x60,0x00,0x00,0x00,0x00,0x47,0xf7,0x85,0xe0,0x00,0x00,0x00,0x00,0x48,0xde,0x3c,0x60,0x00,
+          0x00,0x00,0x00,0x49,0xd7,0x67,0xe0,0x00,0x00,0x00,0x00,0x4a,0xbe,0x1e,0x60,0x00,0x00,0x00,0x00,0x4b,0xb7,0x49,0xe0,0x00,
+          0x00,0x00,0x00,0x4c,0x9e,0x00,0x60,0x00,0x00,0x00,0x00,0x4d,0x97,0x2b,0xe0,0x00,0x00,0x00,0x00,0x4e,0x7d,0xe2,0x60,0x00,
+          0x00,0x00,0x00,0x4f,0x77,0x0d,0xe0,0x00,0x00,0x00,0x00,0x50,0x66,0xfe,0xe0,0x00,0x00,0x00,0x00,0x51,0x60,0x2a,0x60,0x00,
+          0x00,0x00,0x00,0x52,0x46,0xe0,0xe0,0x00,0x00,0x00,0x00,0x53,0x40,0x0c,0x60,0x00,0x00,0x00,0x00,0x54,0x26,0xc2,0xe0,0x00,
+          0x00,0x00,0x00,0x55,0x1f,0xee,0x60,0x00,0x00,0x00,0x00,0x56,0x06,0xa4,0xe0,0x00,0x00,0x00,0x00,0x56,0xff,0xd0,0x60,0x00,
+          0x00,0x00,0x00,0x57,0xe6,0x86,0xe0,0x00,0x00,0x00,0x00,0x58,0xdf,0xb2,0x60,0x00,0x00,0x00,0x00,0x59,0xc6,0x68,0xe0,0x00,
+          0x00,0x00,0x00,0x5a,0xbf,0x94,0x60,0x00,0x00,0x00,0x00,0x5b,0xaf,0x85,0x60,0x00,0x00,0x00,0x00,0x5c,0xa8,0xb0,0xe0,0x00,
+          0x00,0x00,0x00,0x5d,0x8f,0x67,0x60,0x00,0x00,0x00,0x00,0x5e,0x88,0x92,0xe0,0x00,0x00,0x00,0x00,0x5f,0x6f,0x49,0x60,0x00,
+          0x00,0x00,0x00,0x60,0x68,0x74,0xe0,0x00,0x00,0x00,0x00,0x61,0x4f,0x2b,0x60,0x00,0x00,0x00,0x00,0x62,0x48,0x56,0xe0,0x00,
+          0x00,0x00,0x00,0x63,0x2f,0x0d,0x60,0x00,0x00,0x00,0x00,0x64,0x28,0x38,0xe0,0x00,0x00,0x00,0x00,0x65,0x0e,0xef,0x60,0x00,
+          0x00,0x00,0x00,0x66,0x11,0x55,0x60,0x00,0x00,0x00,0x00,0x66,0xf8,0x0b,0xe0,0x00,0x00,0x00,0x00,0x67,0xf1,0x37,0x60,0x00,
+          0x00,0x00,0x00,0x68,0xd7,0xed,0xe0,0x00,0x00,0x00,0x00,0x69,0xd1,0x19,0x60,0x00,0x00,0x00,0x00,0x6a,0xb7,0xcf,0xe0,0x00,
+          0x00,0x00,0x00,0x6b,0xb0,0xfb,0x60,0x00,0x00,0x00,0x00,0x6c,0x97,0xb1,0xe0,0x00,0x00,0x00,0x00,0x6d,0x90,0xdd,0x60,0x00,
+          0x00,0x00,0x00,0x6e,0x77,0x93,0xe0,0x00,0x00,0x00,0x00,0x6f,0x70,0xbf,0x60,0x00,0x00,0x00,0x00,0x70,0x60,0xb0,0x60,0x00,
+          0x00,0x00,0x00,0x71,0x59,0xdb,0xe0,0x00,0x00,0x00,0x00,0x72,0x40,0x92,0x60,0x00,0x00,0x00,0x00,0x73,0x39,0xbd,0xe0,0x00,
+          0x00,0x00,0x00,0x74,0x20,0x74,0x60,0x00,0x00,0x00,0x00,0x75,0x19,0x9f,0xe0,0x00,0x00,0x00,0x00,0x76,0x00,0x56,0x60,0x00,
+          0x00,0x00,0x00,0x76,0xf9,0x81,0xe0,0x00,0x00,0x00,0x00,0x77,0xe0,0x38,0x60,0x00,0x00,0x00,0x00,0x78,0xd9,0x63,0xe0,0x00,
+          0x00,0x00,0x00,0x79,0xc0,0x1a,0x60,0x00,0x00,0x00,0x00,0x7a,0xb9,0x45,0xe0,0x00,0x00,0x00,0x00,0x7b,0xa9,0x36,0xe0,0x00,
+          0x00,0x00,0x00,0x7c,0xa2,0x62,0x60,0x00,0x00,0x00,0x00,0x7d,0x89,0x18,0xe0,0x00,0x00,0x00,0x00,0x7e,0x82,0x44,0x60,0x00,
+          0x00,0x00,0x00,0x7f,0x68,0xfa,0xe0,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,
+          0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,
+          0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,
+          0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,
+          0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,
+          0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x00,0x00,0xa8,0xc0,0x00,0x04,0x00,0x00,0xb6,0xd0,
+          0x01,0x0e,0x00,0x00,0xa8,0xc0,0x00,0x04,0x4c,0x4d,0x54,0x00,0x4e,0x5a,0x53,0x54,0x00,0x4e,0x5a,0x4d,0x54,0x00,0x4e,0x5a,
+          0x44,0x54,0x00,0x0a,0x4e,0x5a,0x53,0x54,0x2d,0x31,0x32,0x4e,0x5a,0x44,0x54,0x2c,0x4d,0x39,0x2e,0x35,0x2e,0x30,0x2c,0x4d,
+          0x34,0x2e,0x31,0x2e,0x30,0x2f,0x33,0x0a,
+        };
+
+        static constexpr timezone_data_t sZones[] = {
+          {"Africa/Johannesburg", sZone0, sizeof(sZone0)},
+          {"America/Chicago", sZone1, sizeof(sZone1)},
+          {"America/Denver", sZone2, sizeof(sZone2)},
+          {"America/Los_Angeles", sZone3, sizeof(sZone3)},
+          {"America/New_York", sZone4, sizeof(sZone4)},
+          {"America/Sao_Paulo", sZone5, sizeof(sZone5)},
+          {"Asia/Kolkata", sZone6, sizeof(sZone6)},
+          {"Asia/Shanghai", sZone7, sizeof(sZone7)},
+          {"Asia/Singapore", sZone8, sizeof(sZone8)},
+          {"Asia/Tokyo", sZone9, sizeof(sZone9)},
+          {"Australia/Sydney", sZone10, sizeof(sZone10)},
+          {"Europe/Amsterdam", sZone11, sizeof(sZone11)},
+          {"Europe/Berlin", sZone12, sizeof(sZone12)},
+          {"Europe/London", sZone13, sizeof(sZone13)},
+          {"Europe/Paris", sZone14, sizeof(sZone14)},
+          {"Pacific/Auckland", sZone15, sizeof(sZone15)},
+        };
+    } // namespace ntzdata
+
+    namespace ntime
+    {
+        const timezone_data_t* getBuiltinZones(s32& count)
+        {
+            count = 16;
+            return ntzdata::sZones;
+        }
+    } // namespace ntime
+} // namespace ncore
@@ -0,0 +1,100 @@
+#ifndef __CTIME_CRON_H__
+#define __CTIME_CRON_H__
+#include "ccore/c_target.h"
+#ifdef USE_PRAGMA_ONCE
+#    pragma once
+#endif
+
+#include "ctime/c_datetime.h"
+
+namespace ncore
+{
+    class timezone_t;
+
+    /**
+     * ------------------------------------------------------------------------------
+     *  Description:
+     *      A compiled cron expression, 5 fields (minute hour day-of-month month
+     *      day-of-week) or 6 fields (second first). Every field is a comma separated
+     *      list of '*', '?', values, ranges ('a-b', wrapping around when a > b) and
+     *      steps ('a-b/n', 'a/n' from a up to the maximum, or '/n' after '*'). Months
+     *      and days of the week also take their 3 letter names (JAN-DEC, SUN-SAT),
+     *      Sunday is 0 or 7. The macros @yearly, @annually, @monthly, @weekly, @daily,
+     *      @midnight and @hourly are accepted as well.
+     *
+     *      Day of month takes 'L' (the last day), 'L-n' (n days before the last day),
+     *      'nW' (the weekday nearest to day n, within the month) and 'LW' (the last
+     *      weekday). Day of week takes 'dL' (the last d-day of the month) and 'd#n'
+     *      (the n-th d-day of the month). When both day fields are restricted a day
+     *      matches either of them, as in Vixie cron.
+     *
+     *      Every field compiles into a bitset. next() and prev() do not step through
+     *      the calendar, they find the next (previous) set bit of a field and only
+     *      move to the next (previous) value of the field above it when there is
+     *      none. The days of a month are computed as one bitset from the number of
+     *      days in the month and the day of the week of its first day.
+     *
+     *      Without a time zone the fields are matched against the datetime_t as is.
+     *      With one, 'after' and 'before' are UTC and the fields are matched against
+     *      the local time of the zone. A local time skipped by a gap fires at the
+     *      same time after the gap (moved forward by its length), a local time that
+     *      occurs twice fires once, at its first instant.
+     *
+     *  Example:
+     * <CODE>
+     *       cron_t cron;
+     *       if (cron.parse("0 30 2 L-1 * ?"))
+     *       {
+     *           datetime_t when;
+     *           if (cron.next(datetime_t::sNowUtc(), when, timezone_t::sFind("Europe/Amsterdam")))
+     *               ...
+     *       }
+     * </CODE>
+     * ------------------------------------------------------------------------------
+     */
+    class cron_t
+    {
+    public:
+        cron_t();
+
+        bool parse(const char* str);          ///< Zero terminated
+        bool parse(const char* str, s32 len); ///< False when it is invalid, the schedule is left as it was
+        void reset();                         ///< Matches every minute, as "* * * * *"
+
+        ///@name The first fire time strictly after 'after' (before 'before'), false when there is none
+        bool next(datetime_t after, datetime_t& out, const timezone_t* tz = nullptr) const;
+        bool prev(datetime_t before, datetime_t& out, const timezone_t* tz = nullptr) const;
+
+        bool matches(datetime_t time) const; ///< Matched to the second, sub-second ticks are ignored
+
+        ///@name Batch, the next fire time of 'count' schedules after the same instant, returns the
+        ///      number found. Schedules without one have their bit set in 'failMask' (optional,
+        ///      (count + 63) / 64 words) and their output set to datetime_t::sMaxValue.
+        static s64 sNext(const cron_t* crons, s64 count, datetime_t after, datetime_t* out, u64* failMask = nullptr, const timezone_t* tz = nullptr);
+
+    private:
+        struct civil_t;
+
+        bool parseField(s32 field, const char* str, s32 len);
+        bool parseItem(s32 field, const char* str, s32 len);
+        u32  daysOf(s32 year, s32 month) const; ///< Bit d set when day d of the month matches
+        bool nextCivil(civil_t& c) const;       ///< The first match at or after 'c'
+        bool prevCivil(civil_t& c) const;       ///< The last match at or before 'c'
+        bool nextFrom(const civil_t& start, datetime_t after, datetime_t& out, const timezone_t* tz) const;
+
+        u64 mSeconds;      ///< Bits 0 - 59
+        u64 mMinutes;      ///< Bits 0 - 59
+        u64 mNthWeekdays;  ///< Bit (n - 1) * 7 + d for 'd#n'
+        u32 mHours;        ///< Bits 0 - 23
+        u32 mDays;         ///< Bits 1 - 31
+        u32 mNearestDays;  ///< Bit n for 'nW'
+        u32 mLastDays;     ///< Bit n for 'L-n', bit 0 for 'L'
+        u16 mMonths;       ///< Bits 1 - 12
+        u8  mWeekdays;     ///< Bits 0 - 6, 0 = Sunday
+        u8  mLastWeekdays; ///< Bit d for 'dL'
+        u8  mFlags;
+    };
+
+}; // namespace ncore
+
+#endif
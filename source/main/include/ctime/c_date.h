@@ -0,0 +1,137 @@
+#ifndef __CTIME_DATE_H__
+#define __CTIME_DATE_H__
+#include "ccore/c_target.h"
+#ifdef USE_PRAGMA_ONCE
+#    pragma once
+#endif
+
+#include "ctime/c_datetime.h"
+
+namespace ncore
+{
+    class time_of_day_t;
+
+    /**
+     * ------------------------------------------------------------------------------
+     *  Description:
+     *      A calendar date without a time of day, stored as the s32 number of days
+     *      since 0001-01-01 (the day number of datetime_t). Half the size of a
+     *      datetime_t, made for date-only columns.
+     * ------------------------------------------------------------------------------
+     */
+    class date_t
+    {
+    public:
+        date_t();
+        date_t(s32 year, s32 month, s32 day);
+        explicit date_t(datetime_t dt); ///< The date part
+
+        datetime_t toDateTime() const; ///< At midnight
+        datetime_t toDateTime(time_of_day_t tod) const;
+
+        s32        dayNumber() const { return mDays; }
+        s32        year() const;
+        EMonth     month() const;
+        s32        day() const;
+        EDayOfWeek dayOfWeek() const;
+        s32        dayOfYear() const;
+        void       decompose(s32& year, s32& month, s32& day) const;
+
+        date_t& addDays(s32 value);
+        date_t& addMonths(s32 months); ///< The day is clamped to the last day of the resulting month
+        date_t& addYears(s32 value);
+        s32     subtract(date_t value) const { return mDays - value.mDays; } ///< In days
+
+        s32  compareTo(const date_t& value) const { return sCompare(*this, value); }
+        bool equals(const date_t& value) const { return mDays == value.mDays; }
+
+        static date_t sFromDayNumber(s32 days);
+        static date_t sToday();
+
+        static s32 sCompare(const date_t& d1, const date_t& d2) { return (d1.mDays < d2.mDays) ? -1 : ((d1.mDays > d2.mDays) ? 1 : 0); }
+
+        static const date_t sMaxValue; ///< 9999-12-31
+        static const date_t sMinValue; ///< 0001-01-01
+
+    private:
+        s32 mDays;
+    };
+
+    inline bool operator<(const date_t& d1, const date_t& d2) { return d1.dayNumber() < d2.dayNumber(); }
+    inline bool operator>(const date_t& d1, const date_t& d2) { return d1.dayNumber() > d2.dayNumber(); }
+    inline bool operator<=(const date_t& d1, const date_t& d2) { return d1.dayNumber() <= d2.dayNumber(); }
+    inline bool operator>=(const date_t& d1, const date_t& d2) { return d1.dayNumber() >= d2.dayNumber(); }
+    inline bool operator!=(const date_t& d1, const date_t& d2) { return d1.dayNumber() != d2.dayNumber(); }
+    inline bool operator==(const date_t& d1, const date_t& d2) { return d1.dayNumber() == d2.dayNumber(); }
+
+    /**
+     * ------------------------------------------------------------------------------
+     *  Description:
+     *      A time of day without a date, stored as the u32 number of 100 microsecond
+     *      units since midnight (0 to 863999999). Arithmetic wraps around midnight.
+     * ------------------------------------------------------------------------------
+     */
+    class time_of_day_t
+    {
+    public:
+        enum
+        {
+            TicksPerUnit   = 1000,
+            UnitsPerSecond = 10000,
+            UnitsPerDay    = 864000000,
+        };
+
+        time_of_day_t();
+        time_of_day_t(s32 hour, s32 minute, s32 second);
+        time_of_day_t(s32 hour, s32 minute, s32 second, s32 millisecond);
+        explicit time_of_day_t(datetime_t dt); ///< The time part, truncated to 100 microseconds
+
+        u32 units() const { return mUnits; }
+        s64 ticks() const { return (s64)mUnits * TicksPerUnit; }
+        s32 hour() const;
+        s32 minute() const;
+        s32 second() const;
+        s32 millisecond() const;
+        s32 microsecond() const; ///< 0 to 999, a multiple of 100
+        void decompose(s32& hour, s32& minute, s32& second, s32& millisecond) const;
+
+        time_of_day_t& addHours(s32 value);
+        time_of_day_t& addMinutes(s32 value);
+        time_of_day_t& addSeconds(s32 value);
+        time_of_day_t& addMilliseconds(s32 value);
+        s32            subtract(time_of_day_t value) const { return (s32)mUnits - (s32)value.mUnits; } ///< In 100 microsecond units
+
+        s32  compareTo(const time_of_day_t& value) const { return sCompare(*this, value); }
+        bool equals(const time_of_day_t& value) const { return mUnits == value.mUnits; }
+
+        static time_of_day_t sFromUnits(u32 units);
+
+        static s32 sCompare(const time_of_day_t& t1, const time_of_day_t& t2) { return (t1.mUnits < t2.mUnits) ? -1 : ((t1.mUnits > t2.mUnits) ? 1 : 0); }
+
+        static const time_of_day_t sMidnight;
+        static const time_of_day_t sMaxValue; ///< 23:59:59.9999
+
+    private:
+        time_of_day_t& addUnits(s64 units);
+
+        u32 mUnits;
+    };
+
+    inline bool operator<(const time_of_day_t& t1, const time_of_day_t& t2) { return t1.units() < t2.units(); }
+    inline bool operator>(const time_of_day_t& t1, const time_of_day_t& t2) { return t1.units() > t2.units(); }
+    inline bool operator<=(const time_of_day_t& t1, const time_of_day_t& t2) { return t1.units() <= t2.units(); }
+    inline bool operator>=(const time_of_day_t& t1, const time_of_day_t& t2) { return t1.units() >= t2.units(); }
+    inline bool operator!=(const time_of_day_t& t1, const time_of_day_t& t2) { return t1.units() != t2.units(); }
+    inline bool operator==(const time_of_day_t& t1, const time_of_day_t& t2) { return t1.units() == t2.units(); }
+
+    namespace ntime
+    {
+        ///@name Column conversions, splitting truncates the time of day to 100 microseconds
+        extern void splitColumn(const datetime_t* in, date_t* dates, time_of_day_t* times, s64 count); ///< 'times' may be nullptr
+        extern void combineColumn(const date_t* dates, const time_of_day_t* times, datetime_t* out, s64 count); ///< 'times' may be nullptr (midnight)
+        extern void decomposeColumn(const date_t* dates, s32* years, s32* months, s32* days, s64 count);
+    } // namespace ntime
+
+}; // namespace ncore
+
+#endif
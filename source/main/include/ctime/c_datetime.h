@@ -87,6 +87,11 @@ namespace ncore
         EDayOfWeek dayOfWeekShort() const;
         s32        dayOfYear() const;
 
+        s32        isoWeek() const;                                         ///< ISO 8601 week, 1 - 53
+        s32        isoWeekYear() const;                                     ///< The year the ISO week belongs to
+        s32        weekOfYear(EDayOfWeek firstDayOfWeek) const;             ///< 1 - 54, week 1 holds January 1st
+        datetime_t startOfWeek(EDayOfWeek firstDayOfWeek = Monday) const; ///< Midnight of the first day of the week
+
         s32    year() const;
         EMonth month() const;
         EMonth monthShort() const;
@@ -127,6 +132,8 @@ namespace ncore
 
         static datetime_t sFromBinary(u64 binary) { return datetime_t(binary); }
         static datetime_t sFromFileTime(u64 fileTime);
+        static datetime_t sFromIsoWeekDate(s32 weekYear, s32 week, s32 isoDayOfWeek); ///< isoDayOfWeek 1 = Monday to 7 = Sunday
+        static s32        sIsoWeeksInYear(s32 weekYear);                               ///< 52 or 53
 
         static s32  sDaysInMonth(s32 year, s32 month);
         static s32  sDaysInYear(s32 year);
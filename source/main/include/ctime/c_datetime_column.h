@@ -0,0 +1,50 @@
+#ifndef __CTIME_DATETIME_COLUMN_H__
+#define __CTIME_DATETIME_COLUMN_H__
+#include "ccore/c_target.h"
+#ifdef USE_PRAGMA_ONCE
+#    pragma once
+#endif
+
+#include "ctime/c_datetime.h"
+
+namespace ncore
+{
+    namespace ntime
+    {
+        /**
+         * ------------------------------------------------------------------------------
+         *  Description:
+         *      Calendar kernels over columns of datetime_t, one output value per input
+         *      value. Each row costs at most one closed-form decomposition (no loops,
+         *      no tables). The per row work has no branches the compiler cannot turn
+         *      into selects. Output arrays that are marked optional may be nullptr, that
+         *      is tested outside of it (once per call, or once per block of 64 rows for
+         *      'overflowMask').
+         * ------------------------------------------------------------------------------
+         */
+
+        ///@name Week dates
+        extern void isoWeekColumn(const datetime_t* in, s32* weekYears, s32* weeks, s64 count); ///< 'weekYears' is optional
+        extern void weekOfYearColumn(const datetime_t* in, EDayOfWeek firstDayOfWeek, s32* weeks, s64 count);
+        extern void startOfWeekColumn(const datetime_t* in, EDayOfWeek firstDayOfWeek, datetime_t* out, s64 count); ///< 'in' and 'out' may be the same array
+
+        ///@name Ordinal dates
+        extern void ordinalDateColumn(const datetime_t* in, s32* years, s32* dayOfYears, s64 count); ///< 'years' is optional
+
+        ///@name Calendar arithmetic, the semantics of datetime_t::addMonths (the day is clamped to the
+        ///      last day of the resulting month, the time of day is kept). Instead of asserting, an
+        ///      element whose result falls outside year 1 - 9999 is copied unchanged and has its bit
+        ///      set in 'overflowMask' (optional, (count + 63) / 64 words). Returns the number of
+        ///      elements shifted, 'in' and 'out' may be the same array.
+        extern s64 addMonthsColumn(const datetime_t* in, datetime_t* out, s64 count, s32 months, u64* overflowMask = nullptr);
+        extern s64 addYearsColumn(const datetime_t* in, datetime_t* out, s64 count, s32 years, u64* overflowMask = nullptr);
+
+        ///@name Truncation to midnight of the first day of the month or quarter, 'in' and 'out' may be the same array
+        extern void truncateToMonthColumn(const datetime_t* in, datetime_t* out, s64 count);
+        extern void truncateToQuarterColumn(const datetime_t* in, datetime_t* out, s64 count);
+
+    } // namespace ntime
+
+}; // namespace ncore
+
+#endif
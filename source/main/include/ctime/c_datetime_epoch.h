@@ -0,0 +1,71 @@
+#ifndef __CTIME_DATETIME_EPOCH_H__
+#define __CTIME_DATETIME_EPOCH_H__
+#include "ccore/c_target.h"
+#ifdef USE_PRAGMA_ONCE
+#    pragma once
+#endif
+
+#include "ctime/c_datetime.h"
+
+namespace ncore
+{
+    namespace ntime
+    {
+        /**
+         * ------------------------------------------------------------------------------
+         *  Description:
+         *      Conversions between datetime_t and the time representations of other
+         *      systems. Values outside the datetime_t range (and NaN) saturate to
+         *      datetime_t::sMinValue / sMaxValue. Per format:
+         *
+         *      Julian Day      f64 days since -4713-11-24 12:00 (proleptic Gregorian),
+         *                      2451545.0 is 2000-01-01 12:00. A double resolves about
+         *                      40 microseconds at current dates, both directions round
+         *                      to nearest (ticks to the nearest double, days to the
+         *                      nearest tick).
+         *      Modified JD     f64 days since 1858-11-17 00:00 (JD - 2400000.5), resolves
+         *                      about half a microsecond at current dates, rounded like JD.
+         *      Excel serial    f64 days of the 1900 date system, 1.0 is 1900-01-01. The
+         *                      nonexistent 1900-02-29 (serial 60) converts to 1900-03-01.
+         *                      Serials are rounded to the nearest millisecond (Excel's own
+         *                      resolution) which removes the binary fraction noise,
+         *                      datetime_t to serial rounds to the nearest double.
+         *      NTP64           u64 32.32 fixed point seconds since 1900-01-01. Converting
+         *                      to NTP drops the era, converting from NTP places a value in
+         *                      1968-01-20 to 2104-02-26 (RFC 4330, 3). Fractions round to
+         *                      nearest, ticks survive a round trip exactly.
+         *      .NET ticks      s64 DateTime.Ticks, the same epoch and unit as datetime_t,
+         *                      exact.
+         *
+         *      The batch variants convert whole arrays with branch-free loops that the
+         *      compiler can vectorize.
+         * ------------------------------------------------------------------------------
+         */
+        extern f64        toJulianDay(datetime_t dt);
+        extern datetime_t fromJulianDay(f64 jd);
+        extern f64        toModifiedJulianDay(datetime_t dt);
+        extern datetime_t fromModifiedJulianDay(f64 mjd);
+        extern f64        toExcelSerial(datetime_t dt);
+        extern datetime_t fromExcelSerial(f64 serial);
+        extern u64        toNtp64(datetime_t dt);
+        extern datetime_t fromNtp64(u64 ntp);
+        extern s64        toDotNetTicks(datetime_t dt);
+        extern datetime_t fromDotNetTicks(s64 ticks);
+
+        ///@name Batch
+        extern void toJulianDay(const datetime_t* in, f64* out, s64 count);
+        extern void fromJulianDay(const f64* in, datetime_t* out, s64 count);
+        extern void toModifiedJulianDay(const datetime_t* in, f64* out, s64 count);
+        extern void fromModifiedJulianDay(const f64* in, datetime_t* out, s64 count);
+        extern void toExcelSerial(const datetime_t* in, f64* out, s64 count);
+        extern void fromExcelSerial(const f64* in, datetime_t* out, s64 count);
+        extern void toNtp64(const datetime_t* in, u64* out, s64 count);
+        extern void fromNtp64(const u64* in, datetime_t* out, s64 count);
+        extern void toDotNetTicks(const datetime_t* in, s64* out, s64 count);
+        extern void fromDotNetTicks(const s64* in, datetime_t* out, s64 count);
+
+    } // namespace ntime
+
+}; // namespace ncore
+
+#endif
@@ -0,0 +1,67 @@
+#ifndef __CTIME_DATETIME_FORMAT_H__
+#define __CTIME_DATETIME_FORMAT_H__
+#include "ccore/c_target.h"
+#ifdef USE_PRAGMA_ONCE
+#    pragma once
+#endif
+
+namespace ncore
+{
+    class datetime_t;
+    class datetime_offset_t;
+
+    enum EDateTimeExport
+    {
+        ExportIso8601     = 0, ///< 2023-11-14T22:13:20.123Z, fixed width of 24 characters
+        ExportEpochMillis = 1, ///< 1700000000123, milliseconds since 1970-01-01 (negative before 1970)
+    };
+
+    namespace ntime
+    {
+        /**
+         * ------------------------------------------------------------------------------
+         *   Summary:
+         *       The maximum number of bytes a single exported element can occupy,
+         *       including its separator. A buffer of exportElementSize(format) * count
+         *       bytes always holds a whole column.
+         * ------------------------------------------------------------------------------
+         */
+        extern s32 exportElementSize(EDateTimeExport format);
+
+        /**
+         * ------------------------------------------------------------------------------
+         *   Summary:
+         *       Render a column of timestamps as text into 'dst'. Every element is followed
+         *       by 'separator' (e.g. '\n' for a CSV column). Elements are decomposed and
+         *       converted to digits 8 at a time, only whole elements are written.
+         *   Arguments:
+         *       ticks/column    The timestamps, as datetime_t or as their raw ticks
+         *       count           Number of elements
+         *       dst, dstSize    The destination buffer
+         *       outBytes        Receives the number of bytes written
+         *   Returns:
+         *       The number of elements written, less than 'count' when 'dst' is too small.
+         * ------------------------------------------------------------------------------
+         */
+        extern s64 exportColumn(const u64* ticks, s64 count, EDateTimeExport format, char separator, char* dst, s64 dstSize, s64& outBytes);
+        extern s64 exportColumn(const datetime_t* column, s64 count, EDateTimeExport format, char separator, char* dst, s64 dstSize, s64& outBytes);
+
+        /**
+         * ------------------------------------------------------------------------------
+         *   Summary:
+         *       Render a timestamp in its captured local time as RFC 3339 text, e.g.
+         *       2023-11-14T23:13:20.123+01:00 (fixed width of 29 characters, a zero
+         *       offset is written as +00:00). The column variant works like the one
+         *       above, every element is followed by 'separator'.
+         *   Returns:
+         *       The number of characters written (excluding the terminating zero), 0
+         *       when 'dst' cannot hold them.
+         * ------------------------------------------------------------------------------
+         */
+        extern s32 formatRfc3339(const datetime_offset_t& dto, char* dst, s32 dstSize);
+        extern s64 exportColumn(const datetime_offset_t* column, s64 count, char separator, char* dst, s64 dstSize, s64& outBytes);
+    } // namespace ntime
+
+}; // namespace ncore
+
+#endif
@@ -0,0 +1,63 @@
+#ifndef __CTIME_DATETIME_OFFSET_H__
+#define __CTIME_DATETIME_OFFSET_H__
+#include "ccore/c_target.h"
+#ifdef USE_PRAGMA_ONCE
+#    pragma once
+#endif
+
+#include "ctime/c_datetime.h"
+
+namespace ncore
+{
+    class timezone_t;
+
+    /**
+     * ------------------------------------------------------------------------------
+     *  Description:
+     *      A UTC instant together with the local offset it was captured in, packed
+     *      in a single u64. The low 57 bits hold the ticks since 1900-01-01 00:00 UTC
+     *      (a range of about 456 years, up to 2356-08), the high 7 bits hold the
+     *      offset in signed quarter hours (-16:00 up to +15:45).
+     *
+     *      The local time (and its rendering, see ntime::formatRfc3339) follows from
+     *      the packed value alone, no time zone lookup is needed.
+     *
+     *  Example:
+     * <CODE>
+     *       datetime_offset_t const captured = datetime_offset_t::sFromZone(datetime_t::sNowUtc(), tz);
+     *       char text[32];
+     *       ntime::formatRfc3339(captured, text, sizeof(text));
+     * </CODE>
+     * ------------------------------------------------------------------------------
+     */
+    class datetime_offset_t
+    {
+    public:
+        datetime_offset_t();
+        datetime_offset_t(datetime_t utc, s32 offsetMinutes); ///< Offset in minutes east of UTC, a multiple of 15
+
+        datetime_t utc() const;
+        datetime_t local() const;
+        s32        offsetMinutes() const;
+        u64        packed() const { return mPacked; }
+
+        s32  compareTo(const datetime_offset_t& value) const { return sCompare(*this, value); } ///< By instant, the offset is ignored
+        bool equals(const datetime_offset_t& value) const { return sCompare(*this, value) == 0; }
+
+        static datetime_offset_t sFromPacked(u64 packed);
+        static datetime_offset_t sFromLocal(datetime_t local, s32 offsetMinutes);
+        static datetime_offset_t sFromZone(datetime_t utc, const timezone_t* zone); ///< Offset of the zone at 'utc', rounded to a quarter hour
+
+        static bool sIsRepresentable(datetime_t utc);
+        static s32  sCompare(const datetime_offset_t& t1, const datetime_offset_t& t2);
+
+        static const datetime_offset_t sMinValue; ///< 1900-01-01 00:00 UTC
+        static const datetime_offset_t sMaxValue;
+
+    private:
+        u64 mPacked;
+    };
+
+}; // namespace ncore
+
+#endif
@@ -0,0 +1,111 @@
+#ifndef __CTIME_DATETIME_PARSE_H__
+#define __CTIME_DATETIME_PARSE_H__
+#include "ccore/c_target.h"
+#ifdef USE_PRAGMA_ONCE
+#    pragma once
+#endif
+
+namespace ncore
+{
+    class datetime_t;
+
+    enum ETimestampFormat
+    {
+        TimestampUnknown      = 0,
+        TimestampEpochSeconds = 1, ///< 1700000000 or 1700000000.123456
+        TimestampEpochMillis  = 2, ///< 1700000000123
+        TimestampEpochMicros  = 3, ///< 1700000000123456
+        TimestampEpochNanos   = 4, ///< 1700000000123456789
+        TimestampIso8601      = 5, ///< 2023-11-14T22:13:20.123Z, 2023-11-14 22:13:20+01:00, 20231114T221320Z
+        TimestampRfc2822      = 6, ///< Tue, 14 Nov 2023 22:13:20 +0000
+        TimestampSyslog       = 7, ///< Nov 14 22:13:20 (RFC 3164, no year)
+        TimestampFormatCount  = 8,
+    };
+
+    namespace ntime
+    {
+        /**
+         * ------------------------------------------------------------------------------
+         *   Summary:
+         *       Classify a timestamp token by its length and character classes.
+         *       The first 16 bytes are examined as two 64-bit words at once, only the
+         *       shape of the token is checked, not the validity of the fields.
+         *   Returns:
+         *       The detected format or TimestampUnknown.
+         * ------------------------------------------------------------------------------
+         */
+        extern ETimestampFormat classifyTimestamp(const char* str, s32 len);
+
+        /**
+         * ------------------------------------------------------------------------------
+         *   Summary:
+         *       Parse a timestamp token in a known format into a UTC datetime_t.
+         *       Timestamps carrying a zone offset are converted to UTC, timestamps
+         *       without one are taken as UTC. Syslog timestamps carry no year, the
+         *       caller provides it with 'year'.
+         *   Returns:
+         *       false when the token does not strictly match the format or is out of range.
+         * ------------------------------------------------------------------------------
+         */
+        extern bool parseTimestamp(ETimestampFormat format, const char* str, s32 len, datetime_t& out, s32 year = 1970);
+
+        // Classify and parse in one call
+        extern bool parseTimestamp(const char* str, s32 len, datetime_t& out, s32 year = 1970);
+    } // namespace ntime
+
+    /**
+     * ------------------------------------------------------------------------------
+     *  Description:
+     *      A timestamp parser for a single stream of log lines. The parser learns the
+     *      dominant format of the stream and tries the parser of that format first, only
+     *      when that fails is the token classified again. Every format scores the
+     *      tokens it parsed, the scores are halved every 1024 tokens so they follow
+     *      the recent tokens. The dominant format is replaced as soon as the score of
+     *      another format exceeds its score.
+     *
+     *  Example:
+     * <CODE>
+     *       timestamp_parser_t parser;
+     *       parser.setYear(2023);     // Reference year for syslog timestamps
+     *
+     *       datetime_t dt;
+     *       while (readToken(str, len))
+     *       {
+     *           if (parser.parse(str, len, dt))
+     *               ...
+     *       }
+     * </CODE>
+     * ------------------------------------------------------------------------------
+     */
+    class timestamp_parser_t
+    {
+    public:
+        timestamp_parser_t();
+
+        void reset();
+        void setYear(s32 year) { mYear = year; }
+
+        bool parse(const char* str, s32 len, datetime_t& out);
+
+        ///@name Batch, parses 'count' tokens and returns the number of tokens parsed successfully.
+        ///      Failed tokens have their bit set in 'failMask' (optional, (count + 63) / 64 words).
+        s32 parse(const char* const* strs, const s32* lens, s32 count, datetime_t* out, u64* failMask = nullptr);
+
+        ETimestampFormat dominantFormat() const { return mDominant; }
+        u64              getNumFastPathHits() const { return mFastHits; }
+        u64              getNumFastPathMisses() const { return mFastMisses; }
+
+    private:
+        void learn(ETimestampFormat format);
+
+        ETimestampFormat mDominant;
+        s32              mYear;
+        s32              mSamples;
+        u32              mScore[TimestampFormatCount]; ///< Tokens parsed per format, halved every window
+        u64              mFastHits;
+        u64              mFastMisses;
+    };
+
+}; // namespace ncore
+
+#endif
@@ -0,0 +1,76 @@
+#ifndef __CTIME_DEADLINE_QUEUE_H__
+#define __CTIME_DEADLINE_QUEUE_H__
+#include "ccore/c_target.h"
+#ifdef USE_PRAGMA_ONCE
+#    pragma once
+#endif
+
+#include "ctime/c_time.h"
+#include "ctime/c_timer_wheel.h"
+
+namespace ncore
+{
+    class alloc_t;
+
+    /**
+     * ------------------------------------------------------------------------------
+     *  Description:
+     *      A min-queue of (deadline, payload) pairs on a 4-ary heap, for a modest number of
+     *      timers that must come out in exact deadline order. The heap is stored as
+     *      structure-of-arrays: the deadlines the sift loops compare are packed together,
+     *      shifted so that the 4 children of a node share one 32 byte block of a cache
+     *      line, payloads and handles are only touched when an entry moves.
+     *
+     *      Handles stay valid while the entry is queued, cancel and reschedule (decrease
+     *      or increase of the deadline) are O(log n). Entries with equal deadlines come
+     *      out in no particular order. The capacity is fixed by init(). Not thread-safe.
+     * ------------------------------------------------------------------------------
+     */
+    class deadline_queue_t
+    {
+    public:
+        struct entry_t
+        {
+            tick_t         mDeadline;
+            void*          mPayload;
+            timer_handle_t mHandle; ///< Stale once the entry left the queue
+        };
+
+        deadline_queue_t();
+        ~deadline_queue_t();
+
+        bool init(alloc_t* allocator, u32 capacity);
+        void exit();
+
+        timer_handle_t push(tick_t deadline, void* payload); ///< 0 when the queue is full
+        bool           cancel(timer_handle_t handle);         ///< False when the handle is stale
+        bool           reschedule(timer_handle_t handle, tick_t deadline);
+        bool           isQueued(timer_handle_t handle) const;
+
+        bool peek(entry_t& entry) const; ///< The earliest entry, false when empty
+        bool pop(entry_t& entry);
+        u32  popExpired(tick_t now, entry_t* out, u32 max); ///< Entries with a deadline <= now, earliest first
+
+        u32 size() const { return mSize; }
+        u32 capacity() const { return mCapacity; }
+
+    private:
+        void siftUp(u32 pos, tick_t deadline, void* payload, u32 slot);
+        void siftDown(u32 pos, tick_t deadline, void* payload, u32 slot);
+        void removeAt(u32 pos);
+        u32  slotOf(timer_handle_t handle) const;
+
+        alloc_t* mAllocator;
+        tick_t*  mDeadlines;   ///< Heap order
+        void**   mPayloads;    ///< Heap order
+        u32*     mSlots;       ///< Heap order, the handle slot of the entry
+        u32*     mPositions;   ///< Per handle slot, the heap position (or the next free slot)
+        u32*     mGenerations; ///< Per handle slot
+        u32      mFree;
+        u32      mSize;
+        u32      mCapacity;
+    };
+
+}; // namespace ncore
+
+#endif
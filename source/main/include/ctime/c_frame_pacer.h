@@ -0,0 +1,101 @@
+#ifndef __CTIME_FRAME_PACER_H__
+#define __CTIME_FRAME_PACER_H__
+#include "ccore/c_target.h"
+#ifdef USE_PRAGMA_ONCE
+#    pragma once
+#endif
+
+#include "ctime/c_time.h"
+#include "ctime/c_frame_rate.h"
+
+namespace ncore
+{
+    enum EFrameMissPolicy
+    {
+        FrameSkip,    ///< Frames whose slot has passed are dropped, the next frame starts at once
+        FrameCatchUp, ///< Late frames run back to back until the schedule is caught up
+    };
+
+    enum EFrameWait
+    {
+        FrameWaitSleep, ///< ntime::sleepUntil, sleeps and spins the last part
+        FrameWaitSpin,  ///< Spins on getTime()
+        FrameWaitNone,  ///< The caller waits (e.g. on vsync), waitFrame() only keeps the schedule
+    };
+
+    /**
+     * ------------------------------------------------------------------------------
+     *  Description:
+     *      The frame_pacer_t class paces a loop at a target rate. Frame n starts at
+     *      the deadline start + n * period, computed from the frame index and the
+     *      rate as a fraction (e.g. 60000/1001) and rounded up to a tick. A late frame
+     *      does not move the deadlines that follow, no drift can accumulate.
+     *
+     *      A frame is missed when its slot (from its deadline to the next one) has
+     *      passed before it started. With FrameSkip the missed frames are dropped,
+     *      with FrameCatchUp they run without waiting until the loop is back on
+     *      schedule (at most 'maxCatchUp' frames, older ones are dropped).
+     *
+     *      waitFrame() returns the deadline of the frame, the time a simulation should
+     *      use for a stable frame time instead of the time the frame really started.
+     *
+     *  Example:
+     * <CODE>
+     *       frame_pacer_t pacer;
+     *       pacer.start(60);
+     *       while (game_loop)
+     *       {
+     *           tick_t const frameTime = pacer.waitFrame();
+     *           simulate(frameTime, pacer.getPeriod());
+     *           render();
+     *       }
+     * </CODE>
+     * ------------------------------------------------------------------------------
+     */
+    class frame_pacer_t
+    {
+    public:
+        frame_pacer_t();
+
+        void start(u32 framesPerSecond, u32 denominator = 1, EFrameMissPolicy policy = FrameSkip, EFrameWait wait = FrameWaitSleep);
+        void setRate(u32 framesPerSecond, u32 denominator = 1); ///< The new rate starts at the deadline of the current frame
+        void setMaxCatchUp(u32 frames) { mMaxCatchUp = frames; }
+        void resync(); ///< Restarts the schedule now, e.g. after a pause of the loop
+
+        tick_t waitFrame(); ///< Waits for the deadline of the next frame and returns it
+
+        u64    getFrames() const { return mFrames; } ///< Frames paced since start(), skipped ones excluded
+        tick_t getDeadline() const { return deadlineOf(mIndex); } ///< Of the current frame
+        tick_t getPeriod() const;                                 ///< Rounded down to a tick
+        bool   getFrameRate(f32& fps) const { return mFrameRate.getFrameRate(fps); }
+
+        ///@name Statistics, lateness is the time a frame started after its deadline
+        u64    getMissed() const { return mMissed; }
+        u64    getSkipped() const { return mSkipped; }
+        tick_t getMaxLateness() const { return mMaxLateness; }
+        tick_t getTotalLateness() const { return mTotalLateness; }
+        void   resetStats();
+
+    private:
+        tick_t deadlineOf(u64 index) const;
+        u64    slotOf(tick_t time) const;
+
+        framerate_t      mFrameRate;
+        tick_t           mEpoch;
+        u64              mIndex; ///< Frame index since mEpoch
+        s64              mSpan;  ///< Ticks per mNumerator frames
+        u32              mNumerator;
+        u32              mDenominator;
+        u32              mMaxCatchUp;
+        EFrameMissPolicy mPolicy;
+        EFrameWait       mWait;
+        u64              mFrames;
+        u64              mMissed;
+        u64              mSkipped;
+        tick_t           mMaxLateness;
+        tick_t           mTotalLateness;
+    };
+
+}; // namespace ncore
+
+#endif
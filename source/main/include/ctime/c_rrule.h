@@ -0,0 +1,145 @@
+#ifndef __CTIME_RRULE_H__
+#define __CTIME_RRULE_H__
+#include "ccore/c_target.h"
+#ifdef USE_PRAGMA_ONCE
+#    pragma once
+#endif
+
+#include "ctime/c_datetime.h"
+
+namespace ncore
+{
+    enum ERRuleFrequency
+    {
+        RRuleSecondly = 0,
+        RRuleMinutely = 1,
+        RRuleHourly   = 2,
+        RRuleDaily    = 3,
+        RRuleWeekly   = 4,
+        RRuleMonthly  = 5,
+        RRuleYearly   = 6,
+    };
+
+    /**
+     * ------------------------------------------------------------------------------
+     *  Description:
+     *      A compiled RFC 5545 recurrence rule with its DTSTART, for example
+     *      "FREQ=MONTHLY;INTERVAL=2;BYDAY=-1FR;COUNT=10". The rule parts FREQ,
+     *      INTERVAL, COUNT, UNTIL, BYMONTH, BYMONTHDAY, BYDAY, BYSETPOS and WKST
+     *      are supported, BYDAY takes an ordinal (-5 to 5) for a MONTHLY rule and
+     *      for a YEARLY rule with BYMONTH. The other rule parts are rejected.
+     *
+     *      Every occurrence of a DAILY, WEEKLY, MONTHLY and YEARLY rule has the time
+     *      of day of DTSTART, a rule without a day rule part repeats the day of
+     *      DTSTART. The day rule parts compile into bitsets, the matching days of a
+     *      month are computed as one bitset. Times are matched as they are, a
+     *      floating or UTC DTSTART gives floating or UTC occurrences.
+     *
+     *      EXDATE is a sorted array owned by the caller, excluded occurrences still
+     *      count towards COUNT.
+     *
+     *  Example:
+     * <CODE>
+     *       rrule_t rule;
+     *       if (rule.parse("FREQ=WEEKLY;BYDAY=MO,WE,FR;UNTIL=20241231T235959Z", datetime_t(2024, 1, 1, 9, 0, 0)))
+     *       {
+     *           rrule_iterator_t it;
+     *           it.init(&rule);
+     *           it.seek(windowBegin);
+     *           datetime_t when;
+     *           while (it.next(when) && when < windowEnd)
+     *               ...
+     *       }
+     * </CODE>
+     * ------------------------------------------------------------------------------
+     */
+    class rrule_t
+    {
+    public:
+        rrule_t();
+
+        bool parse(const char* str, datetime_t start);          ///< Zero terminated, an optional "RRULE:" prefix
+        bool parse(const char* str, s32 len, datetime_t start); ///< False when it is invalid or not supported
+        void setExDates(const datetime_t* exdates, s32 count);  ///< Sorted, owned by the caller, cleared by parse()
+
+        datetime_t      start() const { return mStart; }
+        ERRuleFrequency frequency() const { return (ERRuleFrequency)mFrequency; }
+
+        ///@name The occurrences in [begin, end), returns the number written to 'out' (at most 'max')
+        s32 expand(datetime_t begin, datetime_t end, datetime_t* out, s32 max) const;
+
+    private:
+        bool parsePart(const char* key, s32 keyLen, const char* value, s32 valueLen);
+        u32  daysOf(s32 year, s32 month) const; ///< Bit d set when day d of the month matches
+        bool isSelected(s32 index, s32 total) const;
+        s32  numSelected(s32 total) const;
+
+        datetime_t        mStart;
+        datetime_t        mUntil;
+        const datetime_t* mExDates;
+        s32               mNumExDates;
+        s32               mInterval;
+        s32               mCount;            ///< 0 when there is no COUNT
+        u64               mNthWeekdays;      ///< Bit (n - 1) * 7 + d for BYDAY 'nDD'
+        u64               mLastNthWeekdays;  ///< Bit (n - 1) * 7 + d for BYDAY '-nDD'
+        u32               mMonthDays;        ///< Bit d for BYMONTHDAY 'd'
+        u32               mLastMonthDays;    ///< Bit n for BYMONTHDAY '-n'
+        s16               mSetPos[8];
+        u16               mMonths;           ///< Bits 1 - 12, 0 when there is no BYMONTH
+        u8                mWeekdays;         ///< Bit d for BYDAY 'DD', 0 = Sunday
+        u8                mNumSetPos;
+        u8                mFrequency;
+        u8                mWeekStart;
+        u8                mFlags;
+
+        friend class rrule_iterator_t;
+    };
+
+    /**
+     * ------------------------------------------------------------------------------
+     *  Description:
+     *      Produces the occurrences of an rrule_t one by one, in order. The state is
+     *      a few words and nothing is allocated, the rule is referenced and must
+     *      outlive the iterator.
+     *
+     *      seek() jumps to the period (day, week, month or year) holding the
+     *      instant without producing the occurrences before it. A rule with a
+     *      COUNT has to count the occurrences before it, whole periods are counted
+     *      from their day bitsets (one by one for SECONDLY, MINUTELY and HOURLY).
+     * ------------------------------------------------------------------------------
+     */
+    class rrule_iterator_t
+    {
+    public:
+        rrule_iterator_t();
+
+        void init(const rrule_t* rule); ///< At the first occurrence
+        void seek(datetime_t at);       ///< At the first occurrence at or after 'at'
+        bool next(datetime_t& out);     ///< False after the last occurrence
+
+        bool done() const { return mDone; }
+        s32  getEmitted() const { return mEmitted; } ///< Occurrences so far, excluded ones included
+
+    private:
+        void loadPeriod(s64 period);
+        bool advance(s64& ticks); ///< The next occurrence of the rule, not excluded by EXDATE
+        bool nextDay(s32& day);   ///< The next candidate day of the current period, per BYSETPOS
+        void periodRange(s64 period, s32& first, s32& last) const;
+        u32  chunkMask(s32 month, s32 first, s32 last) const;
+        s32  periodTotal(s32 first, s32 last) const;
+
+        const rrule_t* mRule;
+        s64            mPeriod;
+        s32            mMonth;    ///< Month index (year * 12 + month - 1) of the candidates in mMask
+        s32            mLast;     ///< Last day of the period
+        u32            mMask;     ///< Candidate days of that month still to come
+        s32            mIndex;    ///< Position in the period of the next candidate, 1 based
+        s32            mTotal;    ///< Candidates in the period
+        s32            mEmitted;  ///< Towards COUNT
+        s32            mExDate;   ///< Next EXDATE that can exclude an occurrence
+        bool           mDone;
+    };
+
+}; // namespace ncore
+
+#endif
@@ -0,0 +1,59 @@
+#ifndef __CTIME_SLEEP_H__
+#define __CTIME_SLEEP_H__
+#include "ccore/c_target.h"
+#ifdef USE_PRAGMA_ONCE
+#    pragma once
+#endif
+
+#include "ctime/c_time.h"
+#include "ctime/c_timespan.h"
+
+namespace ncore
+{
+    namespace ntime
+    {
+        /**
+         * ------------------------------------------------------------------------------
+         *  Description:
+         *      Sleeping with a precision of a few microseconds. The thread sleeps with the
+         *      sleep of the OS until a safety margin before the deadline and spins on
+         *      getTime() for the rest.
+         *
+         *      The OS wakes a thread up late, the margin has to cover that lateness. It is
+         *      learned while sleeping from the observed oversleep (average plus four times
+         *      its deviation), a host with a precise OS sleep spins less.
+         *
+         *      Thread-safe, all threads share the margin and the statistics.
+         *
+         *  Example:
+         * <CODE>
+         *       tick_t next = getTime();
+         *       for (;;)
+         *       {
+         *           next += period;
+         *           ntime::sleepUntil(next);
+         *           send(packet);
+         *       }
+         * </CODE>
+         * ------------------------------------------------------------------------------
+         */
+        extern void sleepUntil(tick_t deadline); ///< A deadline in getTime() ticks
+        extern void sleepFor(const timespan_t& duration);
+
+        struct sleep_stats_t
+        {
+            u64    mSleeps;     ///< Number of sleepUntil/sleepFor calls that waited
+            tick_t mMargin;     ///< The current safety margin
+            tick_t mTotalError; ///< Sum of the wake-up errors, a wake-up is never early
+            tick_t mMaxError;   ///< Largest wake-up error
+            tick_t mSleptTicks; ///< Time spent in the sleep of the OS
+            tick_t mSpunTicks;  ///< Time spent spinning, the CPU burned
+        };
+
+        extern void getSleepStats(sleep_stats_t& stats);
+        extern void resetSleepStats(); ///< Statistics only, the margin is kept
+    } // namespace ntime
+
+}; // namespace ncore
+
+#endif
@@ -7,6 +7,8 @@
 
 namespace ncore
 {
+    class timespan_t;
+
     namespace ntime
     {
         extern void init(void);
@@ -27,6 +29,14 @@ namespace ncore
     extern tick_t millisecondsToTicks(f64 inMs);
     extern tick_t microsecondsToTicks(f64 inUs);
 
+    namespace ntime
+    {
+        ///@name Exact integer conversions of getTime() ticks, without rounding through f64
+        extern tick_t toTicks(const timespan_t& span); ///< From 100 nanosecond ticks to getTime() ticks
+        extern s64    ticksToNs(tick_t ticks);
+        extern tick_t nsToTicks(s64 ns);
+    } // namespace ntime
+
     //==============================================================================
     // INLINE
     //==============================================================================
@@ -0,0 +1,334 @@
+#ifndef __CTIME_TIMER_AWAITABLE_H__
+#define __CTIME_TIMER_AWAITABLE_H__
+#include "ccore/c_target.h"
+#ifdef USE_PRAGMA_ONCE
+#    pragma once
+#endif
+
+#include "ccore/c_debug.h"
+
+#include "ctime/c_time.h"
+#include "ctime/c_timespan.h"
+#include "ctime/c_datetime.h"
+#include "ctime/c_timer_wheel.h"
+
+#if defined(__cpp_impl_coroutine)
+
+#    include <coroutine>
+#    include <type_traits>
+
+namespace ncore
+{
+    class alloc_t;
+
+    /**
+     * ------------------------------------------------------------------------------
+     *  Description:
+     *      Runs the timers of coroutines on one thread. A coroutine that awaits a
+     *      sleep is parked in a timer_wheel_t keyed on getTime() ticks and resumed by
+     *      poll() once its deadline passed, so one thread can hold any number of
+     *      sleeping coroutines. A wait does not allocate, the awaitable lives in the
+     *      frame of the coroutine and the node in the pool of the wheel.
+     *
+     *      The awaitables without an executor argument use the current executor of
+     *      the thread, set by makeCurrent() and by poll(). Not thread-safe.
+     *
+     *  Example:
+     * <CODE>
+     *       task_t<void> heartbeat(connection_t* c)
+     *       {
+     *           for (;;)
+     *           {
+     *               co_await ntime::sleep_for(timespan_t(0, 0, 0, 5));
+     *               c->ping();
+     *           }
+     *       }
+     *
+     *       executor.init(allocator, 100000, millisecondsToTicks(1.0));
+     *       executor.makeCurrent();
+     *       task_t<void> task = heartbeat(connection);
+     *       task.start();
+     *       while (running)
+     *           executor.poll();
+     * </CODE>
+     * ------------------------------------------------------------------------------
+     */
+    class timer_executor_t
+    {
+    public:
+        timer_executor_t();
+        ~timer_executor_t();
+
+        bool init(alloc_t* allocator, u32 maxWaits, tick_t resolution);
+        void exit(); ///< Coroutines that still wait are not resumed
+
+        void makeCurrent(); ///< For the calling thread
+        u32  poll();        ///< Resumes the coroutines whose deadline passed, returns the number resumed
+        u32  poll(tick_t now);
+
+        u32            size() const { return mWheel.size(); } ///< Number of waiting coroutines
+        timer_wheel_t& getWheel() { return mWheel; }
+
+        static timer_executor_t* sCurrent();
+        static void              sResume(timer_handle_t handle, void* user); ///< timer_callback_t, 'user' is the address of a coroutine handle
+
+    private:
+        timer_wheel_t mWheel;
+    };
+
+    template <typename T> class task_t;
+
+    namespace ntime
+    {
+        // Awaits a deadline in getTime() ticks, does not suspend when it has passed
+        class sleep_awaitable_t
+        {
+        public:
+            sleep_awaitable_t(timer_executor_t* executor, tick_t deadline)
+                : mExecutor(executor)
+                , mDeadline(deadline)
+                , mHandle(0)
+            {
+                ASSERTS(mExecutor != nullptr, "no timer_executor_t, call makeCurrent()");
+            }
+            sleep_awaitable_t(const sleep_awaitable_t& other)
+                : mExecutor(other.mExecutor)
+                , mDeadline(other.mDeadline)
+                , mHandle(0)
+            {
+            }
+            ~sleep_awaitable_t()
+            {
+                // The frame is destroyed while it waits
+                if (mHandle != 0)
+                    mExecutor->getWheel().cancel(mHandle);
+            }
+
+            bool await_ready() const noexcept { return getTime() >= mDeadline; }
+            bool await_suspend(std::coroutine_handle<> awaiter)
+            {
+                mHandle = mExecutor->getWheel().schedule(mDeadline, timer_executor_t::sResume, awaiter.address());
+                ASSERTS(mHandle != 0, "timer_executor_t is full");
+                return mHandle != 0;
+            }
+            void await_resume() noexcept { mHandle = 0; }
+
+        private:
+            timer_executor_t* mExecutor;
+            tick_t            mDeadline;
+            timer_handle_t    mHandle;
+        };
+
+        inline sleep_awaitable_t sleep_until(timer_executor_t& executor, tick_t deadline) { return sleep_awaitable_t(&executor, deadline); }
+        inline sleep_awaitable_t sleep_until(tick_t deadline) { return sleep_awaitable_t(timer_executor_t::sCurrent(), deadline); }
+        inline sleep_awaitable_t sleep_for(timer_executor_t& executor, const timespan_t& span) { return sleep_awaitable_t(&executor, getTime() + toTicks(span)); }
+        inline sleep_awaitable_t sleep_for(const timespan_t& span) { return sleep_awaitable_t(timer_executor_t::sCurrent(), getTime() + toTicks(span)); }
+
+        // A local date and time (as datetime_t::sNow()), mapped on getTime() when called
+        extern sleep_awaitable_t until(timer_executor_t& executor, const datetime_t& when);
+        extern sleep_awaitable_t until(const datetime_t& when);
+
+        template <typename T> class timeout_awaitable_t;
+    } // namespace ntime
+
+    template <typename T> struct task_result_t
+    {
+        T    mValue;
+        void return_value(const T& value) { mValue = value; }
+    };
+    template <> struct task_result_t<void>
+    {
+        void return_void() {}
+    };
+
+    /**
+     * ------------------------------------------------------------------------------
+     *  Description:
+     *      A lazily started coroutine that can be awaited (once) or started with
+     *      start(). The task owns the frame, unless it was detached by a timeout,
+     *      then the frame destroys itself when the coroutine returns.
+     * ------------------------------------------------------------------------------
+     */
+    template <typename T> class task_t
+    {
+    public:
+        struct promise_type : task_result_t<T>
+        {
+            std::coroutine_handle<> mContinuation;
+            std::coroutine_handle<> (*mOnDone)(void* user) = nullptr; ///< Instead of a continuation, returns what to resume
+            void* mOnDoneUser                              = nullptr;
+            bool  mStarted                                 = false;
+            bool  mDetached                                = false;
+
+            task_t              get_return_object() { return task_t(std::coroutine_handle<promise_type>::from_promise(*this)); }
+            std::suspend_always initial_suspend() noexcept { return {}; }
+            void                unhandled_exception() { ASSERTS(false, "exception in a task_t"); }
+
+            struct final_awaitable_t
+            {
+                bool                    await_ready() noexcept { return false; }
+                std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> self) noexcept
+                {
+                    promise_type& promise = self.promise();
+                    if (promise.mDetached)
+                    {
+                        self.destroy();
+                        return std::noop_coroutine();
+                    }
+                    if (promise.mOnDone != nullptr)
+                        return promise.mOnDone(promise.mOnDoneUser);
+                    if (promise.mContinuation)
+                        return promise.mContinuation;
+                    return std::noop_coroutine();
+                }
+                void await_resume() noexcept {}
+            };
+            final_awaitable_t final_suspend() noexcept { return {}; }
+        };
+
+        task_t()
+            : mCoroutine(nullptr)
+        {
+        }
+        task_t(task_t&& other) noexcept
+            : mCoroutine(other.mCoroutine)
+        {
+            other.mCoroutine = nullptr;
+        }
+        task_t& operator=(task_t&& other) noexcept
+        {
+            if (this != &other)
+            {
+                reset();
+                mCoroutine       = other.mCoroutine;
+                other.mCoroutine = nullptr;
+            }
+            return *this;
+        }
+        task_t(const task_t&)            = delete;
+        task_t& operator=(const task_t&) = delete;
+        ~task_t() { reset(); }
+
+        bool isValid() const { return mCoroutine != nullptr; }
+        bool done() const { return mCoroutine && mCoroutine.done(); }
+        void start() ///< Runs until its first suspension
+        {
+            mCoroutine.promise().mStarted = true;
+            mCoroutine.resume();
+        }
+
+        template <typename U = T> const U& result() const { return mCoroutine.promise().mValue; }
+
+        ///@name Awaiting a task starts it and resumes the awaiter when it returns
+        bool                    await_ready() const noexcept { return mCoroutine.done(); }
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiter)
+        {
+            promise_type& promise = mCoroutine.promise();
+            promise.mContinuation = awaiter;
+            if (promise.mStarted)
+                return std::noop_coroutine(); // it waits on something else, the continuation runs when it returns
+            promise.mStarted = true;
+            return mCoroutine;
+        }
+        T await_resume()
+        {
+            if constexpr (!std::is_void_v<T>)
+                return mCoroutine.promise().mValue;
+        }
+
+    private:
+        template <typename> friend class ntime::timeout_awaitable_t;
+
+        explicit task_t(std::coroutine_handle<promise_type> coroutine)
+            : mCoroutine(coroutine)
+        {
+        }
+
+        void reset()
+        {
+            if (mCoroutine)
+                mCoroutine.destroy();
+            mCoroutine = nullptr;
+        }
+
+        std::coroutine_handle<promise_type> mCoroutine;
+    };
+
+    namespace ntime
+    {
+        /**
+         * ------------------------------------------------------------------------------
+         *  Description:
+         *      Awaits a task for at most a timespan, the result is true when the task
+         *      returned in time (task_t::result() holds its value). On a timeout the
+         *      task is detached, it runs on until it returns and the task_t becomes
+         *      invalid.
+         * ------------------------------------------------------------------------------
+         */
+        template <typename T> class timeout_awaitable_t
+        {
+        public:
+            timeout_awaitable_t(timer_executor_t* executor, task_t<T>& task, tick_t deadline)
+                : mExecutor(executor)
+                , mTask(&task)
+                , mDeadline(deadline)
+                , mTimer(0)
+                , mTimedOut(false)
+            {
+                ASSERTS(mExecutor != nullptr, "no timer_executor_t, call makeCurrent()");
+            }
+
+            bool await_ready() const noexcept { return mTask->done(); }
+
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiter)
+            {
+                typename task_t<T>::promise_type& promise = mTask->mCoroutine.promise();
+                mAwaiter                                  = awaiter;
+                promise.mOnDone                           = sOnDone;
+                promise.mOnDoneUser                       = this;
+                mTimer                                    = mExecutor->getWheel().schedule(mDeadline, sOnTimeout, this);
+                ASSERTS(mTimer != 0, "timer_executor_t is full");
+                if (promise.mStarted)
+                    return std::noop_coroutine();
+                promise.mStarted = true;
+                return mTask->mCoroutine;
+            }
+
+            bool await_resume() noexcept { return !mTimedOut; }
+
+        private:
+            // The task returned first
+            static std::coroutine_handle<> sOnDone(void* user)
+            {
+                timeout_awaitable_t* self = (timeout_awaitable_t*)user;
+                self->mExecutor->getWheel().cancel(self->mTimer);
+                return self->mAwaiter;
+            }
+
+            // The deadline passed first
+            static void sOnTimeout(timer_handle_t handle, void* user)
+            {
+                timeout_awaitable_t* self                   = (timeout_awaitable_t*)user;
+                self->mTimedOut                             = true;
+                self->mTask->mCoroutine.promise().mDetached = true;
+                self->mTask->mCoroutine                     = nullptr;
+                self->mAwaiter.resume();
+            }
+
+            timer_executor_t*       mExecutor;
+            task_t<T>*              mTask;
+            tick_t                  mDeadline;
+            timer_handle_t          mTimer;
+            std::coroutine_handle<> mAwaiter;
+            bool                    mTimedOut;
+        };
+
+        template <typename T> inline timeout_awaitable_t<T> with_timeout(timer_executor_t& executor, task_t<T>& task, const timespan_t& timeout) { return timeout_awaitable_t<T>(&executor, task, getTime() + toTicks(timeout)); }
+        template <typename T> inline timeout_awaitable_t<T> with_timeout(task_t<T>& task, const timespan_t& timeout) { return timeout_awaitable_t<T>(timer_executor_t::sCurrent(), task, getTime() + toTicks(timeout)); }
+    } // namespace ntime
+
+}; // namespace ncore
+
+#endif // __cpp_impl_coroutine
+
+#endif
@@ -0,0 +1,84 @@
+#ifndef __CTIME_TIMER_COALESCER_H__
+#define __CTIME_TIMER_COALESCER_H__
+#include "ccore/c_target.h"
+#ifdef USE_PRAGMA_ONCE
+#    pragma once
+#endif
+
+#include "ctime/c_time.h"
+#include "ctime/c_timespan.h"
+#include "ctime/c_timer_wheel.h"
+#include "ctime/c_deadline_queue.h"
+
+namespace ncore
+{
+    class alloc_t;
+
+    /**
+     * ------------------------------------------------------------------------------
+     *  Description:
+     *      A timer scheduler that coalesces wakeups. Every timer has a window, from its
+     *      deadline up to its deadline plus a slack, in which it may fire. The next wakeup
+     *      is the end of the earliest window and a wakeup fires every timer whose window
+     *      has started, so timers with overlapping windows fire together.
+     *
+     *      Two deadline queues hold the timers, one ordered by the start of the window
+     *      (what is due) and one by its end (when to wake up). Schedule and cancel are
+     *      O(log n). Deadlines are in getTime() ticks, the slack is a timespan_t.
+     *      Not thread-safe.
+     *
+     *  Example:
+     * <CODE>
+     *       coalescer.schedule(getTime() + secondsToTicks(30.0), timespan_t(0, 0, 0, 0, 50), onTimeout, connection);
+     *       ...
+     *       tick_t wakeup;
+     *       if (coalescer.nextWakeup(wakeup))
+     *           sleepUntil(wakeup);
+     *       coalescer.fire(getTime());
+     * </CODE>
+     * ------------------------------------------------------------------------------
+     */
+    class timer_coalescer_t
+    {
+    public:
+        timer_coalescer_t();
+        ~timer_coalescer_t();
+
+        bool init(alloc_t* allocator, u32 maxTimers);
+        void exit();
+
+        timer_handle_t schedule(tick_t deadline, const timespan_t& slack, timer_callback_t callback, void* user); ///< 0 when full
+        bool           cancel(timer_handle_t handle); ///< False when the handle is stale
+        bool           isScheduled(timer_handle_t handle) const;
+
+        bool nextWakeup(tick_t& wakeup) const; ///< The end of the earliest window, false when no timer is scheduled
+        u32  fire(tick_t now);                 ///< Fires every timer with a deadline <= now, returns the number fired
+
+        u32 size() const { return mEarliest.size(); }
+
+        ///@name Statistics, a wakeup is a fire() call that fired at least one timer
+        u64  getWakeups() const { return mWakeups; }
+        u64  getFired() const { return mFired; }
+        u64  getWakeupsSaved() const { return mFired - mWakeups; } ///< Compared to one wakeup per timer
+        void resetStats();
+
+    private:
+        struct node_t;
+
+        u32  nodeOf(timer_handle_t handle) const;
+        void release(u32 index);
+
+        alloc_t*         mAllocator;
+        node_t*          mNodes;
+        u32              mFree;
+        u32              mCapacity;
+        s64              mTicksPerSecond;
+        deadline_queue_t mEarliest; ///< By deadline
+        deadline_queue_t mLatest;   ///< By deadline plus slack
+        u64              mWakeups;
+        u64              mFired;
+    };
+
+}; // namespace ncore
+
+#endif
@@ -0,0 +1,98 @@
+#ifndef __CTIME_TIMER_EVENT_H__
+#define __CTIME_TIMER_EVENT_H__
+#include "ccore/c_target.h"
+#ifdef USE_PRAGMA_ONCE
+#    pragma once
+#endif
+
+#include "ctime/c_time.h"
+
+namespace ncore
+{
+    class timer_wheel_t;
+    class deadline_queue_t;
+    class timer_coalescer_t;
+
+    namespace ntime
+    {
+        // The timeout in milliseconds for epoll_wait/poll until 'deadline', rounded up so the
+        // loop never wakes up before it, 0 when it passed
+        extern s32 pollTimeout(tick_t deadline, tick_t now);
+
+        ///@name The timeout until the next deadline of a queue, -1 (infinite) when it is empty
+        extern s32 pollTimeout(const timer_wheel_t& wheel);
+        extern s32 pollTimeout(const deadline_queue_t& queue);
+        extern s32 pollTimeout(const timer_coalescer_t& coalescer);
+    } // namespace ntime
+
+#ifdef TARGET_LINUX
+
+    /**
+     * ------------------------------------------------------------------------------
+     *  Description:
+     *      One timerfd per event loop for the timers of a timer_wheel_t or a
+     *      timer_coalescer_t. The timerfd is armed with TFD_TIMER_ABSTIME on
+     *      CLOCK_MONOTONIC at the next deadline of the queue, mapped from getTime()
+     *      ticks with an offset measured by init().
+     *
+     *      Add getFd() to the epoll set (EPOLLIN). When it is readable dispatch()
+     *      fires every expired timer in one batch and re-arms the timerfd for the
+     *      next deadline, that one timerfd_settime also clears the readiness (no
+     *      read() needed). arm() skips the syscall when the deadline did not change,
+     *      so a loop makes at most one timer syscall per iteration.
+     *
+     *  Example:
+     * <CODE>
+     *       timer_fd_t timer;
+     *       timer.init();
+     *       epoll_ctl(epfd, EPOLL_CTL_ADD, timer.getFd(), &event);
+     *       for (;;)
+     *       {
+     *           timer.arm(wheel); // timers may have been scheduled since
+     *           s32 n = epoll_wait(epfd, events, 64, -1);
+     *           for (s32 i = 0; i < n; ++i)
+     *               if (events[i].data.fd == timer.getFd())
+     *                   timer.dispatch(wheel);
+     *       }
+     * </CODE>
+     * ------------------------------------------------------------------------------
+     */
+    class timer_fd_t
+    {
+    public:
+        timer_fd_t();
+        ~timer_fd_t();
+
+        bool init();
+        void exit();
+
+        s32 getFd() const { return mFd; }
+
+        bool arm(tick_t deadline); ///< No syscall when it is armed at 'deadline' already
+        bool disarm();
+
+        ///@name Arms at the next deadline of the queue, or disarms when it is empty
+        bool arm(const timer_wheel_t& wheel);
+        bool arm(const timer_coalescer_t& coalescer);
+
+        ///@name On readiness, fires the expired timers and re-arms, returns the number fired
+        u32 dispatch(timer_wheel_t& wheel);
+        u32 dispatch(timer_coalescer_t& coalescer);
+
+        u64 getSyscalls() const { return mSyscalls; } ///< Number of timerfd_settime calls
+
+    private:
+        bool settime(bool armed, tick_t deadline);
+
+        s32    mFd;
+        bool   mArmed;
+        tick_t mDeadline; ///< When armed
+        s64    mOffsetNs; ///< CLOCK_MONOTONIC at getTime() == 0
+        u64    mSyscalls;
+    };
+
+#endif // TARGET_LINUX
+
+}; // namespace ncore
+
+#endif
@@ -0,0 +1,83 @@
+#ifndef __CTIME_TIMER_SERVICE_H__
+#define __CTIME_TIMER_SERVICE_H__
+#include "ccore/c_target.h"
+#ifdef USE_PRAGMA_ONCE
+#    pragma once
+#endif
+
+#include "ctime/c_time.h"
+#include "ctime/c_timer_wheel.h"
+
+namespace ncore
+{
+    class alloc_t;
+
+    /**
+     * ------------------------------------------------------------------------------
+     *  Description:
+     *      A timer service for a pool of worker threads, every worker owns a timer_wheel_t
+     *      and there is no lock anywhere.
+     *
+     *      schedule() and cancel() may be called from any thread. A timer belongs to the
+     *      worker it was scheduled on, its node comes from a lock-free free list of that
+     *      worker and reaches the wheel through a lock-free multi-producer inbox that
+     *      the worker drains in poll(). A cancel of a timer that is in the wheel also
+     *      goes through the inbox, it takes effect at the next poll() of the owner
+     *      (the timer will not fire once cancel() returned true).
+     *
+     *      poll() is called by every worker thread with its own index. It drains the
+     *      inbox, advances the wheel and hands the expired timers out in batches
+     *      through a ring per worker. The owner runs its batches, a worker without
+     *      batches of its own steals from the others so a burst of expiries on one
+     *      worker is spread over the idle ones. Callbacks run on the thread that took
+     *      the batch.
+     *
+     *      Handles hold the worker (8 bits) and node (24 bits) in their low half and
+     *      the generation of the node in their high half.
+     * ------------------------------------------------------------------------------
+     */
+    class timer_service_t
+    {
+    public:
+        enum
+        {
+            MaxWorkers         = 256,
+            MaxTimersPerWorker = 1 << 24,
+            BatchSize          = 64,
+        };
+
+        timer_service_t();
+        ~timer_service_t();
+
+        bool init(alloc_t* allocator, s32 numWorkers, u32 timersPerWorker, tick_t resolution, tick_t now);
+        void exit(); ///< When no thread uses the service anymore
+
+        timer_handle_t schedule(s32 worker, tick_t deadline, timer_callback_t callback, void* user); ///< Any thread, 0 when the worker is full
+        bool           cancel(timer_handle_t handle);                                                ///< Any thread, false when it fired or is firing
+
+        u32 poll(s32 worker, tick_t now); ///< The thread of 'worker' only, returns the number of callbacks it ran
+
+        s32 getNumWorkers() const { return mNumWorkers; }
+
+        ///@name Statistics of a worker, exact once the workers are idle
+        void getStats(s32 worker, u64& fired, u64& batches, u64& stolen) const;
+
+    private:
+        struct node_t;
+        struct worker_t;
+
+        static void sDrainInbox(worker_t& worker);
+        static u32  sTakeBatches(worker_t& worker, worker_t& victim, bool steal);
+        static void sPublishBatch(worker_t& worker);
+        static u32  sRunBatch(worker_t& owner, u64 batch);
+        static void sRelease(worker_t& owner, node_t& node);
+        static void sOnExpired(timer_handle_t handle, void* user);
+
+        alloc_t*  mAllocator;
+        worker_t* mWorkers;
+        s32       mNumWorkers;
+    };
+
+}; // namespace ncore
+
+#endif
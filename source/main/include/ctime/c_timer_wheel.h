@@ -0,0 +1,95 @@
+#ifndef __CTIME_TIMER_WHEEL_H__
+#define __CTIME_TIMER_WHEEL_H__
+#include "ccore/c_target.h"
+#ifdef USE_PRAGMA_ONCE
+#    pragma once
+#endif
+
+#include "ctime/c_time.h"
+
+namespace ncore
+{
+    class alloc_t;
+
+    // Identifies a scheduled timer: the slot of its node (low 32 bits) and the generation of that
+    // node (high 32 bits). A handle turns stale once its timer fired or was cancelled, 0 is never valid.
+    typedef u64 timer_handle_t;
+
+    // Called once when the deadline of a timer has passed, the timer is no longer scheduled
+    typedef void (*timer_callback_t)(timer_handle_t handle, void* user);
+
+    /**
+     * ------------------------------------------------------------------------------
+     *  Description:
+     *      A hierarchical timing wheel (Varghese & Lauck, scheme 7) driven by the tick_t of
+     *      getTime(). Time is divided into slots of 'resolution' ticks, the wheel has 4
+     *      levels of 256 slots each (level n covers 256^(n+1) slots). A timer lives in
+     *      the slot of its deadline on the lowest level that reaches it, when the lowest
+     *      level wraps around the next slot of the level above is spread over the level
+     *      below (cascade). Deadlines beyond the top level wait in its farthest slot.
+     *
+     *      Schedule, cancel and reschedule are O(1), the nodes come from a pool of
+     *      'maxTimers' allocated once by init(). A timer fires at the first advance()
+     *      at or after its deadline, at most one slot late and never early. advance()
+     *      first collects every expired timer and then calls the callbacks, a
+     *      callback may schedule, cancel and reschedule (including timers of the same
+     *      batch that did not fire yet). Not thread-safe.
+     *
+     *  Example:
+     * <CODE>
+     *       timer_wheel_t wheel;
+     *       wheel.init(allocator, 1 << 20, millisecondsToTicks(1.0), getTime());
+     *       timer_handle_t idle = wheel.schedule(getTime() + secondsToTicks(30.0), onIdle, connection);
+     *       ...
+     *       wheel.reschedule(idle, getTime() + secondsToTicks(30.0)); // on activity
+     *       ...
+     *       wheel.advance(getTime()); // in the event loop
+     * </CODE>
+     * ------------------------------------------------------------------------------
+     */
+    class timer_wheel_t
+    {
+    public:
+        timer_wheel_t();
+        ~timer_wheel_t();
+
+        bool init(alloc_t* allocator, u32 maxTimers, tick_t resolution, tick_t now);
+        void exit();
+
+        timer_handle_t schedule(tick_t deadline, timer_callback_t callback, void* user); ///< 0 when the pool is exhausted
+        bool           cancel(timer_handle_t handle);                                    ///< False when the handle is stale
+        bool           reschedule(timer_handle_t handle, tick_t deadline);               ///< False when the handle is stale
+        bool           isScheduled(timer_handle_t handle) const;
+        bool           getDeadline(timer_handle_t handle, tick_t& deadline) const;
+
+        u32  advance(tick_t now);            ///< Fires the expired timers, returns the number fired
+        bool nextExpiry(tick_t& when) const; ///< When advance() has work next, false when no timer is scheduled
+
+        u32    size() const { return mCount; }
+        u32    capacity() const { return mCapacity; }
+        tick_t resolution() const { return mResolution; }
+
+    private:
+        struct node_t;
+
+        void insert(u32 index);
+        void unlink(u32 index);
+        void append(u32 list, u32 index);
+        void cascade(s32 level);
+        u32  nextOccupied(u32 slot) const;
+        u32  nodeOf(timer_handle_t handle) const;
+
+        alloc_t* mAllocator;
+        node_t*  mNodes;
+        u32*     mHeads; ///< Per slot list, plus the list of timers being fired
+        u32      mFree;  ///< First node of the free list
+        u32      mCapacity;
+        u32      mCount;
+        tick_t   mResolution;
+        s64      mCurrent;     ///< The next slot to expire, in units of 'resolution'
+        u64      mOccupied[4]; ///< Bit per non-empty slot of the lowest level
+    };
+
+}; // namespace ncore
+
+#endif
@@ -0,0 +1,61 @@
+#ifndef __CTIME_TIMESCALE_H__
+#define __CTIME_TIMESCALE_H__
+#include "ccore/c_target.h"
+#ifdef USE_PRAGMA_ONCE
+#    pragma once
+#endif
+
+#include "ctime/c_datetime.h"
+
+namespace ncore
+{
+    namespace ntime
+    {
+        /**
+         * ------------------------------------------------------------------------------
+         *  Description:
+         *      Conversions between the UTC, TAI and GPS time scales. A datetime_t in the
+         *      TAI or GPS scale holds the calendar reading of that scale in the usual
+         *      ticks, e.g. 2017-01-01 00:00:00 UTC is 2017-01-01 00:00:37 TAI and
+         *      2017-01-01 00:00:18 GPS. TAI and GPS have no leap seconds, GPS = TAI - 19s.
+         *
+         *      The offsets come from a leap second table, the compiled-in table can be
+         *      replaced by an IERS/NIST leap-seconds.list file. Every thread remembers the
+         *      period between two leap seconds it converted last, conversions within that
+         *      period do not search the table.
+         *
+         *      Before 1972 the offset of 1972 (10 seconds) is used. An inserted leap
+         *      second (23:59:60 UTC) cannot be represented in datetime_t, converting it
+         *      from TAI or GPS repeats 23:59:59.
+         * ------------------------------------------------------------------------------
+         */
+        extern s32 taiMinusUtc(datetime_t utc); ///< In seconds
+
+        extern datetime_t utcToTai(datetime_t utc);
+        extern datetime_t taiToUtc(datetime_t tai);
+        extern datetime_t utcToGps(datetime_t utc);
+        extern datetime_t gpsToUtc(datetime_t gps);
+        extern datetime_t taiToGps(datetime_t tai);
+        extern datetime_t gpsToTai(datetime_t gps);
+
+        ///@name Batch, 'in' and 'out' may be the same array
+        extern void utcToTai(const datetime_t* in, datetime_t* out, s64 count);
+        extern void taiToUtc(const datetime_t* in, datetime_t* out, s64 count);
+        extern void utcToGps(const datetime_t* in, datetime_t* out, s64 count);
+        extern void gpsToUtc(const datetime_t* in, datetime_t* out, s64 count);
+
+        ///@name Leap second table
+        ///      Loading replaces the table for all threads, do it before conversions start
+        ///      (e.g. at startup). A rejected file leaves the current table in place.
+        extern bool       loadLeapSeconds(const char* text, s64 length); ///< The content of a leap-seconds.list file
+        extern bool       loadLeapSecondsFile(const char* path);
+        extern void       resetLeapSeconds(); ///< Back to the compiled-in table
+        extern s32        getNumLeapSeconds();
+        extern datetime_t getLeapSecondsExpiry(); ///< The date after which the table may be incomplete
+        extern void       getLeapSecondCacheStats(u64& hits, u64& misses); ///< For the calling thread
+
+    } // namespace ntime
+
+}; // namespace ncore
+
+#endif
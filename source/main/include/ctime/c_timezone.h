@@ -0,0 +1,121 @@
+#ifndef __CTIME_TIMEZONE_H__
+#define __CTIME_TIMEZONE_H__
+#include "ccore/c_target.h"
+#ifdef USE_PRAGMA_ONCE
+#    pragma once
+#endif
+
+#include "ctime/c_datetime.h"
+
+namespace ncore
+{
+    struct timezone_rule_t;
+
+    // How a local time that does not exist (gap, the clock is turned forward) or that occurs
+    // twice (overlap, the clock is turned back) is converted to UTC.
+    enum ELocalTimePolicy
+    {
+        LocalTimeEarliest,     ///< Overlap: the first instant, gap: the wall clock time before the gap (moved back by its length)
+        LocalTimeLatest,       ///< Overlap: the second instant, gap: the wall clock time after the gap (moved forward by its length)
+        LocalTimeReject,       ///< Neither is converted
+        LocalTimeShiftForward, ///< Overlap: the first instant, gap: moved forward by its length
+    };
+
+    /**
+     * ------------------------------------------------------------------------------
+     *  Description:
+     *      A time zone backed by a TZif (RFC 8536, version 1, 2 and 3) transition table.
+     *      Zones are found by their IANA name (e.g. "Europe/Amsterdam") and are
+     *      memory-mapped from the zoneinfo directory. A subset of the zones is compiled
+     *      into the library (see package/tzdata) and is used when the zoneinfo directory
+     *      does not have the zone. The compiled-in zones have no transitions before
+     *      1970, earlier instants get the offset in effect on 1970-01-01. Either way the
+     *      transition table is searched in place, nothing is copied or converted.
+     *
+     *      Zones live in a process-wide cache, sFind() returns the same immutable
+     *      instance to every thread and zones are never unloaded. Offsets are in
+     *      seconds east of UTC.
+     *
+     *      After the last transition of the table the POSIX TZ string at the end of
+     *      the file (e.g. "CET-1CEST,M3.5.0,M10.5.0/3") gives the transitions, they are
+     *      computed per year when first needed and remembered by the zone.
+     *
+     *      Every thread remembers the period between two transitions (and its offset)
+     *      of the zones it used last, conversions that fall within that period do
+     *      not search the transition table.
+     *
+     *  Example:
+     * <CODE>
+     *       const timezone_t* tz = timezone_t::sFind("Europe/Amsterdam");
+     *       if (tz != nullptr)
+     *       {
+     *           datetime_t local = tz->utcToLocal(datetime_t::sNowUtc());
+     *       }
+     * </CODE>
+     * ------------------------------------------------------------------------------
+     */
+    class timezone_t
+    {
+    public:
+        const char* name() const { return mName; }
+
+        s32        offsetAt(datetime_t utc) const;
+        datetime_t utcToLocal(datetime_t utc) const;
+        datetime_t localToUtc(datetime_t local) const; ///< LocalTimeShiftForward
+        bool       localToUtc(datetime_t local, ELocalTimePolicy policy, datetime_t& utc) const;
+
+        void utcToLocal(const datetime_t* in, datetime_t* out, s64 count) const; ///< Fast path for sorted input
+
+        ///@name Batch, converts 'count' local times and returns the number converted successfully.
+        ///      Local times in a gap or an overlap have their bit set in 'gapMask' and 'overlapMask'
+        ///      (optional, (count + 63) / 64 words), 'in' and 'out' may be the same array.
+        s64 localToUtc(const datetime_t* in, datetime_t* out, s64 count, ELocalTimePolicy policy, u64* gapMask = nullptr, u64* overlapMask = nullptr) const;
+
+        ///@name Zone cache
+        static const timezone_t* sFind(const char* name);                                 ///< Load on first use, nullptr when unavailable (remembered until sSetZoneInfoPath)
+        static const timezone_t* sRegister(const char* name, const u8* tzif, u64 size);   ///< Zone backed by caller owned TZif data
+        static const timezone_t* sUtc();
+        static void              sSetZoneInfoPath(const char* path);                      ///< Default "/usr/share/zoneinfo"
+
+        ///@name Statistics of the per-thread period cache, for the calling thread
+        static void sGetCacheStats(u64& hits, u64& misses);
+        static void sResetCacheStats();
+
+    private:
+        timezone_t();
+
+        bool init(const char* name, const u8* data, u64 size, bool mapped);
+
+        s32  offsetAtTicks(s64 ticks) const;
+        void lookupPeriod(s64 ticks, s64& start, s64& end, s32& offset) const;
+        void periodOfTransition(s32 index, s64& start, s64& end, s32& offset) const;
+
+        s32  resolveLocal(s64 local, s64& earlier, s64& later) const;
+        bool rulePeriod(s64 ticks, s64& start, s64& end, s32& offset) const; ///< Period after the last transition, false when the rule does not apply
+
+        s32 findTransition(s64 seconds) const; ///< Last transition at or before 'seconds' (unix time), -1 when before the first
+        s64 transitionAt(s32 index) const;
+        s32 offsetOfTransition(s32 index) const;
+        s32 offsetOfType(s32 type) const;
+
+        const u8* mData;
+        u64       mSize;
+        bool      mMapped;
+
+        const u8*        mTimes;        ///< Big-endian transition times, mTimeSize bytes each
+        const u8*        mTypeIndices;  ///< Local time type per transition
+        const u8*        mTypes;        ///< 6 byte ttinfo records
+        const char*      mFooter;       ///< POSIX TZ string of a version 2+ file (not zero terminated)
+        timezone_rule_t* mRule;         ///< Compiled footer, nullptr when it has no DST rule
+        s32              mNumTimes;
+        s32              mNumTypes;
+        s32              mTimeSize;
+        s32              mFooterLength;
+        char             mName[64];
+
+        friend struct timezone_cache_t;
+    };
+
+}; // namespace ncore
+
+#endif
@@ -0,0 +1,68 @@
+#ifndef __CTIME_BITS_H__
+#define __CTIME_BITS_H__
+#include "ccore/c_target.h"
+#ifdef USE_PRAGMA_ONCE
+#    pragma once
+#endif
+
+namespace ncore
+{
+    namespace nbits
+    {
+        // Bit scans shared by the cron, rrule and timer wheel masks
+
+        // Index of the lowest set bit, 'mask' must not be 0
+        inline s32 lowestBit(u64 mask)
+        {
+#if defined(_MSC_VER)
+            unsigned long index;
+            _BitScanForward64(&index, mask);
+            return (s32)index;
+#else
+            return __builtin_ctzll(mask);
+#endif
+        }
+
+        // Index of the highest set bit, 'mask' must not be 0
+        inline s32 highestBit(u64 mask)
+        {
+#if defined(_MSC_VER)
+            unsigned long index;
+            _BitScanReverse64(&index, mask);
+            return (s32)index;
+#else
+            return 63 - __builtin_clzll(mask);
+#endif
+        }
+
+        inline s32 popCount(u32 mask)
+        {
+#if defined(_MSC_VER)
+            return (s32)__popcnt(mask);
+#else
+            return __builtin_popcount(mask);
+#endif
+        }
+
+        // The lowest set bit >= 'from', -1 when there is none
+        inline s32 nextBit(u64 mask, s32 from)
+        {
+            if (from >= 64)
+                return -1;
+            u64 const m = mask & (~D_CONSTANT_U64(0) << from);
+            return m != 0 ? lowestBit(m) : -1;
+        }
+
+        // The highest set bit <= 'from', -1 when there is none
+        inline s32 prevBit(u64 mask, s32 from)
+        {
+            if (from < 0)
+                return -1;
+            u64 const m = (from >= 63) ? mask : (mask & ((D_CONSTANT_U64(2) << from) - 1));
+            return m != 0 ? highestBit(m) : -1;
+        }
+
+    } // namespace nbits
+} // namespace ncore
+
+#endif
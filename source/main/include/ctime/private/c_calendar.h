@@ -0,0 +1,142 @@
+#ifndef __CTIME_CALENDAR_H__
+#define __CTIME_CALENDAR_H__
+#include "ccore/c_target.h"
+#ifdef USE_PRAGMA_ONCE
+#    pragma once
+#endif
+
+#include "ctime/private/c_bits.h"
+
+namespace ncore
+{
+    namespace ncalendar
+    {
+        // Tick constants shared by the datetime_t helpers (1 tick = 100 nanoseconds)
+        static const s64 TicksPerMicrosecond = 10;
+        static const s64 TicksPerMillisecond = 10000;
+        static const s64 TicksPerSecond      = 10000000;
+        static const s64 TicksPerMinute      = 600000000;
+        static const s64 TicksPerHour        = D_CONSTANT_S64(36000000000);
+        static const s64 TicksPerDay         = D_CONSTANT_S64(864000000000);
+        static const s64 MaxTicks            = D_CONSTANT_S64(0x2bca2875f4373fff);
+
+        // Day number of 1970-01-01 and the tick value of the unix epoch
+        static const s32 DaysTo1970 = 719162;
+        static const s64 EpochTicks = D_CONSTANT_S64(621355968000000000);
+
+        /**
+         *  Summary:
+         *      Branch-free conversion of a proleptic Gregorian date (year 1 through 9999) to
+         *      the number of days since 0001-01-01. The year is shifted to start in March so
+         *      that the leap day is the last day of the shifted year.
+         */
+        inline s32 daysFromCivil(s32 year, s32 month, s32 day)
+        {
+            year -= (month <= 2) ? 1 : 0;
+            s32 const era = year / 400;
+            s32 const yoe = year - era * 400;
+            s32 const doy = (153 * (month + ((month > 2) ? -3 : 9)) + 2) / 5 + day - 1;
+            s32 const doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+            return era * 146097 + doe - 306;
+        }
+
+        /**
+         *  Summary:
+         *      Inverse of daysFromCivil, returns year, month (1-12) and day (1-31) for a day
+         *      number since 0001-01-01.
+         */
+        inline void civilFromDays(s32 days, s32& year, s32& month, s32& day)
+        {
+            days += 306;
+            s32 const era = days / 146097;
+            s32 const doe = days - era * 146097;
+            s32 const yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+            s32 const doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+            s32 const mp  = (5 * doy + 2) / 153;
+            day           = doy - (153 * mp + 2) / 5 + 1;
+            month         = (mp < 10) ? (mp + 3) : (mp - 9);
+            year          = yoe + era * 400 + ((month <= 2) ? 1 : 0);
+        }
+
+        inline bool isLeapYear(s32 year) { return ((year & 3) == 0) && (((year % 100) != 0) || ((year % 400) == 0)); }
+
+        inline s32 daysInMonth(s32 year, s32 month)
+        {
+            if (month == 2)
+                return isLeapYear(year) ? 29 : 28;
+            return 30 + ((month + (month >> 3)) & 1);
+        }
+
+        // Day of week for a day number since 0001-01-01, 0 = Sunday (0001-01-01 is a Monday)
+        inline s32 dayOfWeek(s32 days) { return (days + 1) % 7; }
+
+        // First day number of the week containing 'days', weeks starting at 'firstDayOfWeek' (0 = Sunday)
+        inline s32 startOfWeek(s32 days, s32 firstDayOfWeek) { return days - (dayOfWeek(days) - firstDayOfWeek + 7) % 7; }
+
+        /**
+         *  Summary:
+         *      ISO 8601 week date of a day number. The week belongs to the year that holds
+         *      its Thursday, so only the Thursday needs a decomposition.
+         */
+        inline void isoWeekFromDays(s32 days, s32& weekYear, s32& week)
+        {
+            s32 const thursday = days - (days % 7) + 3; // day 0 is a Monday
+            s32       month, day;
+            civilFromDays(thursday, weekYear, month, day);
+            week = (thursday - daysFromCivil(weekYear, 1, 1)) / 7 + 1;
+        }
+
+        // Day number of an ISO 8601 week date, 'isoDay' 1 = Monday to 7 = Sunday
+        inline s32 daysFromIsoWeek(s32 weekYear, s32 week, s32 isoDay)
+        {
+            s32 const jan4 = daysFromCivil(weekYear, 1, 4);
+            return jan4 - (jan4 % 7) + (week - 1) * 7 + (isoDay - 1);
+        }
+
+        // 53 when the year starts on a Thursday, or is a leap year starting on a Wednesday
+        inline s32 isoWeeksInYear(s32 weekYear)
+        {
+            s32 const dow = dayOfWeek(daysFromCivil(weekYear, 1, 1));
+            return (dow == 4 || (dow == 3 && isLeapYear(weekYear))) ? 53 : 52;
+        }
+
+        // Week of the year where week 1 holds January 1st and weeks start at 'firstDayOfWeek'
+        inline s32 weekOfYear(s32 days, s32 dayOfYear, s32 firstDayOfWeek)
+        {
+            s32 const jan1 = days - dayOfYear + 1;
+            return (dayOfYear - 1 + (dayOfWeek(jan1) - firstDayOfWeek + 7) % 7) / 7 + 1;
+        }
+
+        /**
+         *  Summary:
+         *      Days of a month (bit 1 = day 1) that match a weekday mask (bit d, 0 = Sunday),
+         *      an nth weekday (bit (n - 1) * 7 + d) or an nth last weekday of the month (bit
+         *      (n - 1) * 7 + d counted from the end). 'first' is the day of the week of day 1.
+         */
+        inline u32 weekdaysOfMonth(s32 first, s32 days, u32 weekdays, u64 nth, u64 lastNth)
+        {
+            // Rotate the weekdays so that bit 1 is the day of the week of day 1, repeated for 5 weeks
+            u64 const week = ((u64)((weekdays >> first) | (weekdays << (7 - first))) & 0x7f) << 1;
+            u32       mask = (u32)(week | (week << 7) | (week << 14) | (week << 21) | (week << 28));
+            for (u64 m = nth; m != 0; m &= m - 1)
+            {
+                s32 const bit = nbits::lowestBit(m);
+                s32 const day = 1 + (bit % 7 - first + 7) % 7 + 7 * (bit / 7);
+                if (day <= days)
+                    mask |= (u32)1 << day;
+            }
+            for (u64 m = lastNth; m != 0; m &= m - 1)
+            {
+                s32 const bit = nbits::lowestBit(m);
+                s32 const f   = 1 + (bit % 7 - first + 7) % 7;
+                s32 const day = f + 7 * ((days - f) / 7) - 7 * (bit / 7);
+                if (day >= 1)
+                    mask |= (u32)1 << day;
+            }
+            return mask & ((((u32)1 << days) - 1) << 1);
+        }
+
+    } // namespace ncalendar
+} // namespace ncore
+
+#endif
@@ -0,0 +1,69 @@
+#ifndef __CTIME_DATE_LUT_H__
+#define __CTIME_DATE_LUT_H__
+#include "ccore/c_target.h"
+#ifdef USE_PRAGMA_ONCE
+#    pragma once
+#endif
+
+#include "ctime/private/c_calendar.h"
+
+// The table costs 187 KB, define CTIME_DATE_LUT as 0 to decompose with arithmetic only
+#ifndef CTIME_DATE_LUT
+#    define CTIME_DATE_LUT 1
+#endif
+
+namespace ncore
+{
+    namespace ncalendar
+    {
+        struct date_parts_t
+        {
+            s32 mYear;
+            s32 mMonth;     ///< 1 - 12
+            s32 mDay;       ///< 1 - 31
+            s32 mDayOfWeek; ///< 0 = Sunday
+            s32 mDayOfYear; ///< 1 - 366
+        };
+
+        // The window covered by the table, 1970-01-01 up to and including 2100-12-31
+        static const s32 LutFirstDay = DaysTo1970;
+        static const s32 LutNumDays  = 47847;
+
+        // Table entry bit layout: day of year (9), day of week (3), day (5), month (4), year - 1970 (8)
+        extern const u32* getDateLut(); ///< Built on first use
+
+        inline void unpackDateLut(u32 e, date_parts_t& parts)
+        {
+            parts.mDayOfYear = (s32)(e & 0x1ff);
+            parts.mDayOfWeek = (s32)((e >> 9) & 0x7);
+            parts.mDay       = (s32)((e >> 12) & 0x1f);
+            parts.mMonth     = (s32)((e >> 17) & 0xf);
+            parts.mYear      = (s32)(e >> 21) + 1970;
+        }
+
+        // Arithmetic decomposition, any day number of the datetime_t range
+        inline void decomposeDays(s32 days, date_parts_t& parts)
+        {
+            civilFromDays(days, parts.mYear, parts.mMonth, parts.mDay);
+            parts.mDayOfWeek = dayOfWeek(days);
+            parts.mDayOfYear = days - daysFromCivil(parts.mYear, 1, 1) + 1;
+        }
+
+        // Table lookup inside the window, arithmetic outside of it
+        inline void lookupDays(s32 days, date_parts_t& parts)
+        {
+#if CTIME_DATE_LUT
+            u32 const index = (u32)(days - LutFirstDay);
+            if (index < (u32)LutNumDays)
+            {
+                unpackDateLut(getDateLut()[index], parts);
+                return;
+            }
+#endif
+            decomposeDays(days, parts);
+        }
+
+    } // namespace ncalendar
+} // namespace ncore
+
+#endif
@@ -0,0 +1,71 @@
+#ifndef __CTIME_DIGITS_H__
+#define __CTIME_DIGITS_H__
+#include "ccore/c_target.h"
+#ifdef USE_PRAGMA_ONCE
+#    pragma once
+#endif
+
+namespace ncore
+{
+    namespace ndigits
+    {
+        // Helpers that convert numbers to ascii digits inside a 64-bit word. The first character
+        // of the resulting text is always in the lowest byte of the word, see store8.
+
+        static const u64 sAsciiZeros = D_CONSTANT_U64(0x3030303030303030);
+
+        // Every 16-bit lane holds a value 0-99, returns 8 ascii digits
+        inline u64 lanesToAscii(u64 lanes)
+        {
+            u64 const tens = ((lanes * 103) >> 10) & D_CONSTANT_U64(0x000F000F000F000F);
+            u64 const ones = lanes - (tens * 10);
+            return (tens | (ones << 8)) + sAsciiZeros;
+        }
+
+        // Value 0-99999999 as 8 ascii digits (leading zeros included)
+        inline u64 eightDigits(u32 value)
+        {
+            u64 const merged = (u64)(value / 10000) | ((u64)(value % 10000) << 32);
+            u64 const top    = ((merged * 10486) >> 20) & D_CONSTANT_U64(0x0000007F0000007F);
+            u64 const bot    = merged - (top * 100);
+            return lanesToAscii((bot << 16) + top);
+        }
+
+        // Four values 0-99 as 8 ascii digits
+        inline u64 fourPairs(u32 a, u32 b, u32 c, u32 d) { return lanesToAscii((u64)a | ((u64)b << 16) | ((u64)c << 32) | ((u64)d << 48)); }
+
+        inline void store8(char* dst, u64 v)
+        {
+            for (s32 i = 0; i < 8; ++i)
+                dst[i] = (char)(v >> (i * 8));
+        }
+
+        inline void storeN(char* dst, u64 v, s32 n)
+        {
+            for (s32 i = 0; i < n; ++i)
+                dst[i] = (char)(v >> (i * 8));
+        }
+
+        // Parsing helpers shared by the cron and rrule expressions
+
+        inline char toUpper(char c) { return ((u32)(c - 'a') < 26) ? (char)(c - 'a' + 'A') : c; }
+
+        // Parses 1 to 9 decimal digits, the whole of 'str' must be digits
+        inline bool parseDigits(const char* str, s32 len, s32& value)
+        {
+            if (len <= 0 || len > 9)
+                return false;
+            value = 0;
+            for (s32 i = 0; i < len; ++i)
+            {
+                if ((u32)(str[i] - '0') >= 10)
+                    return false;
+                value = value * 10 + (str[i] - '0');
+            }
+            return true;
+        }
+
+    } // namespace ndigits
+} // namespace ncore
+
+#endif
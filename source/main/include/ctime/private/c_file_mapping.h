@@ -0,0 +1,20 @@
+#ifndef __CTIME_FILE_MAPPING_H__
+#define __CTIME_FILE_MAPPING_H__
+#include "ccore/c_target.h"
+#ifdef USE_PRAGMA_ONCE
+#    pragma once
+#endif
+
+namespace ncore
+{
+    namespace ntime
+    {
+        // The platform specific part, read-only memory mapping of a whole file.
+        // Returns nullptr when the file cannot be opened or is empty.
+        extern const u8* mapFile(const char* path, u64& size);
+        extern void      unmapFile(const u8* data, u64 size);
+    } // namespace ntime
+
+}; // namespace ncore
+
+#endif
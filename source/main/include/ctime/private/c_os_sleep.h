@@ -0,0 +1,20 @@
+#ifndef __CTIME_OS_SLEEP_H__
+#define __CTIME_OS_SLEEP_H__
+#include "ccore/c_target.h"
+#ifdef USE_PRAGMA_ONCE
+#    pragma once
+#endif
+
+namespace ncore
+{
+    namespace ntime
+    {
+        // The platform specific part of sleepUntil, the sleep of the OS (which may
+        // return late, or early when interrupted) and a spin-wait hint for the CPU.
+        extern void osSleep(u64 nanoseconds);
+        extern void osPause();
+    } // namespace ntime
+
+}; // namespace ncore
+
+#endif
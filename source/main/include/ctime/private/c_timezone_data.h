@@ -0,0 +1,26 @@
+#ifndef __CTIME_TIMEZONE_DATA_H__
+#define __CTIME_TIMEZONE_DATA_H__
+#include "ccore/c_target.h"
+#ifdef USE_PRAGMA_ONCE
+#    pragma once
+#endif
+
+namespace ncore
+{
+    // A compiled-in zone, the data is a TZif image generated by package/tzdata
+    struct timezone_data_t
+    {
+        const char* mName;
+        const u8*   mData;
+        u32         mSize;
+    };
+
+    namespace ntime
+    {
+        // The compiled-in zones sorted by name, see c_timezone_data.cpp (generated)
+        extern const timezone_data_t* getBuiltinZones(s32& count);
+    } // namespace ntime
+
+}; // namespace ncore
+
+#endif
@@ -0,0 +1,61 @@
+#ifndef __CTIME_TEST_ALLOCATOR_H__
+#define __CTIME_TEST_ALLOCATOR_H__
+#include "ccore/c_target.h"
+#ifdef USE_PRAGMA_ONCE
+#    pragma once
+#endif
+
+#include "ccore/c_allocator.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <atomic>
+
+namespace ncore
+{
+    namespace ntest
+    {
+        // Allocator for the unit tests, honours the requested alignment (e.g. the 64-byte aligned
+        // nodes of deadline_queue_t) and counts the live allocations so tests can check for leaks.
+        // The counter is atomic, the timer service allocates from several threads.
+        class test_allocator_t : public alloc_t
+        {
+        public:
+            test_allocator_t()
+                : mNumAllocations(0)
+            {
+            }
+
+            s32 numAllocations() const { return mNumAllocations.load(std::memory_order_relaxed); }
+
+        protected:
+            virtual void* v_allocate(u32 size, u32 alignment)
+            {
+                // The address of the malloc'ed block is stored in front of the aligned block
+                alignment   = alignment < sizeof(void*) ? (u32)sizeof(void*) : alignment;
+                void* block = ::malloc(size + alignment + sizeof(void*));
+                if (block == nullptr)
+                    return nullptr;
+                mNumAllocations.fetch_add(1, std::memory_order_relaxed);
+                uintptr_t const aligned               = ((uintptr_t)block + sizeof(void*) + alignment - 1) & ~((uintptr_t)alignment - 1);
+                reinterpret_cast<void**>(aligned)[-1] = block;
+                return reinterpret_cast<void*>(aligned);
+            }
+
+            virtual void v_deallocate(void* mem)
+            {
+                if (mem == nullptr)
+                    return;
+                mNumAllocations.fetch_sub(1, std::memory_order_relaxed);
+                ::free(reinterpret_cast<void**>(mem)[-1]);
+            }
+
+            virtual void v_release() {}
+
+        private:
+            std::atomic<s32> mNumAllocations;
+        };
+    } // namespace ntest
+} // namespace ncore
+
+#endif
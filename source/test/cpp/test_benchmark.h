@@ -0,0 +1,35 @@
+#ifndef __CTIME_TEST_BENCHMARK_H__
+#define __CTIME_TEST_BENCHMARK_H__
+#include "ccore/c_target.h"
+#ifdef USE_PRAGMA_ONCE
+#    pragma once
+#endif
+
+#include "ctime/c_time.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+namespace ncore
+{
+    namespace ntest
+    {
+        // Benchmarks are opt-in, they only run when the environment variable CTIME_BENCHMARK is
+        // set (to anything but "0"). The unit tests run the same code with small sizes.
+        inline bool benchmarkEnabled()
+        {
+            const char* value = getenv("CTIME_BENCHMARK");
+            return value != nullptr && value[0] != 0 && !(value[0] == '0' && value[1] == 0);
+        }
+
+        // Prints one line: the name, the number of items, the elapsed time and items per second
+        inline void benchmarkReport(const char* name, s64 items, tick_t elapsed)
+        {
+            f64 const ms        = ticksToMs(elapsed);
+            f64 const perSecond = (ms > 0.0) ? ((f64)items * 1000.0 / ms) : 0.0;
+            printf("benchmark: %-48s %12lld items %10.3f ms %14.0f /s\n", name, (long long)items, ms, perSecond);
+        }
+    } // namespace ntest
+} // namespace ncore
+
+#endif
@@ -0,0 +1,236 @@
+#include "cunittest/cunittest.h"
+
+#include "ctime/c_datetime.h"
+#include "ctime/c_timespan.h"
+#include "ctime/c_timezone.h"
+#include "ctime/c_cron.h"
+
+using namespace ncore;
+
+UNITTEST_SUITE_BEGIN(cron)
+{
+    UNITTEST_FIXTURE(main)
+    {
+        UNITTEST_FIXTURE_SETUP() {}
+        UNITTEST_FIXTURE_TEARDOWN() {}
+
+        static bool sNextOf(const char* expression, datetime_t after, datetime_t expected)
+        {
+            cron_t     cron;
+            datetime_t when;
+            return cron.parse(expression) && cron.next(after, when) && when == expected;
+        }
+
+        UNITTEST_TEST(parse)
+        {
+            cron_t cron;
+            CHECK_TRUE(cron.parse("* * * * *"));
+            CHECK_TRUE(cron.parse("0 0 * * * *"));
+            CHECK_TRUE(cron.parse("  */5 1-5,10 L-3 JAN-mar,dec mon-FRI  "));
+            CHECK_TRUE(cron.parse("0 12 15W * ?"));
+            CHECK_TRUE(cron.parse("0 12 LW * ?"));
+            CHECK_TRUE(cron.parse("0 12 ? * 5L"));
+            CHECK_TRUE(cron.parse("0 12 ? * 1#2,FRI#5"));
+            CHECK_TRUE(cron.parse("@daily"));
+            CHECK_TRUE(cron.parse("@Hourly"));
+
+            CHECK_FALSE(cron.parse(""));
+            CHECK_FALSE(cron.parse("* * * *"));
+            CHECK_FALSE(cron.parse("* * * * * * *"));
+            CHECK_FALSE(cron.parse("60 * * * *"));
+            CHECK_FALSE(cron.parse("* 24 * * *"));
+            CHECK_FALSE(cron.parse("* * 0 * *"));
+            CHECK_FALSE(cron.parse("* * 32 * *"));
+            CHECK_FALSE(cron.parse("* * * 13 *"));
+            CHECK_FALSE(cron.parse("* * * * 8"));
+            CHECK_FALSE(cron.parse("*/0 * * * *"));
+            CHECK_FALSE(cron.parse("1, * * * *"));
+            CHECK_FALSE(cron.parse("? * * * *"));
+            CHECK_FALSE(cron.parse("* * * FOO *"));
+            CHECK_FALSE(cron.parse("* * * * 1#6"));
+            CHECK_FALSE(cron.parse("* * * * L"));
+            CHECK_FALSE(cron.parse("@weekday"));
+
+            // A failed parse leaves the schedule as it was
+            CHECK_TRUE(cron.parse("0 12 * * *"));
+            CHECK_FALSE(cron.parse("0 25 * * *"));
+            CHECK_TRUE(cron.matches(datetime_t(2024, 1, 1, 12, 0, 0)));
+            CHECK_FALSE(cron.matches(datetime_t(2024, 1, 1, 12, 1, 0)));
+        }
+
+        UNITTEST_TEST(next)
+        {
+            CHECK_TRUE(sNextOf("*/15 * * * *", datetime_t(2024, 1, 1, 10, 7, 30), datetime_t(2024, 1, 1, 10, 15, 0)));
+            CHECK_TRUE(sNextOf("*/15 * * * *", datetime_t(2024, 1, 1, 10, 15, 0), datetime_t(2024, 1, 1, 10, 30, 0)));
+            CHECK_TRUE(sNextOf("*/15 * * * *", datetime_t(2024, 12, 31, 23, 59, 59), datetime_t(2025, 1, 1, 0, 0, 0)));
+            CHECK_TRUE(sNextOf("30 */10 * * * *", datetime_t(2024, 1, 1, 10, 7, 30), datetime_t(2024, 1, 1, 10, 10, 30)));
+            CHECK_TRUE(sNextOf("0 22-2 * * *", datetime_t(2024, 1, 1, 3, 0, 0), datetime_t(2024, 1, 1, 22, 0, 0)));
+            CHECK_TRUE(sNextOf("0 9 * JAN-MAR MON-FRI", datetime_t(2024, 3, 29, 9, 0, 0), datetime_t(2025, 1, 1, 9, 0, 0)));
+            CHECK_TRUE(sNextOf("0 9 * * FRI-MON", datetime_t(2024, 6, 4, 0, 0, 0), datetime_t(2024, 6, 7, 9, 0, 0)));
+            CHECK_TRUE(sNextOf("0 9 * * 7", datetime_t(2024, 6, 4, 0, 0, 0), datetime_t(2024, 6, 9, 9, 0, 0)));
+            CHECK_TRUE(sNextOf("@yearly", datetime_t(2024, 6, 4, 0, 0, 0), datetime_t(2025, 1, 1, 0, 0, 0)));
+
+            // February 29th, 4 years ahead, and the 30th never
+            CHECK_TRUE(sNextOf("0 0 29 2 *", datetime_t(2024, 3, 1), datetime_t(2028, 2, 29)));
+            CHECK_TRUE(sNextOf("0 0 29 2 1", datetime_t(2024, 3, 1), datetime_t(2025, 2, 3)));
+            cron_t     cron;
+            datetime_t when;
+            CHECK_TRUE(cron.parse("0 0 30 2 *"));
+            CHECK_FALSE(cron.next(datetime_t(2024, 1, 1), when));
+            CHECK_FALSE(cron.prev(datetime_t(2024, 1, 1), when));
+
+            // Restricted day of month and day of week, either one
+            CHECK_TRUE(sNextOf("0 0 13 * 5", datetime_t(2024, 9, 1), datetime_t(2024, 9, 6)));
+            CHECK_TRUE(sNextOf("0 0 13 * 5", datetime_t(2024, 9, 6), datetime_t(2024, 9, 13)));
+            CHECK_TRUE(sNextOf("0 0 13 * 5", datetime_t(2024, 9, 13), datetime_t(2024, 9, 20)));
+            CHECK_TRUE(sNextOf("0 0 */10 * *", datetime_t(2024, 9, 1), datetime_t(2024, 9, 11)));
+            CHECK_TRUE(sNextOf("0 0 * * 5", datetime_t(2024, 9, 1), datetime_t(2024, 9, 6)));
+        }
+
+        UNITTEST_TEST(special)
+        {
+            // Last day, and days before it
+            CHECK_TRUE(sNextOf("0 0 L * *", datetime_t(2024, 2, 10), datetime_t(2024, 2, 29)));
+            CHECK_TRUE(sNextOf("0 0 L * *", datetime_t(2024, 2, 29), datetime_t(2024, 3, 31)));
+            CHECK_TRUE(sNextOf("0 0 L-2 * *", datetime_t(2023, 2, 1), datetime_t(2023, 2, 26)));
+            CHECK_TRUE(sNextOf("0 0 L-30 * *", datetime_t(2023, 2, 1), datetime_t(2023, 3, 1)));
+
+            // Nearest weekday, within the month (2024-06-01 is a Saturday)
+            CHECK_TRUE(sNextOf("0 0 15W * *", datetime_t(2024, 6, 1), datetime_t(2024, 6, 14)));
+            CHECK_TRUE(sNextOf("0 0 1W * *", datetime_t(2024, 5, 31), datetime_t(2024, 6, 3)));
+            CHECK_TRUE(sNextOf("0 0 30W * *", datetime_t(2024, 6, 1), datetime_t(2024, 6, 28)));
+            CHECK_TRUE(sNextOf("0 0 10W * *", datetime_t(2024, 6, 1), datetime_t(2024, 6, 10)));
+            CHECK_TRUE(sNextOf("0 0 31W * *", datetime_t(2024, 6, 1), datetime_t(2024, 7, 31)));
+            CHECK_TRUE(sNextOf("0 0 LW * *", datetime_t(2024, 8, 1), datetime_t(2024, 8, 30)));
+            CHECK_TRUE(sNextOf("0 0 LW * *", datetime_t(2024, 9, 1), datetime_t(2024, 9, 30)));
+
+            // Last and n-th day of the week
+            CHECK_TRUE(sNextOf("0 0 * * 5L", datetime_t(2024, 1, 1), datetime_t(2024, 1, 26)));
+            CHECK_TRUE(sNextOf("0 0 * * SUNL", datetime_t(2024, 3, 1), datetime_t(2024, 3, 31)));
+            CHECK_TRUE(sNextOf("0 0 * * 1#2", datetime_t(2024, 1, 1), datetime_t(2024, 1, 8)));
+            CHECK_TRUE(sNextOf("0 0 * * 1#1", datetime_t(2024, 1, 1), datetime_t(2024, 2, 5)));
+            CHECK_TRUE(sNextOf("0 0 * * 3#5", datetime_t(2024, 2, 1), datetime_t(2024, 5, 29)));
+        }
+
+        UNITTEST_TEST(prev)
+        {
+            cron_t     cron;
+            datetime_t when;
+            CHECK_TRUE(cron.parse("*/15 * * * *"));
+            CHECK_TRUE(cron.prev(datetime_t(2024, 1, 1, 10, 15, 0), when));
+            CHECK_TRUE(when == datetime_t(2024, 1, 1, 10, 0, 0));
+            CHECK_TRUE(cron.prev(datetime_t(2024, 1, 1, 10, 15, 0, 1), when));
+            CHECK_TRUE(when == datetime_t(2024, 1, 1, 10, 15, 0));
+            CHECK_TRUE(cron.prev(datetime_t(2024, 1, 1, 0, 0, 0), when));
+            CHECK_TRUE(when == datetime_t(2023, 12, 31, 23, 45, 0));
+
+            CHECK_TRUE(cron.parse("0 0 L * *"));
+            CHECK_TRUE(cron.prev(datetime_t(2024, 3, 1), when));
+            CHECK_TRUE(when == datetime_t(2024, 2, 29));
+            CHECK_TRUE(cron.parse("0 0 29 2 *"));
+            CHECK_TRUE(cron.prev(datetime_t(2024, 2, 29), when));
+            CHECK_TRUE(when == datetime_t(2020, 2, 29));
+
+            // prev() undoes next()
+            const char* expressions[] = {"*/7 * * * *", "0 30 9 * * MON-FRI", "0 0 L,15 * *", "0 12 ? * 2#3,6L", "0 0 1W,LW * *", "0 0 13 * 5", "15 3 29 2 *"};
+            for (s32 e = 0; e < (s32)(sizeof(expressions) / sizeof(expressions[0])); ++e)
+            {
+                CHECK_TRUE(cron.parse(expressions[e]));
+                datetime_t t = datetime_t(2023, 11, 5, 17, 23, 11);
+                for (s32 i = 0; i < 50; ++i)
+                {
+                    datetime_t next, back;
+                    CHECK_TRUE(cron.next(t, next));
+                    CHECK_TRUE(cron.matches(next));
+                    CHECK_TRUE(cron.prev(next, back));
+                    CHECK_TRUE(back == t || (back < t && !cron.matches(t)));
+                    t = next;
+                }
+            }
+        }
+
+        UNITTEST_TEST(brute_force)
+        {
+            // next() matches stepping minute by minute
+            const char* expressions[] = {"*/13 */5 * * *", "0 0 L-1 * *", "0 6 ? * 1#1,5L", "0 0 1-7 * 0", "5 4 15W * *", "0 0 LW * *"};
+            for (s32 e = 0; e < (s32)(sizeof(expressions) / sizeof(expressions[0])); ++e)
+            {
+                cron_t cron;
+                CHECK_TRUE(cron.parse(expressions[e]));
+                datetime_t t = datetime_t(2024, 1, 27, 0, 0, 0);
+                for (s32 i = 0; i < 5; ++i)
+                {
+                    datetime_t next;
+                    CHECK_TRUE(cron.next(t, next));
+                    datetime_t step = t;
+                    do
+                    {
+                        step.addMinutes(1);
+                    } while (!cron.matches(step));
+                    CHECK_TRUE(next == step);
+                    t = next;
+                }
+            }
+        }
+
+        UNITTEST_TEST(timezone)
+        {
+            const timezone_t* tz = timezone_t::sFind("Europe/Amsterdam");
+            CHECK_TRUE(tz != nullptr);
+            if (tz == nullptr)
+                return;
+
+            cron_t     cron;
+            datetime_t when;
+            CHECK_TRUE(cron.parse("30 2 * * *"));
+            CHECK_TRUE(cron.next(datetime_t(2024, 7, 1, 12, 0, 0), when, tz));
+            CHECK_TRUE(when == datetime_t(2024, 7, 2, 0, 30, 0)); // CEST
+
+            // 02:30 is skipped on 2024-03-31, it fires at 03:30 CEST
+            CHECK_TRUE(cron.next(datetime_t(2024, 3, 30, 12, 0, 0), when, tz));
+            CHECK_TRUE(when == datetime_t(2024, 3, 31, 1, 30, 0));
+            CHECK_TRUE(cron.next(when, when, tz));
+            CHECK_TRUE(when == datetime_t(2024, 4, 1, 0, 30, 0));
+
+            // 02:30 occurs twice on 2024-10-27, it fires once
+            CHECK_TRUE(cron.next(datetime_t(2024, 10, 26, 12, 0, 0), when, tz));
+            CHECK_TRUE(when == datetime_t(2024, 10, 27, 0, 30, 0));
+            CHECK_TRUE(cron.next(when, when, tz));
+            CHECK_TRUE(when == datetime_t(2024, 10, 28, 1, 30, 0));
+            CHECK_TRUE(cron.prev(when, when, tz));
+            CHECK_TRUE(when == datetime_t(2024, 10, 27, 0, 30, 0));
+        }
+
+        UNITTEST_TEST(batch)
+        {
+            const char* expressions[] = {"*/5 * * * *", "0 0 L * *", "0 9 * * MON-FRI", "0 0 30 2 *", "0 12 ? * 5#3", "30 */10 * * * *", "@weekly", "0 0 29 2 *"};
+            s32 const   numExpressions = (s32)(sizeof(expressions) / sizeof(expressions[0]));
+            cron_t      compiled[8];
+            for (s32 e = 0; e < numExpressions; ++e)
+                CHECK_TRUE(compiled[e].parse(expressions[e]));
+
+            s64 const   count = 100000;
+            cron_t*     crons = new cron_t[count];
+            datetime_t* out   = new datetime_t[count];
+            u64*        fails = new u64[(count + 63) / 64];
+            for (s64 i = 0; i < count; ++i)
+                crons[i] = compiled[i % numExpressions];
+
+            datetime_t const after = datetime_t(2024, 5, 17, 13, 41, 7);
+            s64 const        found = cron_t::sNext(crons, count, after, out, fails);
+            CHECK_EQUAL(count - count / numExpressions, found);
+            for (s64 i = 0; i < numExpressions; ++i)
+            {
+                datetime_t when;
+                bool const ok = compiled[i].next(after, when);
+                CHECK_EQUAL(ok, ((fails[i >> 6] >> (i & 63)) & 1) == 0);
+                CHECK_TRUE(ok ? (out[i] == when) : (out[i] == datetime_t::sMaxValue));
+            }
+
+            delete[] crons;
+            delete[] out;
+            delete[] fails;
+        }
+    }
+}
+UNITTEST_SUITE_END
@@ -0,0 +1,116 @@
+#include "cunittest/cunittest.h"
+
+#include "ctime/c_date.h"
+#include "ctime/c_datetime.h"
+
+using namespace ncore;
+
+UNITTEST_SUITE_BEGIN(date)
+{
+    UNITTEST_FIXTURE(main)
+    {
+        UNITTEST_FIXTURE_SETUP() {}
+        UNITTEST_FIXTURE_TEARDOWN() {}
+
+        UNITTEST_TEST(date)
+        {
+            CHECK_EQUAL(4, (s32)sizeof(date_t));
+
+            date_t const d(2024, 2, 29);
+            CHECK_EQUAL(2024, d.year());
+            CHECK_EQUAL(February, d.month());
+            CHECK_EQUAL(29, d.day());
+            CHECK_EQUAL(60, d.dayOfYear());
+            CHECK_EQUAL(Thursday, d.dayOfWeek());
+            CHECK_TRUE(d.toDateTime() == datetime_t(2024, 2, 29));
+            CHECK_TRUE(date_t(datetime_t(2024, 2, 29, 23, 59, 59)) == d);
+            CHECK_EQUAL((s32)(datetime_t(2024, 2, 29).ticks() / D_CONSTANT_U64(864000000000)), d.dayNumber());
+
+            s32 y, m, dd;
+            date_t::sMaxValue.decompose(y, m, dd);
+            CHECK_EQUAL(9999, y);
+            CHECK_EQUAL(12, m);
+            CHECK_EQUAL(31, dd);
+            CHECK_TRUE(date_t::sMinValue == date_t(1, 1, 1));
+        }
+
+        UNITTEST_TEST(date_arithmetic)
+        {
+            date_t d(2024, 1, 31);
+            d.addMonths(1);
+            CHECK_TRUE(d == date_t(2024, 2, 29));
+            d.addYears(1);
+            CHECK_TRUE(d == date_t(2025, 2, 28));
+            d.addMonths(-14);
+            CHECK_TRUE(d == date_t(2023, 12, 28));
+            d.addDays(4);
+            CHECK_TRUE(d == date_t(2024, 1, 1));
+            CHECK_EQUAL(366, date_t(2025, 1, 1).subtract(d));
+            CHECK_TRUE(d < date_t(2024, 1, 2));
+            CHECK_EQUAL(1, date_t(2024, 1, 2).compareTo(d));
+        }
+
+        UNITTEST_TEST(time_of_day)
+        {
+            CHECK_EQUAL(4, (s32)sizeof(time_of_day_t));
+
+            time_of_day_t const t(13, 45, 30, 250);
+            CHECK_EQUAL(13, t.hour());
+            CHECK_EQUAL(45, t.minute());
+            CHECK_EQUAL(30, t.second());
+            CHECK_EQUAL(250, t.millisecond());
+            CHECK_EQUAL(0, t.microsecond());
+
+            // Truncated to 100 microseconds
+            datetime_t const dt((u64)datetime_t(2024, 2, 29, 13, 45, 30, 250).ticks() + 1234);
+            time_of_day_t const u(dt);
+            CHECK_EQUAL(250, u.millisecond());
+            CHECK_EQUAL(100, u.microsecond());
+            CHECK_TRUE(date_t(dt).toDateTime(u) == datetime_t((u64)dt.ticks() - 234));
+
+            time_of_day_t w(23, 30, 0);
+            w.addMinutes(45);
+            CHECK_TRUE(w == time_of_day_t(0, 15, 0));
+            w.addHours(-1);
+            CHECK_TRUE(w == time_of_day_t(23, 15, 0));
+            w.addMilliseconds(-1);
+            CHECK_TRUE(w == time_of_day_t(23, 14, 59, 999));
+            CHECK_EQUAL(-10, w.subtract(time_of_day_t(23, 15, 0)));
+            CHECK_TRUE(time_of_day_t::sMaxValue.units() == (u32)(time_of_day_t::UnitsPerDay - 1));
+        }
+
+        UNITTEST_TEST(columns)
+        {
+            datetime_t    in[100];
+            date_t        dates[100];
+            time_of_day_t times[100];
+            datetime_t    out[100];
+            u64           t = datetime_t(1999, 12, 31).ticks();
+            for (s32 i = 0; i < 100; ++i, t += D_CONSTANT_U64(123456789012000))
+                in[i] = datetime_t(t);
+
+            ntime::splitColumn(in, dates, times, 100);
+            ntime::combineColumn(dates, times, out, 100);
+            for (s32 i = 0; i < 100; ++i)
+            {
+                CHECK_TRUE(dates[i] == date_t(in[i]));
+                CHECK_TRUE(times[i] == time_of_day_t(in[i]));
+                CHECK_TRUE(out[i] == in[i]);
+            }
+
+            s32 years[100], months[100], days[100];
+            ntime::decomposeColumn(dates, years, months, days, 100);
+            for (s32 i = 0; i < 100; ++i)
+            {
+                CHECK_EQUAL(in[i].year(), years[i]);
+                CHECK_EQUAL((s32)in[i].month(), months[i]);
+                CHECK_EQUAL(in[i].day(), days[i]);
+            }
+
+            ntime::combineColumn(dates, nullptr, out, 100);
+            for (s32 i = 0; i < 100; ++i)
+                CHECK_TRUE(out[i] == in[i].date());
+        }
+    }
+}
+UNITTEST_SUITE_END
@@ -0,0 +1,125 @@
+#include "cunittest/cunittest.h"
+
+#include "ctime/c_datetime.h"
+#include "ctime/c_time.h"
+#include "ctime/c_timer.h"
+#include "ctime/private/c_date_lut.h"
+
+#include "test_benchmark.h"
+
+using namespace ncore;
+
+UNITTEST_SUITE_BEGIN(date_lut)
+{
+    UNITTEST_FIXTURE(main)
+    {
+        UNITTEST_FIXTURE_SETUP() { ntime::init(); }
+        UNITTEST_FIXTURE_TEARDOWN() { ntime::exit(); }
+
+        static bool sEqual(ncalendar::date_parts_t const& a, ncalendar::date_parts_t const& b)
+        {
+            return a.mYear == b.mYear && a.mMonth == b.mMonth && a.mDay == b.mDay && a.mDayOfWeek == b.mDayOfWeek && a.mDayOfYear == b.mDayOfYear;
+        }
+
+        UNITTEST_TEST(table_matches_arithmetic)
+        {
+            const u32* lut = ncalendar::getDateLut();
+            s32        bad = 0;
+            for (s32 i = 0; i < ncalendar::LutNumDays; ++i)
+            {
+                ncalendar::date_parts_t a, b;
+                ncalendar::unpackDateLut(lut[i], a);
+                ncalendar::decomposeDays(ncalendar::LutFirstDay + i, b);
+                bad += sEqual(a, b) ? 0 : 1;
+            }
+            CHECK_EQUAL(0, bad);
+
+            ncalendar::date_parts_t last;
+            ncalendar::unpackDateLut(lut[ncalendar::LutNumDays - 1], last);
+            CHECK_EQUAL(2100, last.mYear);
+            CHECK_EQUAL(365, last.mDayOfYear);
+        }
+
+        UNITTEST_TEST(window_edges)
+        {
+            // Inside and just outside the window of the table
+            datetime_t const dates[] = {datetime_t(1969, 12, 31), datetime_t(1970, 1, 1), datetime_t(2000, 2, 29), datetime_t(2100, 12, 31), datetime_t(2101, 1, 1)};
+            s32 const        years[] = {1969, 1970, 2000, 2100, 2101};
+            s32 const        months[] = {12, 1, 2, 12, 1};
+            s32 const        days[] = {31, 1, 29, 31, 1};
+            s32 const        doys[] = {365, 1, 60, 365, 1};
+            for (s32 i = 0; i < 5; ++i)
+            {
+                CHECK_EQUAL(years[i], dates[i].year());
+                CHECK_EQUAL(months[i], (s32)dates[i].month());
+                CHECK_EQUAL(days[i], dates[i].day());
+                CHECK_EQUAL(doys[i], dates[i].dayOfYear());
+            }
+
+            datetime_t dt(2100, 11, 30);
+            dt.addMonths(2);
+            CHECK_TRUE(dt == datetime_t(2101, 1, 30));
+        }
+
+        // Decomposes 'count' day numbers, hot walks a small window, cold hops over the whole table
+        static s64 sRun(bool table, bool hot, s32 count, tick_t& elapsed)
+        {
+            ncore::timer_t timer;
+            timer.start();
+            s64 sum   = 0;
+            u32 state = 0x9e3779b9;
+            for (s32 i = 0; i < count; ++i)
+            {
+                s32 days;
+                if (hot)
+                {
+                    days = ncalendar::LutFirstDay + 19000 + (i & 1023);
+                }
+                else
+                {
+                    state ^= state << 13;
+                    state ^= state >> 17;
+                    state ^= state << 5;
+                    days = ncalendar::LutFirstDay + (s32)(state % (u32)ncalendar::LutNumDays);
+                }
+                ncalendar::date_parts_t parts;
+                if (table)
+                    ncalendar::lookupDays(days, parts);
+                else
+                    ncalendar::decomposeDays(days, parts);
+                sum += parts.mYear + parts.mMonth + parts.mDay + parts.mDayOfWeek + parts.mDayOfYear;
+            }
+            elapsed = timer.stop();
+            return sum;
+        }
+
+        static s64 sRun(bool table, bool hot, s32 count)
+        {
+            tick_t elapsed;
+            return sRun(table, hot, count, elapsed);
+        }
+
+        UNITTEST_TEST(table_vs_arithmetic)
+        {
+            s32 const count = 1 << 16;
+            CHECK_EQUAL(sRun(false, true, count), sRun(true, true, count));
+            CHECK_EQUAL(sRun(false, false, count), sRun(true, false, count));
+        }
+
+        UNITTEST_TEST(benchmark)
+        {
+            // Opt-in (CTIME_BENCHMARK), reports the table and the arithmetic for hot and cold days
+            if (!ntest::benchmarkEnabled())
+                return;
+            s32 const count = 1 << 24;
+            tick_t    tableHot, arithHot, tableCold, arithCold;
+            CHECK_EQUAL(sRun(false, true, count, arithHot), sRun(true, true, count, tableHot));
+            CHECK_EQUAL(sRun(false, false, count, arithCold), sRun(true, false, count, tableCold));
+            ntest::benchmarkReport("date_lut table, hot", count, tableHot);
+            ntest::benchmarkReport("date_lut arithmetic, hot", count, arithHot);
+            ntest::benchmarkReport("date_lut table, cold", count, tableCold);
+            ntest::benchmarkReport("date_lut arithmetic, cold", count, arithCold);
+        }
+    }
+}
+UNITTEST_SUITE_END
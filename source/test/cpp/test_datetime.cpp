@@ -637,6 +637,69 @@ UNITTEST_SUITE_BEGIN(datetime)
 			CHECK_TRUE(dt1 == dt2);
 		}
 
+		//==============================================================================
+		// ISO WEEK DATE AND WEEK OF YEAR UNITTEST
+		//==============================================================================
+		UNITTEST_TEST(isoWeek)
+		{
+			// Week years differing from the calendar year around January 1st
+			CHECK_EQUAL(53, datetime_t(2021, 1, 1).isoWeek());
+			CHECK_EQUAL(2020, datetime_t(2021, 1, 1).isoWeekYear());
+			CHECK_EQUAL(1, datetime_t(2008, 12, 29).isoWeek());
+			CHECK_EQUAL(2009, datetime_t(2008, 12, 29).isoWeekYear());
+			CHECK_EQUAL(53, datetime_t(2010, 1, 3, 23, 59, 59).isoWeek());
+			CHECK_EQUAL(2009, datetime_t(2010, 1, 3).isoWeekYear());
+			CHECK_EQUAL(1, datetime_t(2007, 1, 1).isoWeek());
+			CHECK_EQUAL(1, datetime_t(1, 1, 1).isoWeek());
+			CHECK_EQUAL(1, datetime_t(1, 1, 1).isoWeekYear());
+
+			CHECK_EQUAL(53, datetime_t::sIsoWeeksInYear(2020));
+			CHECK_EQUAL(52, datetime_t::sIsoWeeksInYear(2021));
+			CHECK_EQUAL(53, datetime_t::sIsoWeeksInYear(2004));
+			CHECK_EQUAL(53, datetime_t::sIsoWeeksInYear(2015));
+			CHECK_EQUAL(53, datetime_t::sIsoWeeksInYear(2026));
+			CHECK_EQUAL(52, datetime_t::sIsoWeeksInYear(2027));
+		}
+		UNITTEST_TEST(sFromIsoWeekDate)
+		{
+			CHECK_TRUE(datetime_t::sFromIsoWeekDate(2020, 53, 5) == datetime_t(2021, 1, 1));
+			CHECK_TRUE(datetime_t::sFromIsoWeekDate(2009, 1, 1) == datetime_t(2008, 12, 29));
+			CHECK_TRUE(datetime_t::sFromIsoWeekDate(2009, 53, 7) == datetime_t(2010, 1, 3));
+			CHECK_TRUE(datetime_t::sFromIsoWeekDate(1, 1, 1) == datetime_t(1, 1, 1));
+
+			// Round trip over a few years
+			datetime_t dt(2019, 12, 1);
+			for (s32 i = 0; i < 800; ++i)
+			{
+				datetime_t const back = datetime_t::sFromIsoWeekDate(dt.isoWeekYear(), dt.isoWeek(), dt.dayOfWeek() == Sunday ? 7 : (s32)dt.dayOfWeek());
+				CHECK_TRUE(back == dt);
+				dt.addDays(1);
+			}
+		}
+		UNITTEST_TEST(weekOfYear)
+		{
+			// 2024-01-01 is a Monday
+			CHECK_EQUAL(1, datetime_t(2024, 1, 1).weekOfYear(Sunday));
+			CHECK_EQUAL(2, datetime_t(2024, 1, 7).weekOfYear(Sunday));
+			CHECK_EQUAL(1, datetime_t(2024, 1, 7).weekOfYear(Monday));
+			CHECK_EQUAL(2, datetime_t(2024, 1, 8).weekOfYear(Mon));
+			CHECK_EQUAL(53, datetime_t(2024, 12, 31).weekOfYear(Sunday));
+
+			// 2000 is a leap year starting on a Saturday
+			CHECK_EQUAL(54, datetime_t(2000, 12, 31).weekOfYear(Sunday));
+		}
+		UNITTEST_TEST(startOfWeek)
+		{
+			datetime_t const dt(2024, 1, 3, 15, 30, 0);
+			CHECK_TRUE(dt.startOfWeek() == datetime_t(2024, 1, 1));
+			CHECK_TRUE(dt.startOfWeek(Sunday) == datetime_t(2023, 12, 31));
+			CHECK_TRUE(dt.startOfWeek(Wednesday) == datetime_t(2024, 1, 3));
+			CHECK_TRUE(dt.startOfWeek(Thursday) == datetime_t(2023, 12, 28));
+
+			// The week of 0001-01-01 (a Monday) starting on Sunday begins before datetime_t
+			CHECK_TRUE(datetime_t(1, 1, 3).startOfWeek(Sunday) == datetime_t::sMinValue);
+		}
+
 		//==============================================================================
 		// INLINE FUNCTION UNITTEST OF CLASS XTIMER
 		//==============================================================================
@@ -0,0 +1,140 @@
+#include "cunittest/cunittest.h"
+
+#include "ctime/c_datetime.h"
+#include "ctime/c_datetime_column.h"
+
+using namespace ncore;
+
+UNITTEST_SUITE_BEGIN(datetime_column)
+{
+    UNITTEST_FIXTURE(main)
+    {
+        UNITTEST_FIXTURE_SETUP() {}
+        UNITTEST_FIXTURE_TEARDOWN() {}
+
+        UNITTEST_TEST(week_dates)
+        {
+            // Consecutive days around two year ends, compared with the scalar API
+            datetime_t column[40];
+            datetime_t dt(2020, 12, 20, 8, 0, 0);
+            for (s32 i = 0; i < 20; ++i, dt.addDays(1))
+                column[i] = dt;
+            dt = datetime_t(1999, 12, 20, 23, 59, 59);
+            for (s32 i = 20; i < 40; ++i, dt.addDays(1))
+                column[i] = dt;
+
+            s32        weekYears[40], weeks[40], sundayWeeks[40];
+            datetime_t starts[40];
+            ntime::isoWeekColumn(column, weekYears, weeks, 40);
+            ntime::weekOfYearColumn(column, Sunday, sundayWeeks, 40);
+            ntime::startOfWeekColumn(column, Monday, starts, 40);
+            for (s32 i = 0; i < 40; ++i)
+            {
+                CHECK_EQUAL(column[i].isoWeekYear(), weekYears[i]);
+                CHECK_EQUAL(column[i].isoWeek(), weeks[i]);
+                CHECK_EQUAL(column[i].weekOfYear(Sunday), sundayWeeks[i]);
+                CHECK_TRUE(column[i].startOfWeek(Monday) == starts[i]);
+            }
+
+            // Week years only when asked for, in place start of week
+            s32 onlyWeeks[40];
+            ntime::isoWeekColumn(column, nullptr, onlyWeeks, 40);
+            CHECK_EQUAL(53, onlyWeeks[12]); // 2021-01-01
+            ntime::startOfWeekColumn(column, Sunday, column, 40);
+            CHECK_TRUE(column[0] == datetime_t(2020, 12, 20));
+            CHECK_TRUE(column[6] == datetime_t(2020, 12, 20));
+            CHECK_TRUE(column[7] == datetime_t(2020, 12, 27));
+        }
+
+        UNITTEST_TEST(ordinal_dates)
+        {
+            datetime_t const column[] = {datetime_t(2000, 12, 31), datetime_t(2001, 1, 1), datetime_t(2024, 3, 1, 12, 0, 0), datetime_t(1, 1, 1), datetime_t::sMaxValue};
+            s32              years[5], dayOfYears[5];
+            ntime::ordinalDateColumn(column, years, dayOfYears, 5);
+            CHECK_EQUAL(2000, years[0]);
+            CHECK_EQUAL(366, dayOfYears[0]);
+            CHECK_EQUAL(2001, years[1]);
+            CHECK_EQUAL(1, dayOfYears[1]);
+            CHECK_EQUAL(61, dayOfYears[2]);
+            CHECK_EQUAL(1, years[3]);
+            CHECK_EQUAL(1, dayOfYears[3]);
+            CHECK_EQUAL(9999, years[4]);
+            CHECK_EQUAL(365, dayOfYears[4]);
+
+            s32 onlyDays[5];
+            ntime::ordinalDateColumn(column, nullptr, onlyDays, 5);
+            CHECK_EQUAL(61, onlyDays[2]);
+        }
+
+        UNITTEST_TEST(add_months)
+        {
+            datetime_t const column[] = {datetime_t(2024, 1, 31, 10, 30, 0), datetime_t(2023, 3, 31), datetime_t(2024, 2, 29, 23, 59, 59), datetime_t(9999, 11, 15), datetime_t(1, 1, 1)};
+            datetime_t       out[5];
+            u64              mask[1];
+            CHECK_EQUAL(5, ntime::addMonthsColumn(column, out, 5, 1, mask));
+            CHECK_TRUE(out[0] == datetime_t(2024, 2, 29, 10, 30, 0));
+            CHECK_TRUE(out[1] == datetime_t(2023, 4, 30));
+            CHECK_TRUE(out[2] == datetime_t(2024, 3, 29, 23, 59, 59));
+            CHECK_TRUE(out[3] == datetime_t(9999, 12, 15));
+            CHECK_TRUE(out[4] == datetime_t(1, 2, 1));
+            CHECK_EQUAL(0, mask[0]);
+
+            // Same results as the scalar function
+            for (s32 months = -25; months <= 25; months += 5)
+            {
+                ntime::addMonthsColumn(column, out, 3, months);
+                for (s32 i = 0; i < 3; ++i)
+                {
+                    datetime_t dt = column[i];
+                    dt.addMonths(months);
+                    CHECK_TRUE(dt == out[i]);
+                }
+            }
+
+            // Out of range elements are copied and flagged, also in place
+            datetime_t copy[5];
+            for (s32 i = 0; i < 5; ++i)
+                copy[i] = column[i];
+            CHECK_EQUAL(4, ntime::addMonthsColumn(copy, copy, 5, -1, mask));
+            CHECK_EQUAL((u64)0x10, mask[0]);
+            CHECK_TRUE(copy[4] == column[4]);
+            CHECK_TRUE(copy[0] == datetime_t(2023, 12, 31, 10, 30, 0));
+            CHECK_EQUAL(0, ntime::addMonthsColumn(column, out, 5, 2000000000, mask));
+            CHECK_EQUAL((u64)0x1f, mask[0]);
+        }
+
+        UNITTEST_TEST(add_years)
+        {
+            // More than 64 elements so that the mask spans two words
+            datetime_t column[100];
+            datetime_t out[100];
+            u64        mask[2];
+            for (s32 i = 0; i < 100; ++i)
+                column[i] = datetime_t(9900 + i, 2, 28);
+            CHECK_EQUAL(98, ntime::addYearsColumn(column, out, 100, 2, mask));
+            CHECK_TRUE(out[0] == datetime_t(9902, 2, 28));
+            CHECK_TRUE(out[97] == datetime_t(9999, 2, 28));
+            CHECK_TRUE(out[98] == column[98]);
+            CHECK_EQUAL(0, mask[0]);
+            CHECK_EQUAL((u64)3 << 34, mask[1]);
+            CHECK_EQUAL(0, ntime::addYearsColumn(column, out, 100, -20000, mask));
+        }
+
+        UNITTEST_TEST(truncate)
+        {
+            datetime_t column[] = {datetime_t(2024, 5, 17, 13, 45, 10), datetime_t(2024, 12, 31, 23, 59, 59), datetime_t(2024, 1, 1), datetime_t::sMaxValue};
+            datetime_t out[4];
+            ntime::truncateToMonthColumn(column, out, 4);
+            CHECK_TRUE(out[0] == datetime_t(2024, 5, 1));
+            CHECK_TRUE(out[1] == datetime_t(2024, 12, 1));
+            CHECK_TRUE(out[2] == datetime_t(2024, 1, 1));
+            CHECK_TRUE(out[3] == datetime_t(9999, 12, 1));
+            ntime::truncateToQuarterColumn(column, column, 4);
+            CHECK_TRUE(column[0] == datetime_t(2024, 4, 1));
+            CHECK_TRUE(column[1] == datetime_t(2024, 10, 1));
+            CHECK_TRUE(column[2] == datetime_t(2024, 1, 1));
+            CHECK_TRUE(column[3] == datetime_t(9999, 10, 1));
+        }
+    }
+}
+UNITTEST_SUITE_END
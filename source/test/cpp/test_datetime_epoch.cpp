@@ -0,0 +1,123 @@
+#include "cunittest/cunittest.h"
+
+#include "ctime/c_datetime.h"
+#include "ctime/c_datetime_epoch.h"
+
+using namespace ncore;
+
+UNITTEST_SUITE_BEGIN(datetime_epoch)
+{
+    UNITTEST_FIXTURE(main)
+    {
+        UNITTEST_FIXTURE_SETUP() {}
+        UNITTEST_FIXTURE_TEARDOWN() {}
+
+        UNITTEST_TEST(julian_day)
+        {
+            CHECK_EQUAL(2451545.0, ntime::toJulianDay(datetime_t(2000, 1, 1, 12, 0, 0)));
+            CHECK_EQUAL(1721425.5, ntime::toJulianDay(datetime_t(1, 1, 1)));
+            CHECK_TRUE(ntime::fromJulianDay(2451545.0) == datetime_t(2000, 1, 1, 12, 0, 0));
+            CHECK_TRUE(ntime::fromJulianDay(2451544.5) == datetime_t(2000, 1, 1));
+            CHECK_TRUE(ntime::fromJulianDay(2451545.25) == datetime_t(2000, 1, 1, 18, 0, 0));
+
+            CHECK_EQUAL(0.0, ntime::toModifiedJulianDay(datetime_t(1858, 11, 17)));
+            CHECK_EQUAL(51544.5, ntime::toModifiedJulianDay(datetime_t(2000, 1, 1, 12, 0, 0)));
+            CHECK_TRUE(ntime::fromModifiedJulianDay(60000.0) == datetime_t(2023, 2, 25));
+
+            // Round trip within the resolution of a double, MJD resolves below a microsecond
+            datetime_t const dt(2023, 11, 14, 22, 13, 20, 123);
+            s64 const        delta = (s64)ntime::fromModifiedJulianDay(ntime::toModifiedJulianDay(dt)).ticks() - (s64)dt.ticks();
+            CHECK_TRUE(delta >= -10 && delta <= 10);
+
+            // Saturation
+            CHECK_TRUE(ntime::fromJulianDay(0.0) == datetime_t::sMinValue);
+            CHECK_TRUE(ntime::fromJulianDay(1e300) == datetime_t::sMaxValue);
+            f64 const zero = 0.0;
+            CHECK_TRUE(ntime::fromJulianDay(zero / zero) == datetime_t::sMinValue);
+        }
+
+        UNITTEST_TEST(excel_serial)
+        {
+            CHECK_EQUAL(44927.0, ntime::toExcelSerial(datetime_t(2023, 1, 1)));
+            CHECK_EQUAL(44927.5, ntime::toExcelSerial(datetime_t(2023, 1, 1, 12, 0, 0)));
+            CHECK_EQUAL(1.0, ntime::toExcelSerial(datetime_t(1900, 1, 1)));
+            CHECK_EQUAL(59.0, ntime::toExcelSerial(datetime_t(1900, 2, 28)));
+            CHECK_EQUAL(61.0, ntime::toExcelSerial(datetime_t(1900, 3, 1)));
+
+            CHECK_TRUE(ntime::fromExcelSerial(44927.0) == datetime_t(2023, 1, 1));
+            CHECK_TRUE(ntime::fromExcelSerial(1.0) == datetime_t(1900, 1, 1));
+            CHECK_TRUE(ntime::fromExcelSerial(59.0) == datetime_t(1900, 2, 28));
+            CHECK_TRUE(ntime::fromExcelSerial(60.0) == datetime_t(1900, 3, 1));
+            CHECK_TRUE(ntime::fromExcelSerial(61.0) == datetime_t(1900, 3, 1));
+
+            // 0.1 day is not exact in binary, rounding to milliseconds gives 02:24:00
+            CHECK_TRUE(ntime::fromExcelSerial(44927.1) == datetime_t(2023, 1, 1, 2, 24, 0));
+            CHECK_TRUE(ntime::fromExcelSerial(44927.0 + 1.0 / 86400000.0) == datetime_t(2023, 1, 1, 0, 0, 0, 1));
+        }
+
+        UNITTEST_TEST(ntp64)
+        {
+            CHECK_EQUAL(D_CONSTANT_U64(2208988800) << 32, ntime::toNtp64(datetime_t(1970, 1, 1)));
+            CHECK_EQUAL((D_CONSTANT_U64(2208988800) << 32) | D_CONSTANT_U64(0x80000000), ntime::toNtp64(datetime_t(1970, 1, 1, 0, 0, 0, 500)));
+            CHECK_TRUE(ntime::fromNtp64(D_CONSTANT_U64(2208988800) << 32) == datetime_t(1970, 1, 1));
+
+            // Era 1 starts 2036-02-07 06:28:16
+            CHECK_EQUAL((u64)0, ntime::toNtp64(datetime_t(2036, 2, 7, 6, 28, 16)));
+            CHECK_TRUE(ntime::fromNtp64(0) == datetime_t(2036, 2, 7, 6, 28, 16));
+            CHECK_TRUE(ntime::fromNtp64(D_CONSTANT_U64(0xffffffff) << 32) == datetime_t(2036, 2, 7, 6, 28, 15));
+
+            // Every tick survives a round trip
+            u64 t = datetime_t(2023, 11, 14, 22, 13, 20).ticks();
+            for (s32 i = 0; i < 1000; ++i, t += 9973)
+                CHECK_EQUAL(t, ntime::fromNtp64(ntime::toNtp64(datetime_t(t))).ticks());
+        }
+
+        UNITTEST_TEST(dotnet_ticks)
+        {
+            // DateTime(2023, 1, 1).Ticks
+            CHECK_EQUAL(D_CONSTANT_S64(638081280000000000), ntime::toDotNetTicks(datetime_t(2023, 1, 1)));
+            CHECK_TRUE(ntime::fromDotNetTicks(D_CONSTANT_S64(638081280000000000)) == datetime_t(2023, 1, 1));
+            CHECK_TRUE(ntime::fromDotNetTicks(-1) == datetime_t::sMinValue);
+        }
+
+        UNITTEST_TEST(batch)
+        {
+            datetime_t dt[64];
+            datetime_t back[64];
+            f64        days[64];
+            u64        ntp[64];
+            s64        ticks[64];
+            u64        t = datetime_t(1899, 12, 1).ticks();
+            for (s32 i = 0; i < 64; ++i, t += D_CONSTANT_U64(57123456789012))
+                dt[i] = datetime_t(t);
+
+            ntime::toJulianDay(dt, days, 64);
+            for (s32 i = 0; i < 64; ++i)
+                CHECK_EQUAL(ntime::toJulianDay(dt[i]), days[i]);
+            ntime::fromJulianDay(days, back, 64);
+            for (s32 i = 0; i < 64; ++i)
+                CHECK_TRUE(back[i] == ntime::fromJulianDay(days[i]));
+
+            ntime::toModifiedJulianDay(dt, days, 64);
+            ntime::fromModifiedJulianDay(days, back, 64);
+            for (s32 i = 0; i < 64; ++i)
+                CHECK_TRUE(back[i] == ntime::fromModifiedJulianDay(ntime::toModifiedJulianDay(dt[i])));
+
+            ntime::toExcelSerial(dt, days, 64);
+            ntime::fromExcelSerial(days, back, 64);
+            for (s32 i = 0; i < 64; ++i)
+                CHECK_TRUE(back[i] == ntime::fromExcelSerial(ntime::toExcelSerial(dt[i])));
+
+            ntime::toNtp64(dt, ntp, 64);
+            ntime::fromNtp64(ntp, back, 64);
+            for (s32 i = 0; i < 64; ++i)
+                CHECK_TRUE(back[i] == ntime::fromNtp64(ntime::toNtp64(dt[i])));
+
+            ntime::toDotNetTicks(dt, ticks, 64);
+            ntime::fromDotNetTicks(ticks, back, 64);
+            for (s32 i = 0; i < 64; ++i)
+                CHECK_TRUE(back[i] == dt[i]);
+        }
+    }
+}
+UNITTEST_SUITE_END
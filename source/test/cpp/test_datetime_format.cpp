@@ -0,0 +1,86 @@
+#include "cunittest/cunittest.h"
+
+#include "ctime/c_datetime.h"
+#include "ctime/c_datetime_format.h"
+
+using namespace ncore;
+
+UNITTEST_SUITE_BEGIN(datetime_format)
+{
+    UNITTEST_FIXTURE(main)
+    {
+        static bool sEquals(const char* str, s64 len, const char* expected)
+        {
+            s64 i = 0;
+            for (; i < len; ++i)
+            {
+                if (expected[i] != str[i])
+                    return false;
+            }
+            return expected[i] == 0;
+        }
+
+        UNITTEST_FIXTURE_SETUP() {}
+        UNITTEST_FIXTURE_TEARDOWN() {}
+
+        UNITTEST_TEST(iso8601)
+        {
+            datetime_t column[3] = {datetime_t(2023, 11, 14, 22, 13, 20, 123), datetime_t(1, 1, 1), datetime_t(9999, 12, 31, 23, 59, 59, 999)};
+
+            char buffer[128];
+            s64  bytes;
+            CHECK_EQUAL(3, ntime::exportColumn(column, 3, ExportIso8601, '\n', buffer, sizeof(buffer), bytes));
+            CHECK_EQUAL(75, bytes);
+            CHECK_TRUE(sEquals(buffer, bytes, "2023-11-14T22:13:20.123Z\n0001-01-01T00:00:00.000Z\n9999-12-31T23:59:59.999Z\n"));
+
+            // Only whole elements are written
+            CHECK_EQUAL(2, ntime::exportColumn(column, 3, ExportIso8601, ',', buffer, 74, bytes));
+            CHECK_EQUAL(50, bytes);
+        }
+
+        UNITTEST_TEST(epoch_millis)
+        {
+            datetime_t column[3] = {datetime_t(2023, 11, 14, 22, 13, 20, 123), datetime_t(1970, 1, 1), datetime_t(1969, 12, 31, 23, 59, 59, 999)};
+
+            char buffer[64];
+            s64  bytes;
+            CHECK_EQUAL(3, ntime::exportColumn(column, 3, ExportEpochMillis, ',', buffer, sizeof(buffer), bytes));
+            CHECK_TRUE(sEquals(buffer, bytes, "1700000000123,0,-1,"));
+
+            CHECK_EQUAL(1, ntime::exportColumn(column, 3, ExportEpochMillis, ',', buffer, 15, bytes));
+            CHECK_EQUAL(14, bytes);
+        }
+
+        UNITTEST_TEST(epoch_millis_blocks)
+        {
+            // Enough elements and buffer space to go through the block path and the tail
+            datetime_t column[19];
+            for (s32 i = 0; i < 19; ++i)
+                column[i] = datetime_t(2023, 11, 14, 22, 13, 20, 123).addMilliseconds(i * 1001);
+            column[5] = datetime_t(1, 1, 1);
+
+            char buffer[19 * 16];
+            s64  bytes;
+            CHECK_EQUAL(19, ntime::exportColumn(column, 19, ExportEpochMillis, '\n', buffer, sizeof(buffer), bytes));
+
+            s64 pos = 0;
+            for (s32 i = 0; i < 19; ++i)
+            {
+                s64 value = 0;
+                s64 sign  = 1;
+                if (buffer[pos] == '-')
+                {
+                    sign = -1;
+                    pos++;
+                }
+                while (buffer[pos] != '\n')
+                    value = (value * 10) + (buffer[pos++] - '0');
+                pos++;
+                s64 const expected = ((s64)column[i].ticks() - D_CONSTANT_S64(621355968000000000)) / 10000;
+                CHECK_EQUAL(expected, sign * value);
+            }
+            CHECK_EQUAL(bytes, pos);
+        }
+    }
+}
+UNITTEST_SUITE_END
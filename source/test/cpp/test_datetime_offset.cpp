@@ -0,0 +1,99 @@
+#include "cunittest/cunittest.h"
+
+#include "ctime/c_datetime.h"
+#include "ctime/c_datetime_format.h"
+#include "ctime/c_datetime_offset.h"
+#include "ctime/c_timezone.h"
+
+using namespace ncore;
+
+UNITTEST_SUITE_BEGIN(datetime_offset)
+{
+    UNITTEST_FIXTURE(main)
+    {
+        UNITTEST_FIXTURE_SETUP() {}
+        UNITTEST_FIXTURE_TEARDOWN() {}
+
+        static bool sEqual(const char* a, const char* b, s32 n)
+        {
+            for (s32 i = 0; i < n; ++i)
+            {
+                if (a[i] != b[i])
+                    return false;
+            }
+            return true;
+        }
+
+        UNITTEST_TEST(pack)
+        {
+            CHECK_EQUAL(8, (s32)sizeof(datetime_offset_t));
+
+            datetime_t const        utc(2023, 11, 14, 22, 13, 20, 123);
+            datetime_offset_t const dto(utc, 60);
+            CHECK_TRUE(dto.utc() == utc);
+            CHECK_TRUE(dto.local() == datetime_t(2023, 11, 14, 23, 13, 20, 123));
+            CHECK_EQUAL(60, dto.offsetMinutes());
+
+            datetime_offset_t const west(utc, -570); // -09:30
+            CHECK_EQUAL(-570, west.offsetMinutes());
+            CHECK_TRUE(west.utc() == utc);
+            CHECK_TRUE(west.equals(dto));
+            CHECK_TRUE(west.packed() != dto.packed());
+
+            CHECK_EQUAL(-960, datetime_offset_t(utc, -960).offsetMinutes());
+            CHECK_EQUAL(945, datetime_offset_t(utc, 945).offsetMinutes());
+
+            datetime_offset_t const copy = datetime_offset_t::sFromPacked(west.packed());
+            CHECK_TRUE(copy.utc() == utc);
+            CHECK_EQUAL(-570, copy.offsetMinutes());
+
+            datetime_offset_t const local = datetime_offset_t::sFromLocal(datetime_t(2023, 11, 15, 3, 13, 20, 123), 300);
+            CHECK_TRUE(local.utc() == utc);
+
+            CHECK_TRUE(datetime_offset_t::sIsRepresentable(datetime_t(1900, 1, 1)));
+            CHECK_TRUE(datetime_offset_t::sIsRepresentable(datetime_t(2356, 1, 1)));
+            CHECK_FALSE(datetime_offset_t::sIsRepresentable(datetime_t(1899, 12, 31)));
+            CHECK_FALSE(datetime_offset_t::sIsRepresentable(datetime_t(2357, 1, 1)));
+            CHECK_TRUE(datetime_offset_t::sMinValue.utc() == datetime_t(1900, 1, 1));
+            CHECK_EQUAL(-1, datetime_offset_t::sCompare(datetime_offset_t::sMinValue, dto));
+        }
+
+        UNITTEST_TEST(from_zone)
+        {
+            const timezone_t* tz = timezone_t::sFind("Asia/Kolkata");
+            if (tz != nullptr)
+            {
+                datetime_offset_t const dto = datetime_offset_t::sFromZone(datetime_t(2023, 1, 1), tz);
+                CHECK_EQUAL(330, dto.offsetMinutes());
+                CHECK_TRUE(dto.local() == datetime_t(2023, 1, 1, 5, 30, 0));
+            }
+            CHECK_EQUAL(0, datetime_offset_t::sFromZone(datetime_t(2023, 1, 1), timezone_t::sUtc()).offsetMinutes());
+        }
+
+        UNITTEST_TEST(rfc3339)
+        {
+            char text[40];
+            datetime_t const utc(2023, 11, 14, 22, 13, 20, 123);
+            CHECK_EQUAL(29, ntime::formatRfc3339(datetime_offset_t(utc, 60), text, sizeof(text)));
+            CHECK_TRUE(sEqual(text, "2023-11-14T23:13:20.123+01:00", 30));
+            CHECK_EQUAL(29, ntime::formatRfc3339(datetime_offset_t(utc, -570), text, sizeof(text)));
+            CHECK_TRUE(sEqual(text, "2023-11-14T12:43:20.123-09:30", 30));
+            CHECK_EQUAL(29, ntime::formatRfc3339(datetime_offset_t(utc, 0), text, sizeof(text)));
+            CHECK_TRUE(sEqual(text, "2023-11-14T22:13:20.123+00:00", 30));
+            CHECK_EQUAL(0, ntime::formatRfc3339(datetime_offset_t(utc, 0), text, 29));
+
+            datetime_offset_t column[10];
+            for (s32 i = 0; i < 10; ++i)
+                column[i] = datetime_offset_t(utc, (i - 5) * 60);
+            char buffer[10 * 30];
+            s64  bytes = 0;
+            CHECK_EQUAL(10, (s32)ntime::exportColumn(column, 10, '\n', buffer, sizeof(buffer), bytes));
+            CHECK_EQUAL(300, (s32)bytes);
+            CHECK_TRUE(sEqual(buffer, "2023-11-14T17:13:20.123-05:00\n", 30));
+            CHECK_TRUE(sEqual(buffer + 9 * 30, "2023-11-15T02:13:20.123+04:00\n", 30));
+            CHECK_EQUAL(3, (s32)ntime::exportColumn(column, 10, ',', buffer, 100, bytes));
+            CHECK_EQUAL(90, (s32)bytes);
+        }
+    }
+}
+UNITTEST_SUITE_END
@@ -0,0 +1,131 @@
+#include "cunittest/cunittest.h"
+
+#include "ctime/c_datetime.h"
+#include "ctime/c_datetime_parse.h"
+#include "ctime/c_timespan.h"
+
+using namespace ncore;
+
+UNITTEST_SUITE_BEGIN(datetime_parse)
+{
+    UNITTEST_FIXTURE(main)
+    {
+        static s32 sLen(const char* str)
+        {
+            s32 n = 0;
+            while (str[n] != 0)
+                n++;
+            return n;
+        }
+
+        static bool sParse(const char* str, datetime_t& dt, s32 year = 1970) { return ntime::parseTimestamp(str, sLen(str), dt, year); }
+
+        UNITTEST_FIXTURE_SETUP() {}
+        UNITTEST_FIXTURE_TEARDOWN() {}
+
+        UNITTEST_TEST(classify)
+        {
+            CHECK_EQUAL(TimestampEpochSeconds, ntime::classifyTimestamp("1700000000", 10));
+            CHECK_EQUAL(TimestampEpochSeconds, ntime::classifyTimestamp("1700000000.25", 13));
+            CHECK_EQUAL(TimestampEpochMillis, ntime::classifyTimestamp("1700000000123", 13));
+            CHECK_EQUAL(TimestampEpochMicros, ntime::classifyTimestamp("1700000000123456", 16));
+            CHECK_EQUAL(TimestampEpochNanos, ntime::classifyTimestamp("1700000000123456789", 19));
+            CHECK_EQUAL(TimestampIso8601, ntime::classifyTimestamp("2023-11-14T22:13:20Z", 20));
+            CHECK_EQUAL(TimestampIso8601, ntime::classifyTimestamp("20231114T221320Z", 16));
+            CHECK_EQUAL(TimestampRfc2822, ntime::classifyTimestamp("Tue, 14 Nov 2023 22:13:20 +0000", 31));
+            CHECK_EQUAL(TimestampRfc2822, ntime::classifyTimestamp("14 Nov 2023 22:13:20 GMT", 24));
+            CHECK_EQUAL(TimestampSyslog, ntime::classifyTimestamp("Nov 14 22:13:20", 15));
+            CHECK_EQUAL(TimestampUnknown, ntime::classifyTimestamp("hello world", 11));
+            CHECK_EQUAL(TimestampUnknown, ntime::classifyTimestamp("123", 3));
+        }
+
+        UNITTEST_TEST(epoch)
+        {
+            datetime_t const expected(2023, 11, 14, 22, 13, 20);
+            datetime_t       dt;
+
+            CHECK_TRUE(sParse("1700000000", dt));
+            CHECK_TRUE(dt == expected);
+            CHECK_TRUE(sParse("1700000000.5", dt));
+            CHECK_EQUAL(expected.ticks() + 5000000, dt.ticks());
+            CHECK_TRUE(sParse("1700000000123", dt));
+            CHECK_EQUAL(expected.ticks() + 1230000, dt.ticks());
+            CHECK_TRUE(sParse("1700000000123456", dt));
+            CHECK_EQUAL(expected.ticks() + 1234560, dt.ticks());
+            CHECK_TRUE(sParse("1700000000123456789", dt));
+            CHECK_EQUAL(expected.ticks() + 1234567, dt.ticks());
+            CHECK_FALSE(sParse("1700000000.", dt));
+        }
+
+        UNITTEST_TEST(iso8601)
+        {
+            datetime_t dt;
+
+            CHECK_TRUE(sParse("2023-11-14T22:13:20Z", dt));
+            CHECK_TRUE(dt == datetime_t(2023, 11, 14, 22, 13, 20));
+            CHECK_TRUE(sParse("2023-11-14 22:13:20.123", dt));
+            CHECK_TRUE(dt == datetime_t(2023, 11, 14, 22, 13, 20, 123));
+            CHECK_TRUE(sParse("2023-11-14T23:13:20+01:00", dt));
+            CHECK_TRUE(dt == datetime_t(2023, 11, 14, 22, 13, 20));
+            CHECK_TRUE(sParse("2023-11-14T17:13:20.1234567-0500", dt));
+            CHECK_EQUAL(datetime_t(2023, 11, 14, 22, 13, 20).ticks() + 1234567, dt.ticks());
+            CHECK_TRUE(sParse("20231114T221320Z", dt));
+            CHECK_TRUE(dt == datetime_t(2023, 11, 14, 22, 13, 20));
+            CHECK_TRUE(sParse("2024-02-29", dt));
+            CHECK_TRUE(dt == datetime_t(2024, 2, 29));
+
+            CHECK_FALSE(sParse("2023-02-29", dt));
+            CHECK_FALSE(sParse("2023-11-14T24:00:00Z", dt));
+            CHECK_FALSE(sParse("2023-11-14T22:13:20Zx", dt));
+        }
+
+        UNITTEST_TEST(rfc2822)
+        {
+            datetime_t dt;
+
+            CHECK_TRUE(sParse("Tue, 14 Nov 2023 22:13:20 +0000", dt));
+            CHECK_TRUE(dt == datetime_t(2023, 11, 14, 22, 13, 20));
+            CHECK_TRUE(sParse("Tue, 14 Nov 2023 17:13:20 EST", dt));
+            CHECK_TRUE(dt == datetime_t(2023, 11, 14, 22, 13, 20));
+            CHECK_TRUE(sParse("4 Nov 2023 22:13 GMT", dt));
+            CHECK_TRUE(dt == datetime_t(2023, 11, 4, 22, 13, 0));
+            CHECK_FALSE(sParse("Tue, 14 Foo 2023 22:13:20 +0000", dt));
+        }
+
+        UNITTEST_TEST(syslog)
+        {
+            datetime_t dt;
+
+            CHECK_TRUE(sParse("Nov 14 22:13:20", dt, 2023));
+            CHECK_TRUE(dt == datetime_t(2023, 11, 14, 22, 13, 20));
+            CHECK_TRUE(sParse("Nov  4 22:13:20.250", dt, 2023));
+            CHECK_TRUE(dt == datetime_t(2023, 11, 4, 22, 13, 20, 250));
+            CHECK_FALSE(sParse("Nov 31 22:13:20", dt, 2023));
+        }
+
+        UNITTEST_TEST(parser_learns_dominant_format)
+        {
+            timestamp_parser_t parser;
+            parser.setYear(2023);
+
+            const char* tokens[] = {"2023-11-14T22:13:20Z", "2023-11-14T22:13:21Z", "1700000002", "2023-11-14T22:13:23Z", "bogus", "2023-11-14T22:13:25Z"};
+            s32         lens[6];
+            for (s32 i = 0; i < 6; ++i)
+                lens[i] = sLen(tokens[i]);
+
+            datetime_t out[6];
+            u64        failMask = 0;
+            CHECK_EQUAL(5, parser.parse(tokens, lens, 6, out, &failMask));
+            CHECK_EQUAL((u64)1 << 4, failMask);
+            CHECK_EQUAL(TimestampIso8601, parser.dominantFormat());
+            CHECK_EQUAL(3, (s32)parser.getNumFastPathHits());
+            CHECK_EQUAL(2, (s32)parser.getNumFastPathMisses());
+            for (s32 i = 0; i < 6; ++i)
+            {
+                if (i != 4)
+                    CHECK_TRUE(out[i] == datetime_t(2023, 11, 14, 22, 13, 20 + i));
+            }
+        }
+    }
+}
+UNITTEST_SUITE_END
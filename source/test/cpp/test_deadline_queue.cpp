@@ -0,0 +1,254 @@
+#include "ccore/c_allocator.h"
+#include "cunittest/cunittest.h"
+
+#include "ctime/c_deadline_queue.h"
+#include "ctime/c_timer.h"
+#include "ctime/c_timer_wheel.h"
+
+#include "test_allocator.h"
+#include "test_benchmark.h"
+
+#include <stdlib.h>
+#include <queue>
+#include <vector>
+
+using namespace ncore;
+
+namespace
+{
+    static u32 sRandom(u32& state)
+    {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        return state;
+    }
+
+    // Payloads point into an array, the benchmarks sum the indices
+    static s64           sWheelFired;
+    static const tick_t* sWheelBase;
+    static void          sOnWheel(timer_handle_t handle, void* user) { sWheelFired += (const tick_t*)user - sWheelBase; }
+} // namespace
+
+UNITTEST_SUITE_BEGIN(deadline_queue)
+{
+    UNITTEST_FIXTURE(main)
+    {
+        UNITTEST_FIXTURE_SETUP() { ntime::init(); }
+        UNITTEST_FIXTURE_TEARDOWN() { ntime::exit(); }
+
+        UNITTEST_TEST(order)
+        {
+            ntest::test_allocator_t allocator;
+            {
+                deadline_queue_t queue;
+                CHECK_TRUE(queue.init(&allocator, 64));
+
+                tick_t const deadlines[] = {50, 10, 40, 30, 20, 60, 10};
+                for (s32 i = 0; i < 7; ++i)
+                    CHECK_TRUE(queue.push(deadlines[i], (void*)&deadlines[i]) != 0);
+                CHECK_EQUAL(7, queue.size());
+
+                deadline_queue_t::entry_t entry;
+                CHECK_TRUE(queue.peek(entry));
+                CHECK_EQUAL(10, entry.mDeadline);
+
+                tick_t last = 0;
+                for (s32 i = 0; i < 7; ++i)
+                {
+                    CHECK_TRUE(queue.pop(entry));
+                    CHECK_TRUE(entry.mDeadline >= last);
+                    CHECK_EQUAL(*(const tick_t*)entry.mPayload, entry.mDeadline);
+                    CHECK_FALSE(queue.isQueued(entry.mHandle));
+                    last = entry.mDeadline;
+                }
+                CHECK_FALSE(queue.pop(entry));
+            }
+            CHECK_EQUAL(0, allocator.numAllocations());
+        }
+
+        UNITTEST_TEST(cancel_and_reschedule)
+        {
+            ntest::test_allocator_t allocator;
+            deadline_queue_t        queue;
+            queue.init(&allocator, 4);
+
+            timer_handle_t const a = queue.push(100, nullptr);
+            timer_handle_t const b = queue.push(200, nullptr);
+            timer_handle_t const c = queue.push(300, nullptr);
+            timer_handle_t const d = queue.push(400, nullptr);
+            CHECK_TRUE(queue.push(500, nullptr) == 0); // full
+
+            CHECK_TRUE(queue.cancel(b));
+            CHECK_FALSE(queue.cancel(b));
+            CHECK_TRUE(queue.reschedule(d, 50));  // decrease
+            CHECK_TRUE(queue.reschedule(a, 350)); // increase
+            CHECK_FALSE(queue.reschedule(b, 10));
+
+            deadline_queue_t::entry_t out[4];
+            CHECK_EQUAL(1, queue.popExpired(300, out, 1));
+            CHECK_TRUE(out[0].mHandle == d);
+            CHECK_EQUAL(1, queue.popExpired(300, out, 4));
+            CHECK_TRUE(out[0].mHandle == c);
+            CHECK_EQUAL(0, queue.popExpired(300, out, 4));
+            CHECK_EQUAL(1, queue.popExpired(350, out, 4));
+            CHECK_TRUE(out[0].mHandle == a);
+            CHECK_EQUAL(0, queue.size());
+
+            // Slots are reused with a new generation
+            timer_handle_t const e = queue.push(1, nullptr);
+            CHECK_TRUE(e != a && e != b && e != c && e != d);
+            CHECK_FALSE(queue.isQueued(a));
+        }
+
+        UNITTEST_TEST(random_operations)
+        {
+            // Against a plain array that is searched for its minimum
+            const s32         N = 512;
+            ntest::test_allocator_t allocator;
+            deadline_queue_t        queue;
+            queue.init(&allocator, N);
+
+            static timer_handle_t handles[N];
+            static tick_t         deadlines[N];
+            static bool           queued[N];
+            for (s32 i = 0; i < N; ++i)
+                queued[i] = false;
+
+            u32 state = 0xabcdef01;
+            s32 bad   = 0;
+            for (s32 step = 0; step < 20000; ++step)
+            {
+                s32 const i  = (s32)(sRandom(state) % N);
+                u32 const op = sRandom(state) % 4;
+                if (!queued[i])
+                {
+                    deadlines[i] = (tick_t)(sRandom(state) % 100000);
+                    handles[i]   = queue.push(deadlines[i], &queued[i]);
+                    queued[i]    = true;
+                }
+                else if (op == 0)
+                {
+                    bad += queue.cancel(handles[i]) ? 0 : 1;
+                    queued[i] = false;
+                }
+                else if (op == 1)
+                {
+                    deadlines[i] = (tick_t)(sRandom(state) % 100000);
+                    bad += queue.reschedule(handles[i], deadlines[i]) ? 0 : 1;
+                }
+                else if (op == 2)
+                {
+                    s32 min = -1;
+                    for (s32 j = 0; j < N; ++j)
+                        if (queued[j] && (min < 0 || deadlines[j] < deadlines[min]))
+                            min = j;
+                    deadline_queue_t::entry_t entry;
+                    bad += (queue.pop(entry) && entry.mDeadline == deadlines[min]) ? 0 : 1;
+                    *(bool*)entry.mPayload = false;
+                }
+            }
+            CHECK_EQUAL(0, bad);
+        }
+
+        // Pushes 'count' random deadlines and drains them in time order, every structure is timed
+        static void sBenchmark(s32 count, bool report)
+        {
+            ntest::test_allocator_t allocator;
+            tick_t*                 deadlines = (tick_t*)::malloc(sizeof(tick_t) * count);
+            u32                     state     = 0x2545f491;
+            s64                     expected  = 0;
+            for (s32 i = 0; i < count; ++i)
+            {
+                deadlines[i] = (tick_t)(sRandom(state) % (u32)(count * 16)) + 1;
+                expected += i;
+            }
+            tick_t const   horizon = (tick_t)count * 16 + 1;
+            ncore::timer_t timer;
+
+            // Deadline queue, drained in batches
+            {
+                deadline_queue_t queue;
+                queue.init(&allocator, count);
+                timer.reset();
+                timer.start();
+                for (s32 i = 0; i < count; ++i)
+                    queue.push(deadlines[i], &deadlines[i]);
+                s64                       sum = 0;
+                deadline_queue_t::entry_t batch[64];
+                for (tick_t now = 0; now <= horizon; now += 64)
+                {
+                    u32 n;
+                    while ((n = queue.popExpired(now, batch, 64)) > 0)
+                        for (u32 j = 0; j < n; ++j)
+                            sum += (tick_t*)batch[j].mPayload - deadlines;
+                }
+                tick_t const elapsed = timer.stop();
+                CHECK_EQUAL(expected, sum);
+                if (report)
+                    ntest::benchmarkReport("deadline_queue_t, push + popExpired", count, elapsed);
+            }
+
+            // Timing wheel, one slot per tick
+            {
+                timer_wheel_t wheel;
+                wheel.init(&allocator, count, 1, 0);
+                sWheelFired = 0;
+                sWheelBase  = deadlines;
+                timer.reset();
+                timer.start();
+                for (s32 i = 0; i < count; ++i)
+                    wheel.schedule(deadlines[i], sOnWheel, &deadlines[i]);
+                for (tick_t now = 0; now <= horizon; now += 64)
+                    wheel.advance(now);
+                tick_t const elapsed = timer.stop();
+                CHECK_EQUAL(expected, sWheelFired);
+                if (report)
+                    ntest::benchmarkReport("timer_wheel_t, schedule + advance", count, elapsed);
+            }
+
+            // std::priority_queue
+            {
+                typedef std::pair<tick_t, s32> item_t;
+                std::priority_queue<item_t, std::vector<item_t>, std::greater<item_t>> queue;
+                timer.reset();
+                timer.start();
+                for (s32 i = 0; i < count; ++i)
+                    queue.push(item_t(deadlines[i], i));
+                s64 sum = 0;
+                for (tick_t now = 0; now <= horizon; now += 64)
+                {
+                    while (!queue.empty() && queue.top().first <= now)
+                    {
+                        sum += queue.top().second;
+                        queue.pop();
+                    }
+                }
+                tick_t const elapsed = timer.stop();
+                CHECK_EQUAL(expected, sum);
+                if (report)
+                    ntest::benchmarkReport("std::priority_queue, push + pop", count, elapsed);
+            }
+
+            ::free(deadlines);
+        }
+
+        UNITTEST_TEST(structures)
+        {
+            // The benchmark with small sizes, every structure fires every deadline
+            sBenchmark(1000, false);
+            sBenchmark(20000, false);
+        }
+
+        UNITTEST_TEST(benchmark)
+        {
+            // Opt-in (CTIME_BENCHMARK), reports every structure for 1K, 100K and 10M deadlines
+            if (!ntest::benchmarkEnabled())
+                return;
+            sBenchmark(1000, true);
+            sBenchmark(100000, true);
+            sBenchmark(10000000, true);
+        }
+    }
+}
+UNITTEST_SUITE_END
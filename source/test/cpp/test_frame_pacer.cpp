@@ -0,0 +1,143 @@
+#include "cunittest/cunittest.h"
+
+#include "ctime/c_time.h"
+#include "ctime/c_frame_pacer.h"
+#include "ctime/private/c_time_source.h"
+
+using namespace ncore;
+
+UNITTEST_SUITE_BEGIN(frame_pacer)
+{
+    UNITTEST_FIXTURE(main)
+    {
+        class time_source_test_t : public time_source_t
+        {
+            tick_t mTicks;
+
+        public:
+            time_source_test_t()
+                : mTicks(0)
+            {
+            }
+
+            void reset() { mTicks = 0; }
+            void update(tick_t ticks) { mTicks += ticks; }
+
+            virtual tick_t getTimeInTicks() { return mTicks; }
+            virtual s64    getTicksPerSecond() { return 1000 * 1000; }
+        };
+
+        static time_source_test_t sTimeSource;
+
+        UNITTEST_FIXTURE_SETUP()
+        {
+            sTimeSource.reset();
+            g_SetTimeSource(&sTimeSource);
+        }
+
+        UNITTEST_FIXTURE_TEARDOWN() { g_SetTimeSource(nullptr); }
+
+        UNITTEST_TEST(schedule)
+        {
+            frame_pacer_t pacer;
+            pacer.start(60, 1, FrameSkip, FrameWaitNone);
+            CHECK_EQUAL(16666, pacer.getPeriod());
+
+            // Deadlines are rounded up to a tick and do not drift
+            CHECK_EQUAL(16667, pacer.waitFrame());
+            CHECK_EQUAL(33334, pacer.waitFrame());
+            CHECK_EQUAL(50000, pacer.waitFrame());
+            tick_t deadline = 0;
+            for (s32 i = 3; i < 600; ++i)
+            {
+                sTimeSource.update(1000);
+                deadline = pacer.waitFrame();
+            }
+            CHECK_EQUAL(10 * 1000 * 1000, deadline);
+            CHECK_EQUAL(600, pacer.getFrames());
+            CHECK_EQUAL(0, pacer.getMissed());
+            CHECK_EQUAL(0, pacer.getMaxLateness());
+
+            // 59.94 Hz, 60000 frames take exactly 1001 seconds
+            pacer.start(60000, 1001, FrameSkip, FrameWaitNone);
+            tick_t const start = sTimeSource.getTimeInTicks();
+            for (s32 i = 0; i < 60000; ++i)
+                deadline = pacer.waitFrame();
+            CHECK_EQUAL(start + (tick_t)1001 * 1000 * 1000, deadline);
+
+            // A new rate starts at the current deadline
+            pacer.setRate(100);
+            CHECK_EQUAL(deadline + 10000, pacer.waitFrame());
+        }
+
+        UNITTEST_TEST(skip)
+        {
+            frame_pacer_t pacer;
+            pacer.start(100, 1, FrameSkip, FrameWaitNone); // 10000 ticks per frame
+            CHECK_EQUAL(10000, pacer.waitFrame());
+
+            // The work of frame 1 takes 3.5 frames, the slots of frame 2 and 3 pass
+            sTimeSource.update(10000 + 35000);
+            CHECK_EQUAL(40000, pacer.waitFrame());
+            CHECK_EQUAL(2, pacer.getMissed());
+            CHECK_EQUAL(2, pacer.getSkipped());
+            CHECK_EQUAL(5000, pacer.getMaxLateness());
+
+            // Back on schedule
+            CHECK_EQUAL(50000, pacer.waitFrame());
+            CHECK_EQUAL(3, pacer.getFrames());
+            CHECK_EQUAL(2, pacer.getMissed());
+
+            // Late within its slot is not a miss
+            sTimeSource.update(20000);
+            CHECK_EQUAL(60000, pacer.waitFrame());
+            CHECK_EQUAL(2, pacer.getMissed());
+            CHECK_EQUAL(10000, pacer.getTotalLateness());
+
+            pacer.resetStats();
+            CHECK_EQUAL(0, pacer.getMissed());
+            CHECK_EQUAL(0, pacer.getFrames());
+        }
+
+        UNITTEST_TEST(catch_up)
+        {
+            frame_pacer_t pacer;
+            pacer.start(100, 1, FrameCatchUp, FrameWaitNone);
+            pacer.setMaxCatchUp(2);
+            CHECK_EQUAL(10000, pacer.waitFrame());
+
+            // 4 slots pass, the 2 oldest are dropped and the others run back to back
+            sTimeSource.update(65000);
+            CHECK_EQUAL(40000, pacer.waitFrame());
+            CHECK_EQUAL(2, pacer.getSkipped());
+            CHECK_EQUAL(3, pacer.getMissed());
+            CHECK_EQUAL(50000, pacer.waitFrame());
+            CHECK_EQUAL(4, pacer.getMissed());
+            CHECK_EQUAL(60000, pacer.waitFrame());
+            CHECK_EQUAL(4, pacer.getMissed());
+            CHECK_EQUAL(70000, pacer.waitFrame());
+            CHECK_EQUAL(4, pacer.getMissed());
+            CHECK_EQUAL(2, pacer.getSkipped());
+            CHECK_EQUAL(5, pacer.getFrames());
+        }
+
+        UNITTEST_TEST(sleep)
+        {
+            ntime::init();
+            {
+                frame_pacer_t pacer;
+                pacer.start(500); // 2 ms per frame
+                tick_t const start    = pacer.getDeadline();
+                tick_t       deadline = 0;
+                for (s32 i = 0; i < 10; ++i)
+                {
+                    deadline = pacer.waitFrame();
+                    CHECK_TRUE(getTime() >= deadline);
+                }
+                CHECK_EQUAL(start + (10 + (tick_t)pacer.getSkipped()) * pacer.getPeriod(), deadline); // frames are skipped on a busy host
+            }
+            ntime::exit();
+        }
+    }
+}
+UNITTEST_SUITE_END
@@ -0,0 +1,285 @@
+#include "cunittest/cunittest.h"
+
+#include "ctime/c_datetime.h"
+#include "ctime/c_timespan.h"
+#include "ctime/c_rrule.h"
+
+using namespace ncore;
+
+UNITTEST_SUITE_BEGIN(rrule)
+{
+    UNITTEST_FIXTURE(main)
+    {
+        UNITTEST_FIXTURE_SETUP() {}
+        UNITTEST_FIXTURE_TEARDOWN() {}
+
+        // Dates as yyyymmdd, all occurrences at 09:00
+        static bool sExpands(const rrule_t& rule, const s32* dates, s32 count)
+        {
+            rrule_iterator_t it;
+            it.init(&rule);
+            for (s32 i = 0; i < count; ++i)
+            {
+                datetime_t when;
+                if (!it.next(when) || when != datetime_t(dates[i] / 10000, (dates[i] / 100) % 100, dates[i] % 100, 9, 0, 0))
+                    return false;
+            }
+            return true;
+        }
+
+        static bool sEnds(const rrule_t& rule, s32 count)
+        {
+            rrule_iterator_t it;
+            it.init(&rule);
+            datetime_t when;
+            for (s32 i = 0; i < count; ++i)
+                if (!it.next(when))
+                    return false;
+            return !it.next(when) && it.done();
+        }
+
+        UNITTEST_TEST(parse)
+        {
+            datetime_t const start(1997, 9, 2, 9, 0, 0);
+            rrule_t          rule;
+            CHECK_TRUE(rule.parse("FREQ=DAILY", start));
+            CHECK_TRUE(rule.parse("RRULE:FREQ=WEEKLY;INTERVAL=2;BYDAY=TU,TH;WKST=SU", start));
+            CHECK_TRUE(rule.parse("FREQ=MONTHLY;BYDAY=-1SU,+1MO;BYSETPOS=1,-1", start));
+            CHECK_TRUE(rule.parse("FREQ=YEARLY;BYMONTH=3;BYDAY=2TH;UNTIL=20001231", start));
+            CHECK_TRUE(rule.parse("freq=monthly;bymonthday=-3", start));
+            CHECK_EQUAL(RRuleMonthly, rule.frequency());
+
+            CHECK_FALSE(rule.parse("", start));
+            CHECK_FALSE(rule.parse("INTERVAL=2", start));
+            CHECK_FALSE(rule.parse("FREQ=FORTNIGHTLY", start));
+            CHECK_FALSE(rule.parse("FREQ=DAILY;INTERVAL=0", start));
+            CHECK_FALSE(rule.parse("FREQ=DAILY;COUNT=3;UNTIL=19971224T000000Z", start));
+            CHECK_FALSE(rule.parse("FREQ=DAILY;BYHOUR=9", start));
+            CHECK_FALSE(rule.parse("FREQ=YEARLY;BYDAY=20MO", start)); // the 20th Monday of the year
+            CHECK_FALSE(rule.parse("FREQ=WEEKLY;BYDAY=1MO", start));
+            CHECK_FALSE(rule.parse("FREQ=MONTHLY;BYMONTHDAY=0", start));
+            CHECK_FALSE(rule.parse("FREQ=MONTHLY;BYMONTHDAY=1,", start));
+            CHECK_FALSE(rule.parse("FREQ=MONTHLY;BYDAY=XX", start));
+            CHECK_FALSE(rule.parse("FREQ=MONTHLY;UNTIL=1997", start));
+
+            // A failed parse leaves the rule as it was
+            CHECK_EQUAL(RRuleMonthly, rule.frequency());
+        }
+
+        UNITTEST_TEST(rfc5545)
+        {
+            // The examples of RFC 5545 section 3.8.5.3
+            rrule_t rule;
+
+            CHECK_TRUE(rule.parse("FREQ=DAILY;COUNT=10", datetime_t(1997, 9, 2, 9, 0, 0)));
+            s32 const daily[] = {19970902, 19970903, 19970904, 19970905, 19970906, 19970907, 19970908, 19970909, 19970910, 19970911};
+            CHECK_TRUE(sExpands(rule, daily, 10));
+            CHECK_TRUE(sEnds(rule, 10));
+
+            CHECK_TRUE(rule.parse("FREQ=DAILY;INTERVAL=10;COUNT=5", datetime_t(1997, 9, 2, 9, 0, 0)));
+            s32 const every10[] = {19970902, 19970912, 19970922, 19971002, 19971012};
+            CHECK_TRUE(sExpands(rule, every10, 5));
+
+            CHECK_TRUE(rule.parse("FREQ=WEEKLY;UNTIL=19971007T000000Z;WKST=SU;BYDAY=TU,TH", datetime_t(1997, 9, 2, 9, 0, 0)));
+            s32 const weekly[] = {19970902, 19970904, 19970909, 19970911, 19970916, 19970918, 19970923, 19970925, 19970930, 19971002};
+            CHECK_TRUE(sExpands(rule, weekly, 10));
+            CHECK_TRUE(sEnds(rule, 10));
+
+            // The week start changes the weeks an INTERVAL skips
+            CHECK_TRUE(rule.parse("FREQ=WEEKLY;INTERVAL=2;COUNT=4;BYDAY=TU,SU;WKST=MO", datetime_t(1997, 8, 5, 9, 0, 0)));
+            s32 const wkstMo[] = {19970805, 19970810, 19970819, 19970824};
+            CHECK_TRUE(sExpands(rule, wkstMo, 4));
+            CHECK_TRUE(rule.parse("FREQ=WEEKLY;INTERVAL=2;COUNT=4;BYDAY=TU,SU;WKST=SU", datetime_t(1997, 8, 5, 9, 0, 0)));
+            s32 const wkstSu[] = {19970805, 19970817, 19970819, 19970831};
+            CHECK_TRUE(sExpands(rule, wkstSu, 4));
+
+            CHECK_TRUE(rule.parse("FREQ=MONTHLY;COUNT=10;BYDAY=1FR", datetime_t(1997, 9, 5, 9, 0, 0)));
+            s32 const firstFriday[] = {19970905, 19971003, 19971107, 19971205, 19980102, 19980206, 19980306, 19980403, 19980501, 19980605};
+            CHECK_TRUE(sExpands(rule, firstFriday, 10));
+
+            CHECK_TRUE(rule.parse("FREQ=MONTHLY;INTERVAL=2;COUNT=10;BYDAY=1SU,-1SU", datetime_t(1997, 9, 7, 9, 0, 0)));
+            s32 const sundays[] = {19970907, 19970928, 19971102, 19971130, 19980104, 19980125, 19980301, 19980329, 19980503, 19980531};
+            CHECK_TRUE(sExpands(rule, sundays, 10));
+
+            CHECK_TRUE(rule.parse("FREQ=MONTHLY;BYMONTHDAY=-3", datetime_t(1997, 9, 28, 9, 0, 0)));
+            s32 const thirdLast[] = {19970928, 19971029, 19971128, 19971229, 19980129, 19980226};
+            CHECK_TRUE(sExpands(rule, thirdLast, 6));
+
+            CHECK_TRUE(rule.parse("FREQ=MONTHLY;COUNT=10;BYMONTHDAY=2,15", datetime_t(1997, 9, 2, 9, 0, 0)));
+            s32 const twice[] = {19970902, 19970915, 19971002, 19971015, 19971102, 19971115, 19971202, 19971215, 19980102, 19980115};
+            CHECK_TRUE(sExpands(rule, twice, 10));
+
+            CHECK_TRUE(rule.parse("FREQ=MONTHLY;BYDAY=MO,TU,WE,TH,FR;BYSETPOS=-1", datetime_t(1997, 9, 30, 9, 0, 0)));
+            s32 const lastWorkday[] = {19970930, 19971031, 19971128, 19971231, 19980130, 19980227, 19980331};
+            CHECK_TRUE(sExpands(rule, lastWorkday, 7));
+
+            CHECK_TRUE(rule.parse("FREQ=MONTHLY;COUNT=3;BYDAY=TU,WE,TH;BYSETPOS=3", datetime_t(1997, 9, 4, 9, 0, 0)));
+            s32 const third[] = {19970904, 19971007, 19971106};
+            CHECK_TRUE(sExpands(rule, third, 3));
+            CHECK_TRUE(sEnds(rule, 3));
+
+            CHECK_TRUE(rule.parse("FREQ=YEARLY;COUNT=10;BYMONTH=6,7", datetime_t(1997, 6, 10, 9, 0, 0)));
+            s32 const summer[] = {19970610, 19970710, 19980610, 19980710, 19990610, 19990710, 20000610, 20000710, 20010610, 20010710};
+            CHECK_TRUE(sExpands(rule, summer, 10));
+
+            CHECK_TRUE(rule.parse("FREQ=YEARLY;BYMONTH=3;BYDAY=TH", datetime_t(1997, 3, 13, 9, 0, 0)));
+            s32 const march[] = {19970313, 19970320, 19970327, 19980305, 19980312, 19980319, 19980326, 19990304, 19990311, 19990318, 19990325};
+            CHECK_TRUE(sExpands(rule, march, 11));
+
+            CHECK_TRUE(rule.parse("FREQ=YEARLY;INTERVAL=4;BYMONTH=11;BYDAY=TU;BYMONTHDAY=2,3,4,5,6,7,8", datetime_t(1996, 11, 5, 9, 0, 0)));
+            s32 const election[] = {19961105, 20001107, 20041102};
+            CHECK_TRUE(sExpands(rule, election, 3));
+
+            // Friday the 13th, DTSTART excluded
+            datetime_t const exdates[] = {datetime_t(1997, 9, 2, 9, 0, 0)};
+            CHECK_TRUE(rule.parse("FREQ=MONTHLY;BYDAY=FR;BYMONTHDAY=13", datetime_t(1997, 9, 2, 9, 0, 0)));
+            rule.setExDates(exdates, 1);
+            s32 const friday13[] = {19980213, 19980313, 19981113, 19990813, 20001013};
+            CHECK_TRUE(sExpands(rule, friday13, 5));
+        }
+
+        UNITTEST_TEST(sub_daily)
+        {
+            rrule_t          rule;
+            rrule_iterator_t it;
+            datetime_t       when;
+
+            CHECK_TRUE(rule.parse("FREQ=HOURLY;INTERVAL=3;UNTIL=19970902T170000Z", datetime_t(1997, 9, 2, 9, 0, 0)));
+            it.init(&rule);
+            CHECK_TRUE(it.next(when) && when == datetime_t(1997, 9, 2, 9, 0, 0));
+            CHECK_TRUE(it.next(when) && when == datetime_t(1997, 9, 2, 12, 0, 0));
+            CHECK_TRUE(it.next(when) && when == datetime_t(1997, 9, 2, 15, 0, 0));
+            CHECK_FALSE(it.next(when));
+
+            CHECK_TRUE(rule.parse("FREQ=MINUTELY;INTERVAL=15;COUNT=6", datetime_t(1997, 9, 2, 9, 0, 0)));
+            it.init(&rule);
+            for (s32 i = 0; i < 6; ++i)
+            {
+                CHECK_TRUE(it.next(when));
+                CHECK_TRUE(when == datetime_t(1997, 9, 2, 9 + (i * 15) / 60, (i * 15) % 60, 0));
+            }
+            CHECK_FALSE(it.next(when));
+
+            // Days that do not match are skipped as a whole
+            CHECK_TRUE(rule.parse("FREQ=MINUTELY;INTERVAL=7;BYDAY=SA", datetime_t(2024, 6, 3, 0, 0, 0)));
+            it.init(&rule);
+            CHECK_TRUE(it.next(when));
+            CHECK_TRUE(when == datetime_t(2024, 6, 8, 0, 3, 0)); // 7203 minutes, the first multiple of 7 on that day
+            it.seek(datetime_t(2024, 6, 10));
+            CHECK_TRUE(it.next(when));
+            CHECK_TRUE(when == datetime_t(2024, 6, 15, 0, 3, 0));
+
+            // Never matches, ends instead of searching forever
+            CHECK_TRUE(rule.parse("FREQ=HOURLY;BYMONTH=2;BYMONTHDAY=30", datetime_t(2024, 1, 1)));
+            it.init(&rule);
+            CHECK_FALSE(it.next(when));
+            CHECK_TRUE(rule.parse("FREQ=YEARLY;BYMONTH=2;BYMONTHDAY=30", datetime_t(2024, 1, 1)));
+            it.init(&rule);
+            CHECK_FALSE(it.next(when));
+        }
+
+        UNITTEST_TEST(interval_range)
+        {
+            // An INTERVAL beyond the datetime_t range (e.g. 999999999 hours) only has DTSTART
+            static const char* sRules[] = {"FREQ=SECONDLY;INTERVAL=999999999", "FREQ=MINUTELY;INTERVAL=999999999", "FREQ=HOURLY;INTERVAL=999999999", "FREQ=DAILY;INTERVAL=999999999",
+                                           "FREQ=WEEKLY;INTERVAL=999999999",   "FREQ=MONTHLY;INTERVAL=999999999",  "FREQ=YEARLY;INTERVAL=999999999"};
+            datetime_t const   start(2024, 1, 1, 9, 0, 0);
+            for (s32 i = 0; i < 7; ++i)
+            {
+                rrule_t rule;
+                CHECK_TRUE(rule.parse(sRules[i], start));
+                rrule_iterator_t it;
+                datetime_t       when;
+                it.init(&rule);
+                CHECK_TRUE(it.next(when) && when == start);
+                if (i < RRuleHourly)
+                    continue; // 999999999 seconds and minutes are within the range
+                CHECK_FALSE(it.next(when));
+                it.seek(datetime_t(2030, 1, 1));
+                CHECK_FALSE(it.next(when));
+            }
+
+            rrule_t rule;
+            CHECK_TRUE(rule.parse("FREQ=SECONDLY;INTERVAL=999999999;COUNT=3", start));
+            rrule_iterator_t it;
+            datetime_t       when;
+            it.init(&rule);
+            CHECK_TRUE(it.next(when) && when == start);
+            CHECK_TRUE(it.next(when) && when == start + timespan_t::sFromSeconds(999999999));
+            CHECK_TRUE(it.next(when) && when == start + timespan_t::sFromSeconds(2 * (u64)999999999));
+            CHECK_FALSE(it.next(when));
+        }
+
+        UNITTEST_TEST(until_and_exdate)
+        {
+            rrule_t rule;
+            CHECK_TRUE(rule.parse("FREQ=DAILY;UNTIL=19970905", datetime_t(1997, 9, 2, 9, 0, 0)));
+            CHECK_TRUE(sEnds(rule, 4)); // a date is inclusive
+
+            // Excluded occurrences count towards COUNT
+            datetime_t const exdates[] = {datetime_t(1997, 9, 3, 9, 0, 0), datetime_t(1997, 9, 4, 8, 0, 0), datetime_t(1997, 9, 5, 9, 0, 0)};
+            CHECK_TRUE(rule.parse("FREQ=DAILY;COUNT=5", datetime_t(1997, 9, 2, 9, 0, 0)));
+            rule.setExDates(exdates, 3);
+            s32 const days[] = {19970902, 19970904, 19970906};
+            CHECK_TRUE(sExpands(rule, days, 3));
+            CHECK_TRUE(sEnds(rule, 3));
+
+            datetime_t out[8];
+            CHECK_EQUAL(2, rule.expand(datetime_t(1997, 9, 3), datetime_t(1997, 9, 10), out, 8));
+            CHECK_TRUE(out[0] == datetime_t(1997, 9, 4, 9, 0, 0));
+            CHECK_TRUE(out[1] == datetime_t(1997, 9, 6, 9, 0, 0));
+            CHECK_EQUAL(1, rule.expand(datetime_t(1997, 9, 3), datetime_t(1997, 9, 10), out, 1));
+        }
+
+        UNITTEST_TEST(seek)
+        {
+            // seek() gives the first occurrence at or after the instant, as enumerating does
+            const char* rules[] = {
+              "FREQ=DAILY;INTERVAL=3",
+              "FREQ=WEEKLY;INTERVAL=2;BYDAY=MO,TH;WKST=SU",
+              "FREQ=MONTHLY;BYDAY=MO,TU,WE,TH,FR;BYSETPOS=1,-1",
+              "FREQ=MONTHLY;INTERVAL=5;BYMONTHDAY=31,-10",
+              "FREQ=YEARLY;BYMONTH=2,8;BYDAY=-1FR,2MO",
+              "FREQ=YEARLY;INTERVAL=2;BYDAY=SU;BYSETPOS=10,-3,20",
+              "FREQ=MONTHLY;COUNT=40;BYDAY=-2WE",
+              "FREQ=YEARLY;COUNT=30;BYMONTHDAY=1,15,-1;BYSETPOS=-1,2",
+              "FREQ=HOURLY;INTERVAL=29;BYDAY=TU",
+              "FREQ=HOURLY;INTERVAL=29;COUNT=100;BYDAY=TU,FR",
+            };
+            datetime_t const exdates[] = {datetime_t(2020, 3, 2, 9, 30, 0), datetime_t(2021, 7, 30, 9, 30, 0), datetime_t(2023, 1, 1)};
+
+            datetime_t* all = new datetime_t[4096];
+            for (s32 r = 0; r < (s32)(sizeof(rules) / sizeof(rules[0])); ++r)
+            {
+                rrule_t rule;
+                CHECK_TRUE(rule.parse(rules[r], datetime_t(2020, 1, 15, 9, 30, 0)));
+                rule.setExDates(exdates, 3);
+
+                rrule_iterator_t it;
+                it.init(&rule);
+                s32 count = 0;
+                while (count < 4096 && it.next(all[count]) && all[count] < datetime_t(2030, 1, 1))
+                    count += 1;
+                CHECK_TRUE(count > 10);
+                for (s32 i = 1; i < count; ++i)
+                    CHECK_TRUE(all[i - 1] < all[i]);
+
+                s32 index = 0;
+                for (datetime_t at = datetime_t(2019, 12, 1, 17, 0, 0); at < datetime_t(2029, 6, 1); at = at + timespan_t(9, 13, 7, 0))
+                {
+                    while (index < count && all[index] < at)
+                        index += 1;
+                    it.seek(at);
+                    datetime_t when;
+                    bool const found = it.next(when);
+                    if (index < count)
+                        CHECK_TRUE(found && when == all[index]);
+                    else
+                        CHECK_TRUE(!found || when >= datetime_t(2030, 1, 1));
+                }
+            }
+            delete[] all;
+        }
+    }
+}
+UNITTEST_SUITE_END
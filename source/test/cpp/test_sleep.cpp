@@ -0,0 +1,64 @@
+#include "cunittest/cunittest.h"
+
+#include "ctime/c_time.h"
+#include "ctime/c_timespan.h"
+#include "ctime/c_sleep.h"
+
+using namespace ncore;
+
+UNITTEST_SUITE_BEGIN(sleep)
+{
+    UNITTEST_FIXTURE(main)
+    {
+        UNITTEST_FIXTURE_SETUP()
+        {
+            ntime::init();
+            ntime::resetSleepStats();
+        }
+        UNITTEST_FIXTURE_TEARDOWN() { ntime::exit(); }
+
+        UNITTEST_TEST(sleep_until)
+        {
+            // Never wakes up early, whatever the margin is while it is being learned. Deadlines are
+            // relative to now, a deadline that passed during an overshoot returns at once and is
+            // not counted in mSleeps.
+            tick_t const step = microsecondsToTicks(1500.0);
+            for (s32 i = 0; i < 20; ++i)
+            {
+                tick_t const next = getTime() + step;
+                ntime::sleepUntil(next);
+                CHECK_TRUE(getTime() >= next);
+            }
+
+            ntime::sleep_stats_t stats;
+            ntime::getSleepStats(stats);
+            CHECK_TRUE(stats.mSleeps > 0 && stats.mSleeps <= 20);
+            CHECK_TRUE(stats.mMargin > 0);
+            CHECK_TRUE(stats.mMargin <= millisecondsToTicks(2.0));
+            CHECK_TRUE(stats.mMaxError >= 0);
+            CHECK_TRUE(stats.mTotalError >= stats.mMaxError);
+            CHECK_TRUE(stats.mSpunTicks > 0);
+            CHECK_TRUE(stats.mSleptTicks + stats.mSpunTicks >= step * ((s64)stats.mSleeps - 1));
+        }
+
+        UNITTEST_TEST(sleep_for)
+        {
+            tick_t const start = getTime();
+            ntime::sleepFor(timespan_t(0, 0, 0, 0, 2)); // 2 ms
+            CHECK_TRUE(getTime() - start >= millisecondsToTicks(2.0));
+
+            // Nothing to wait for
+            ntime::sleepFor(timespan_t(0));
+            ntime::sleepUntil(start);
+
+            ntime::sleep_stats_t stats;
+            ntime::getSleepStats(stats);
+            CHECK_EQUAL(1, stats.mSleeps);
+            ntime::resetSleepStats();
+            ntime::getSleepStats(stats);
+            CHECK_EQUAL(0, stats.mSleeps);
+            CHECK_EQUAL(0, stats.mSpunTicks);
+        }
+    }
+}
+UNITTEST_SUITE_END
@@ -3,6 +3,7 @@
 
 #include "ctime/c_timer.h"
 #include "ctime/c_time.h"
+#include "ctime/c_timespan.h"
 #include "ctime/private/c_time_source.h"
 
 using namespace ncore;
@@ -200,6 +201,19 @@ UNITTEST_SUITE_BEGIN(timer)
             CHECK_TRUE(ms1);
             CHECK_TRUE(ms1 == ms2);
         }
+        UNITTEST_TEST(global_x_ExactConversions)
+        {
+            // 1000000 ticks per second, one tick is a microsecond
+            CHECK_EQUAL(1000000, ntime::toTicks(timespan_t(0, 0, 0, 1, 0)));
+            CHECK_EQUAL(1500, ntime::toTicks(timespan_t(15000)));
+            CHECK_EQUAL(1000, ntime::ticksToNs(1));
+            CHECK_EQUAL(2, ntime::nsToTicks(2999));
+
+            // Large values do not overflow halfway, 100 years of nanoseconds
+            s64 const ns = D_CONSTANT_S64(3155760000000000000);
+            CHECK_EQUAL(ns / 1000, ntime::nsToTicks(ns));
+            CHECK_EQUAL(ns, ntime::ticksToNs(ns / 1000));
+        }
     }
 }
 UNITTEST_SUITE_END
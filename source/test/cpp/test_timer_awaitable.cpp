@@ -0,0 +1,214 @@
+#include "ccore/c_allocator.h"
+#include "cunittest/cunittest.h"
+
+#include "ctime/c_time.h"
+#include "ctime/c_timer_awaitable.h"
+#include "ctime/private/c_time_source.h"
+
+#include "test_allocator.h"
+
+#include <stdlib.h>
+
+#if defined(__cpp_impl_coroutine)
+
+using namespace ncore;
+
+namespace
+{
+    class time_source_test_t : public time_source_t
+    {
+        tick_t mTicks;
+
+    public:
+        time_source_test_t()
+            : mTicks(0)
+        {
+        }
+
+        void reset() { mTicks = 0; }
+        void update(tick_t ticks) { mTicks += ticks; }
+
+        virtual tick_t getTimeInTicks() { return mTicks; }
+        virtual s64    getTicksPerSecond() { return 1000 * 1000; }
+    };
+
+    static time_source_test_t sTimeSource;
+
+    // Steps the fake time by 'step' and polls the executor until 'until'
+    static void sRun(timer_executor_t& executor, tick_t step, tick_t until)
+    {
+        while (getTime() < until)
+        {
+            sTimeSource.update(step);
+            executor.poll();
+        }
+    }
+
+    static task_t<void> sTicker(s32 count, tick_t* woke)
+    {
+        for (s32 i = 0; i < count; ++i)
+        {
+            co_await ntime::sleep_for(timespan_t(0, 0, 0, 0, 10)); // 10 ms
+            woke[i] = getTime();
+        }
+    }
+
+    static task_t<s32> sCompute(s32 ms, s32 value, bool* returned)
+    {
+        co_await ntime::sleep_for(timespan_t(0, 0, 0, 0, ms));
+        *returned = true;
+        co_return value * 2;
+    }
+
+    static task_t<void> sAwaitWithTimeout(task_t<s32>* task, s32 timeoutMs, s32* result)
+    {
+        // Not awaited in the condition of an if/else, GCC 12 miscompiles that coroutine
+        bool const inTime = co_await ntime::with_timeout(*task, timespan_t(0, 0, 0, 0, timeoutMs));
+        *result           = inTime ? task->result() : -1;
+    }
+
+    static task_t<void> sUntil(datetime_t when, bool* woke)
+    {
+        co_await ntime::until(when);
+        *woke = true;
+    }
+
+    static task_t<void> sSleeper(tick_t deadline, s32* woke)
+    {
+        co_await ntime::sleep_until(deadline);
+        *woke += 1;
+    }
+} // namespace
+
+UNITTEST_SUITE_BEGIN(timer_awaitable)
+{
+    UNITTEST_FIXTURE(main)
+    {
+        UNITTEST_FIXTURE_SETUP()
+        {
+            sTimeSource.reset();
+            g_SetTimeSource(&sTimeSource);
+        }
+
+        UNITTEST_FIXTURE_TEARDOWN() { g_SetTimeSource(nullptr); }
+
+        UNITTEST_TEST(sleep_for)
+        {
+            ntest::test_allocator_t allocator;
+            {
+                timer_executor_t executor;
+                CHECK_TRUE(executor.init(&allocator, 16, 1000)); // 1 ms slots
+                executor.makeCurrent();
+
+                tick_t       woke[3] = {0, 0, 0};
+                task_t<void> task    = sTicker(3, woke);
+                task.start();
+                CHECK_EQUAL(1, executor.size());
+                sRun(executor, 100, 40000);
+                CHECK_TRUE(task.done());
+                CHECK_EQUAL(0, executor.size());
+
+                // Never early, at most one slot late
+                tick_t deadline = 0;
+                for (s32 i = 0; i < 3; ++i)
+                {
+                    deadline += 10000;
+                    CHECK_TRUE(woke[i] >= deadline);
+                    CHECK_TRUE(woke[i] <= deadline + 1000 + 100);
+                    deadline = woke[i];
+                }
+            }
+            CHECK_EQUAL(0, allocator.numAllocations());
+        }
+
+        UNITTEST_TEST(many)
+        {
+            // One thread and one wheel for all the sleeping coroutines
+            ntest::test_allocator_t allocator;
+            timer_executor_t        executor;
+            executor.init(&allocator, 20000, 1000);
+            executor.makeCurrent();
+
+            s32           woke  = 0;
+            s32 const     count = 20000;
+            task_t<void>* tasks = new task_t<void>[count];
+            for (s32 i = 0; i < count; ++i)
+            {
+                tasks[i] = sSleeper((tick_t)(i % 997) * 1000, &woke);
+                tasks[i].start();
+            }
+            CHECK_EQUAL(count - (count + 996) / 997, (s32)executor.size()); // a deadline of 0 does not wait
+            sRun(executor, 1000, 1000 * 1000);
+            CHECK_EQUAL(count, woke);
+            CHECK_EQUAL(0, executor.size());
+            delete[] tasks;
+        }
+
+        UNITTEST_TEST(with_timeout)
+        {
+            ntest::test_allocator_t allocator;
+            timer_executor_t        executor;
+            executor.init(&allocator, 16, 1000);
+            executor.makeCurrent();
+
+            // Returns in time
+            bool         returned = false;
+            s32          result   = 0;
+            task_t<s32>  compute  = sCompute(5, 21, &returned);
+            task_t<void> awaiter  = sAwaitWithTimeout(&compute, 10, &result);
+            awaiter.start();
+            CHECK_EQUAL(2, executor.size()); // the sleep of compute and the timeout
+            sRun(executor, 100, 20000);
+            CHECK_TRUE(awaiter.done());
+            CHECK_TRUE(returned);
+            CHECK_EQUAL(42, result);
+            CHECK_EQUAL(0, executor.size());
+
+            // Times out, the task runs on detached and destroys itself
+            returned = false;
+            compute  = sCompute(50, 21, &returned);
+            awaiter  = sAwaitWithTimeout(&compute, 10, &result);
+            awaiter.start();
+            sRun(executor, 100, getTime() + 20000);
+            CHECK_TRUE(awaiter.done());
+            CHECK_EQUAL(-1, result);
+            CHECK_FALSE(compute.isValid());
+            CHECK_FALSE(returned);
+            CHECK_EQUAL(1, executor.size());
+            sRun(executor, 100, getTime() + 50000);
+            CHECK_TRUE(returned);
+            CHECK_EQUAL(0, executor.size());
+        }
+
+        UNITTEST_TEST(until)
+        {
+            ntime::init();
+            {
+                ntest::test_allocator_t allocator;
+                timer_executor_t        executor;
+                executor.init(&allocator, 16, 1000);
+                executor.makeCurrent();
+
+                // A date in the past does not wait
+                bool         woke = false;
+                task_t<void> past = sUntil(datetime_t::sNow() - timespan_t(1, 0, 0), &woke);
+                past.start();
+                CHECK_TRUE(woke);
+                CHECK_TRUE(past.done());
+
+                // Destroying a waiting coroutine takes it out of the wheel
+                woke                = false;
+                task_t<void> future = sUntil(datetime_t::sNow() + timespan_t(1, 0, 0), &woke);
+                future.start();
+                CHECK_FALSE(woke);
+                CHECK_EQUAL(1, executor.size());
+                future = task_t<void>();
+                CHECK_EQUAL(0, executor.size());
+            }
+            ntime::exit();
+        }
+    }
+}
+UNITTEST_SUITE_END
+
+#endif // __cpp_impl_coroutine
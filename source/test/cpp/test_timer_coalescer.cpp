@@ -0,0 +1,133 @@
+#include "ccore/c_allocator.h"
+#include "cunittest/cunittest.h"
+
+#include "ctime/c_time.h"
+#include "ctime/c_timer_coalescer.h"
+
+#include "test_allocator.h"
+
+#include <stdlib.h>
+
+using namespace ncore;
+
+namespace
+{
+    static void sOnFire(timer_handle_t handle, void* user) { *(s32*)user += 1; }
+
+    struct canceller_t
+    {
+        timer_coalescer_t* mCoalescer;
+        timer_handle_t     mHandles[2];
+        s32                mFired;
+    };
+
+    static void sOnCancel(timer_handle_t handle, void* user)
+    {
+        canceller_t* c = (canceller_t*)user;
+        c->mFired += 1;
+        c->mCoalescer->cancel(c->mHandles[(c->mHandles[0] == handle) ? 1 : 0]);
+    }
+} // namespace
+
+UNITTEST_SUITE_BEGIN(timer_coalescer)
+{
+    UNITTEST_FIXTURE(main)
+    {
+        UNITTEST_FIXTURE_SETUP() { ntime::init(); }
+        UNITTEST_FIXTURE_TEARDOWN() { ntime::exit(); }
+
+        UNITTEST_TEST(overlapping_windows)
+        {
+            ntest::test_allocator_t allocator;
+            {
+                timer_coalescer_t coalescer;
+                CHECK_TRUE(coalescer.init(&allocator, 16));
+
+                tick_t const     second = getTicksPerSecond();
+                tick_t const     start  = 1000;
+                timespan_t const slack(0, 0, 0, 1); // one second
+                s32              fired[3] = {0, 0, 0};
+                coalescer.schedule(start, slack, sOnFire, &fired[0]);
+                coalescer.schedule(start + second / 10, slack, sOnFire, &fired[1]);
+                coalescer.schedule(start + second * 2, slack, sOnFire, &fired[2]);
+
+                // The first window ends first, the second window has started by then
+                tick_t wakeup = 0;
+                CHECK_TRUE(coalescer.nextWakeup(wakeup));
+                CHECK_EQUAL(start + second, wakeup);
+                CHECK_EQUAL(2, coalescer.fire(wakeup));
+                CHECK_EQUAL(1, fired[0]);
+                CHECK_EQUAL(1, fired[1]);
+                CHECK_EQUAL(0, fired[2]);
+
+                CHECK_TRUE(coalescer.nextWakeup(wakeup));
+                CHECK_EQUAL(start + second * 3, wakeup);
+                CHECK_EQUAL(1, coalescer.fire(wakeup));
+                CHECK_FALSE(coalescer.nextWakeup(wakeup));
+
+                CHECK_EQUAL(2, coalescer.getWakeups());
+                CHECK_EQUAL(3, coalescer.getFired());
+                CHECK_EQUAL(1, coalescer.getWakeupsSaved());
+                coalescer.resetStats();
+                CHECK_EQUAL(0, coalescer.getWakeupsSaved());
+            }
+            CHECK_EQUAL(0, allocator.numAllocations());
+        }
+
+        UNITTEST_TEST(storm)
+        {
+            // 1000 timeouts spread over 50 ms with 10 ms slack
+            ntest::test_allocator_t allocator;
+            timer_coalescer_t       coalescer;
+            coalescer.init(&allocator, 1000);
+
+            tick_t const ms    = getTicksPerSecond() / 1000;
+            s32          fired = 0;
+            for (s32 i = 0; i < 1000; ++i)
+                coalescer.schedule((i % 50) * ms, timespan_t(0, 0, 0, 0, 10), sOnFire, &fired);
+
+            tick_t wakeup;
+            while (coalescer.nextWakeup(wakeup))
+                coalescer.fire(wakeup);
+            CHECK_EQUAL(1000, fired);
+            CHECK_TRUE(coalescer.getWakeups() <= 5);
+            CHECK_EQUAL(1000 - (s64)coalescer.getWakeups(), (s64)coalescer.getWakeupsSaved());
+        }
+
+        UNITTEST_TEST(cancel)
+        {
+            ntest::test_allocator_t allocator;
+            timer_coalescer_t       coalescer;
+            coalescer.init(&allocator, 4);
+
+            s32                  fired = 0;
+            timer_handle_t const a     = coalescer.schedule(100, timespan_t(0), sOnFire, &fired);
+            timer_handle_t const b     = coalescer.schedule(50, timespan_t(0), sOnFire, &fired);
+            CHECK_TRUE(coalescer.cancel(b));
+            CHECK_FALSE(coalescer.cancel(b));
+            CHECK_FALSE(coalescer.isScheduled(b));
+
+            tick_t wakeup;
+            CHECK_TRUE(coalescer.nextWakeup(wakeup));
+            CHECK_EQUAL(100, wakeup);
+            CHECK_EQUAL(0, coalescer.fire(99));
+            CHECK_EQUAL(1, coalescer.fire(100));
+            CHECK_FALSE(coalescer.isScheduled(a));
+            CHECK_EQUAL(1, fired);
+
+            // A callback cancels the other timer of its wakeup
+            canceller_t c = {&coalescer, {0, 0}, 0};
+            c.mHandles[0] = coalescer.schedule(200, timespan_t(0), sOnCancel, &c);
+            c.mHandles[1] = coalescer.schedule(200, timespan_t(0), sOnCancel, &c);
+            CHECK_EQUAL(1, coalescer.fire(200));
+            CHECK_EQUAL(1, c.mFired);
+            CHECK_EQUAL(0, coalescer.size());
+
+            // Full
+            for (s32 i = 0; i < 4; ++i)
+                CHECK_TRUE(coalescer.schedule(300, timespan_t(0), sOnFire, &fired) != 0);
+            CHECK_TRUE(coalescer.schedule(300, timespan_t(0), sOnFire, &fired) == 0);
+        }
+    }
+}
+UNITTEST_SUITE_END
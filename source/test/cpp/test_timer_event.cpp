@@ -0,0 +1,175 @@
+#include "ccore/c_allocator.h"
+#include "cunittest/cunittest.h"
+
+#include "ctime/c_time.h"
+#include "ctime/c_timespan.h"
+#include "ctime/c_timer_wheel.h"
+#include "ctime/c_deadline_queue.h"
+#include "ctime/c_timer_coalescer.h"
+#include "ctime/c_timer_event.h"
+#include "ctime/private/c_time_source.h"
+
+#include "test_allocator.h"
+
+#include <stdlib.h>
+
+#ifdef TARGET_LINUX
+#    include <unistd.h>
+#    include <sys/epoll.h>
+#endif
+
+using namespace ncore;
+
+namespace
+{
+    class time_source_test_t : public time_source_t
+    {
+        tick_t mTicks;
+
+    public:
+        time_source_test_t()
+            : mTicks(0)
+        {
+        }
+
+        void set(tick_t ticks) { mTicks = ticks; }
+
+        virtual tick_t getTimeInTicks() { return mTicks; }
+        virtual s64    getTicksPerSecond() { return 1000 * 1000; }
+    };
+
+    static time_source_test_t sTimeSource;
+
+    struct fired_t
+    {
+        tick_t mDeadline;
+        tick_t mFiredAt;
+    };
+
+    static void sOnFire(timer_handle_t handle, void* user)
+    {
+        fired_t* fired  = (fired_t*)user;
+        fired->mFiredAt = getTime();
+    }
+} // namespace
+
+UNITTEST_SUITE_BEGIN(timer_event)
+{
+    UNITTEST_FIXTURE(main)
+    {
+        UNITTEST_FIXTURE_SETUP()
+        {
+            sTimeSource.set(0);
+            g_SetTimeSource(&sTimeSource);
+        }
+
+        UNITTEST_FIXTURE_TEARDOWN() { g_SetTimeSource(nullptr); }
+
+        UNITTEST_TEST(poll_timeout)
+        {
+            // Rounded up to a millisecond, never before the deadline
+            CHECK_EQUAL(0, ntime::pollTimeout(100, 100));
+            CHECK_EQUAL(0, ntime::pollTimeout(50, 100));
+            CHECK_EQUAL(1, ntime::pollTimeout(101, 100));
+            CHECK_EQUAL(1, ntime::pollTimeout(1100, 100));
+            CHECK_EQUAL(2, ntime::pollTimeout(1101, 100));
+            CHECK_EQUAL(0x7fffffff, ntime::pollTimeout(D_CONSTANT_S64(1) << 50, 0));
+
+            ntest::test_allocator_t allocator;
+            {
+                timer_wheel_t wheel;
+                wheel.init(&allocator, 16, 1000, 0);
+                CHECK_EQUAL(-1, ntime::pollTimeout(wheel));
+
+                // The slot of the deadline
+                fired_t fired = {5500, 0};
+                wheel.schedule(5500, sOnFire, &fired);
+                tick_t when = 0;
+                CHECK_TRUE(wheel.nextExpiry(when));
+                CHECK_EQUAL(6000, when);
+                CHECK_EQUAL(6, ntime::pollTimeout(wheel));
+                sTimeSource.set(5800);
+                CHECK_EQUAL(1, ntime::pollTimeout(wheel));
+                sTimeSource.set(6000);
+                wheel.advance(6000);
+                CHECK_EQUAL(6000, fired.mFiredAt);
+
+                // Beyond the lowest level, the next cascade
+                wheel.schedule(300000, sOnFire, &fired);
+                CHECK_TRUE(wheel.nextExpiry(when));
+                CHECK_EQUAL(256000, when);
+                wheel.advance(when);
+                CHECK_TRUE(wheel.nextExpiry(when));
+                CHECK_EQUAL(300000, when);
+
+                deadline_queue_t queue;
+                queue.init(&allocator, 4);
+                CHECK_EQUAL(-1, ntime::pollTimeout(queue));
+                queue.push(7800, nullptr);
+                CHECK_EQUAL(2, ntime::pollTimeout(queue));
+                queue.exit();
+
+                timer_coalescer_t coalescer;
+                coalescer.init(&allocator, 4);
+                CHECK_EQUAL(-1, ntime::pollTimeout(coalescer));
+                coalescer.schedule(8000, timespan_t(0, 0, 0, 0, 10), sOnFire, &fired);
+                CHECK_EQUAL(12, ntime::pollTimeout(coalescer)); // the end of the window
+                coalescer.exit();
+            }
+            CHECK_EQUAL(0, allocator.numAllocations());
+        }
+
+#ifdef TARGET_LINUX
+        UNITTEST_TEST(timer_fd)
+        {
+            ntime::init();
+            {
+                ntest::test_allocator_t allocator;
+                timer_wheel_t           wheel;
+                wheel.init(&allocator, 16, microsecondsToTicks(100.0), getTime());
+
+                timer_fd_t timer;
+                CHECK_TRUE(timer.init());
+                s32 const   epfd  = ::epoll_create1(0);
+                epoll_event event = {};
+                event.events      = EPOLLIN;
+                event.data.fd     = timer.getFd();
+                CHECK_EQUAL(0, ::epoll_ctl(epfd, EPOLL_CTL_ADD, timer.getFd(), &event));
+
+                tick_t const now      = getTime();
+                fired_t      fired[3] = {{now + millisecondsToTicks(2.0), 0}, {now + millisecondsToTicks(2.0), 0}, {now + millisecondsToTicks(5.0), 0}};
+                for (s32 i = 0; i < 3; ++i)
+                    wheel.schedule(fired[i].mDeadline, sOnFire, &fired[i]);
+
+                // The first two fire together in one batch
+                u32 total   = 0;
+                s32 wakeups = 0;
+                CHECK_TRUE(timer.arm(wheel));
+                CHECK_TRUE(timer.arm(wheel)); // no syscall
+                CHECK_EQUAL(1, timer.getSyscalls());
+                while (total < 3 && wakeups < 100)
+                {
+                    epoll_event events[4];
+                    s32 const   n = ::epoll_wait(epfd, events, 4, 1000);
+                    for (s32 i = 0; i < n; ++i)
+                        total += timer.dispatch(wheel);
+                    timer.arm(wheel);
+                    wakeups += 1;
+                }
+                CHECK_EQUAL(3, total);
+                CHECK_TRUE(wakeups <= 4); // a wakeup may come early for a cascade or a spurious one
+                CHECK_EQUAL(1 + wakeups, (s32)timer.getSyscalls());
+                for (s32 i = 0; i < 3; ++i)
+                    CHECK_TRUE(fired[i].mFiredAt >= fired[i].mDeadline);
+
+                // Disarmed when empty, not readable anymore
+                epoll_event events[4];
+                CHECK_EQUAL(0, ::epoll_wait(epfd, events, 4, 0));
+                ::close(epfd);
+            }
+            ntime::exit();
+        }
+#endif
+    }
+}
+UNITTEST_SUITE_END
@@ -0,0 +1,178 @@
+#include "ccore/c_allocator.h"
+#include "cunittest/cunittest.h"
+
+#include "ctime/c_time.h"
+#include "ctime/c_timer.h"
+#include "ctime/c_timer_service.h"
+
+#include "test_allocator.h"
+#include "test_benchmark.h"
+
+#include <stdlib.h>
+#include <atomic>
+#include <thread>
+
+using namespace ncore;
+
+namespace
+{
+    static std::atomic<s64> sFired;
+    static void             sOnFire(timer_handle_t handle, void* user) { sFired.fetch_add(1, std::memory_order_relaxed); }
+
+    // Worker 1 goes idle while worker 0 is busy running its first callback
+    static timer_service_t* sService;
+    static s32              sStolenByOne;
+    static void             sOnBusy(timer_handle_t handle, void* user)
+    {
+        sFired.fetch_add(1, std::memory_order_relaxed);
+        if (sStolenByOne < 0)
+        {
+            sStolenByOne = 0;
+            sStolenByOne = (s32)sService->poll(1, 1000);
+        }
+    }
+
+    static u32 sRandom(u32& state)
+    {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        return state;
+    }
+} // namespace
+
+UNITTEST_SUITE_BEGIN(timer_service)
+{
+    UNITTEST_FIXTURE(main)
+    {
+        UNITTEST_FIXTURE_SETUP() { ntime::init(); }
+        UNITTEST_FIXTURE_TEARDOWN() { ntime::exit(); }
+
+        UNITTEST_TEST(schedule_and_cancel)
+        {
+            ntest::test_allocator_t allocator;
+            {
+                timer_service_t service;
+                CHECK_TRUE(service.init(&allocator, 2, 8, 1, 0));
+                sFired = 0;
+
+                timer_handle_t const a = service.schedule(0, 10, sOnFire, nullptr);
+                timer_handle_t const b = service.schedule(0, 20, sOnFire, nullptr);
+                timer_handle_t const c = service.schedule(1, 10, sOnFire, nullptr);
+                CHECK_TRUE(a != 0 && b != 0 && c != 0);
+
+                CHECK_TRUE(service.cancel(b)); // still in the inbox
+                CHECK_FALSE(service.cancel(b));
+                CHECK_EQUAL(0, service.poll(0, 5));
+                CHECK_TRUE(service.cancel(a)); // in the wheel
+                CHECK_EQUAL(0, service.poll(0, 30));
+                CHECK_EQUAL(0, (s64)sFired);
+
+                CHECK_EQUAL(0, service.poll(1, 5));
+                CHECK_EQUAL(1, service.poll(1, 20));
+                CHECK_EQUAL(1, (s64)sFired);
+                CHECK_FALSE(service.cancel(c));
+                CHECK_FALSE(service.cancel(a));
+
+                // Handles with an index beyond the capacity of the worker
+                CHECK_FALSE(service.cancel((a & ~(timer_handle_t)0xffffff) | 8));
+                CHECK_FALSE(service.cancel((a & ~(timer_handle_t)0xffffff) | 0xffffff));
+
+                u64 fired, batches, stolen;
+                service.getStats(1, fired, batches, stolen);
+                CHECK_EQUAL(1, fired);
+                CHECK_EQUAL(1, batches);
+                CHECK_EQUAL(0, stolen);
+
+                // Full
+                for (s32 i = 0; i < 8; ++i)
+                    CHECK_TRUE(service.schedule(1, 100, sOnFire, nullptr) != 0);
+                CHECK_TRUE(service.schedule(1, 100, sOnFire, nullptr) == 0);
+            }
+            CHECK_EQUAL(0, allocator.numAllocations());
+        }
+
+        UNITTEST_TEST(steal)
+        {
+            ntest::test_allocator_t allocator;
+            timer_service_t         service;
+            service.init(&allocator, 2, 1024, 1, 0);
+            sFired       = 0;
+            sService     = &service;
+            sStolenByOne = -1;
+
+            // 10 batches expire on worker 0, worker 1 steals while worker 0 runs the first
+            s32 const count = timer_service_t::BatchSize * 10;
+            for (s32 i = 0; i < count; ++i)
+                service.schedule(0, 100 + i, sOnBusy, nullptr);
+            u32 const ran = service.poll(0, 1000);
+            CHECK_EQUAL(count, (s64)sFired);
+            CHECK_EQUAL(count - sStolenByOne, (s32)ran);
+            CHECK_EQUAL(timer_service_t::BatchSize * 9, sStolenByOne);
+
+            u64 fired, batches, stolen;
+            service.getStats(1, fired, batches, stolen);
+            CHECK_EQUAL(9, stolen);
+        }
+
+        static void sBenchmark(s32 numThreads, s32 timersPerThread, bool report)
+        {
+            ntest::test_allocator_t allocator;
+            timer_service_t         service;
+            service.init(&allocator, numThreads, (u32)timersPerThread * 2, 1, 0);
+            sFired = 0;
+
+            // Every thread schedules on random workers and polls its own until all fired
+            std::atomic<s64> now{0};
+            s64 const        total = (s64)numThreads * timersPerThread;
+            auto             run   = [&](s32 w) {
+                u32 state = 0x9e3779b9 + (u32)w;
+                for (s32 i = 0; i < timersPerThread; ++i)
+                {
+                    s32 const target = (s32)(sRandom(state) % (u32)numThreads);
+                    while (service.schedule(target, now.load() + (sRandom(state) % 1000), sOnFire, nullptr) == 0)
+                        service.poll(w, now.load());
+                    if ((i & 63) == 0)
+                        service.poll(w, now.fetch_add(16));
+                }
+                while (sFired.load() < total)
+                    service.poll(w, now.fetch_add(16));
+            };
+
+            ncore::timer_t timer;
+            timer.start();
+            std::thread threads[64];
+            for (s32 t = 1; t < numThreads; ++t)
+                threads[t] = std::thread(run, t);
+            run(0);
+            for (s32 t = 1; t < numThreads; ++t)
+                threads[t].join();
+            tick_t const elapsed = timer.stop();
+            CHECK_EQUAL(total, (s64)sFired);
+            if (report)
+            {
+                char name[64];
+                snprintf(name, sizeof(name), "timer_service_t, %d threads", numThreads);
+                ntest::benchmarkReport(name, total, elapsed);
+            }
+        }
+
+        UNITTEST_TEST(threads)
+        {
+            // The benchmark with small sizes, every timer fires exactly once
+            sBenchmark(1, 10000, false);
+            sBenchmark(2, 10000, false);
+            sBenchmark(4, 10000, false);
+        }
+
+        UNITTEST_TEST(benchmark)
+        {
+            // Opt-in (CTIME_BENCHMARK), reports timers per second for 1 to 64 threads
+            if (!ntest::benchmarkEnabled())
+                return;
+            for (s32 numThreads = 1; numThreads <= 64; numThreads *= 2)
+                sBenchmark(numThreads, 100000, true);
+        }
+    }
+}
+UNITTEST_SUITE_END
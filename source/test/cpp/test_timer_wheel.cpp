@@ -0,0 +1,240 @@
+#include "ccore/c_allocator.h"
+#include "cunittest/cunittest.h"
+
+#include "ctime/c_timer_wheel.h"
+
+#include "test_allocator.h"
+
+#include <stdlib.h>
+
+using namespace ncore;
+
+namespace
+{
+    struct fired_t
+    {
+        s32    mCount;
+        tick_t mNow; ///< The 'now' of the advance() that fired
+    };
+
+    static tick_t sNow;
+
+    static void sOnFire(timer_handle_t handle, void* user)
+    {
+        fired_t* f = (fired_t*)user;
+        f->mCount += 1;
+        f->mNow = sNow;
+    }
+
+    static u32 sAdvance(timer_wheel_t& wheel, tick_t now)
+    {
+        sNow = now;
+        return wheel.advance(now);
+    }
+
+    static u32 sRandom(u32& state)
+    {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        return state;
+    }
+} // namespace
+
+UNITTEST_SUITE_BEGIN(timer_wheel)
+{
+    UNITTEST_FIXTURE(main)
+    {
+        UNITTEST_FIXTURE_SETUP() {}
+        UNITTEST_FIXTURE_TEARDOWN() {}
+
+        UNITTEST_TEST(fire_at_deadline)
+        {
+            ntest::test_allocator_t allocator;
+            {
+                timer_wheel_t wheel;
+                CHECK_TRUE(wheel.init(&allocator, 16, 10, 1000));
+
+                fired_t              a = {0, 0}, b = {0, 0}, c = {0, 0};
+                timer_handle_t const ha = wheel.schedule(1095, sOnFire, &a);
+                timer_handle_t const hb = wheel.schedule(1100, sOnFire, &b);
+                timer_handle_t const hc = wheel.schedule(500, sOnFire, &c); // already due
+                CHECK_EQUAL(3, wheel.size());
+                CHECK_TRUE(ha != 0 && hb != 0 && hc != 0);
+
+                CHECK_EQUAL(1, sAdvance(wheel, 1005));
+                CHECK_EQUAL(1, c.mCount);
+                CHECK_EQUAL(0, sAdvance(wheel, 1094));
+                CHECK_EQUAL(0, sAdvance(wheel, 1099)); // 'a' is due in the next slot, never early
+                CHECK_EQUAL(2, sAdvance(wheel, 1100));
+                CHECK_EQUAL(1, a.mCount);
+                CHECK_EQUAL(1, b.mCount);
+                CHECK_EQUAL(0, wheel.size());
+
+                // Handles of fired timers are stale
+                CHECK_FALSE(wheel.isScheduled(ha));
+                CHECK_FALSE(wheel.cancel(hb));
+                CHECK_FALSE(wheel.reschedule(hc, 2000));
+                CHECK_FALSE(wheel.isScheduled(0));
+            }
+            CHECK_EQUAL(0, allocator.numAllocations());
+        }
+
+        UNITTEST_TEST(cancel_and_reschedule)
+        {
+            ntest::test_allocator_t allocator;
+            timer_wheel_t           wheel;
+            wheel.init(&allocator, 4, 1, 0);
+
+            fired_t              a = {0, 0}, b = {0, 0};
+            timer_handle_t const ha = wheel.schedule(100, sOnFire, &a);
+            timer_handle_t const hb = wheel.schedule(100000, sOnFire, &b);
+            CHECK_TRUE(wheel.cancel(ha));
+            CHECK_FALSE(wheel.cancel(ha));
+            CHECK_TRUE(wheel.reschedule(hb, 50));
+
+            tick_t deadline = 0;
+            CHECK_TRUE(wheel.getDeadline(hb, deadline));
+            CHECK_EQUAL(50, deadline);
+
+            CHECK_EQUAL(1, sAdvance(wheel, 200));
+            CHECK_EQUAL(0, a.mCount);
+            CHECK_EQUAL(1, b.mCount);
+            CHECK_EQUAL(200, b.mNow);
+
+            // A reused node gets a new generation
+            timer_handle_t const hc = wheel.schedule(300, sOnFire, &a);
+            CHECK_TRUE(hc != ha && hc != hb);
+            CHECK_FALSE(wheel.isScheduled(ha));
+            CHECK_TRUE(wheel.isScheduled(hc));
+            wheel.exit();
+            CHECK_EQUAL(0, allocator.numAllocations());
+        }
+
+        UNITTEST_TEST(pool_exhausted)
+        {
+            ntest::test_allocator_t allocator;
+            timer_wheel_t           wheel;
+            wheel.init(&allocator, 2, 1, 0);
+            fired_t f = {0, 0};
+            CHECK_TRUE(wheel.schedule(10, sOnFire, &f) != 0);
+            CHECK_TRUE(wheel.schedule(10, sOnFire, &f) != 0);
+            CHECK_TRUE(wheel.schedule(10, sOnFire, &f) == 0);
+            CHECK_EQUAL(2, sAdvance(wheel, 10));
+            CHECK_TRUE(wheel.schedule(10, sOnFire, &f) != 0);
+        }
+
+        UNITTEST_TEST(far_deadlines)
+        {
+            // Deadlines on every level and beyond the top level
+            ntest::test_allocator_t allocator;
+            timer_wheel_t           wheel;
+            wheel.init(&allocator, 8, 1, 0);
+
+            tick_t const deadlines[] = {200, 300, 70000, 20000000, D_CONSTANT_S64(4294967296) + 1000};
+            fired_t      fired[5];
+            for (s32 i = 0; i < 5; ++i)
+            {
+                fired[i].mCount = 0;
+                wheel.schedule(deadlines[i], sOnFire, &fired[i]);
+            }
+            for (s32 i = 0; i < 5; ++i)
+            {
+                CHECK_EQUAL(0, sAdvance(wheel, deadlines[i] - 1));
+                CHECK_EQUAL(1, sAdvance(wheel, deadlines[i]));
+                CHECK_EQUAL(1, fired[i].mCount);
+            }
+        }
+
+        struct batch_t
+        {
+            timer_wheel_t* mWheel;
+            timer_handle_t mHandles[2];
+            s32            mFired;
+        };
+
+        static void sOnBatch(timer_handle_t handle, void* user)
+        {
+            // The first timer to fire cancels the other one of the same batch and schedules a new one
+            batch_t* b = (batch_t*)user;
+            b->mFired += 1;
+            if (b->mFired == 1)
+            {
+                CHECK_TRUE(b->mWheel->cancel(b->mHandles[(b->mHandles[0] == handle) ? 1 : 0]));
+                b->mWheel->schedule(sNow, sOnBatch, b);
+            }
+        }
+
+        UNITTEST_TEST(callbacks_change_the_wheel)
+        {
+            ntest::test_allocator_t allocator;
+            timer_wheel_t           wheel;
+            wheel.init(&allocator, 8, 1, 0);
+
+            batch_t b     = {&wheel, {0, 0}, 0};
+            b.mHandles[0] = wheel.schedule(10, sOnBatch, &b);
+            b.mHandles[1] = wheel.schedule(10, sOnBatch, &b);
+            CHECK_EQUAL(1, sAdvance(wheel, 10)); // one fired, one cancelled
+            CHECK_EQUAL(1, wheel.size());        // the slot of 10 has expired, the new one is due in the next
+            CHECK_EQUAL(0, sAdvance(wheel, 10));
+            CHECK_EQUAL(1, sAdvance(wheel, 11));
+            CHECK_EQUAL(2, b.mFired);
+        }
+
+        UNITTEST_TEST(random_against_brute_force)
+        {
+            const s32         N = 2000;
+            ntest::test_allocator_t allocator;
+            timer_wheel_t           wheel;
+            tick_t const            resolution = 1000;
+            wheel.init(&allocator, N, resolution, 0);
+
+            static tick_t         deadlines[N];
+            static fired_t        fired[N];
+            static timer_handle_t handles[N];
+            static bool           cancelled[N];
+
+            u32 state = 0x12345678;
+            for (s32 i = 0; i < N; ++i)
+            {
+                deadlines[i]    = (tick_t)(sRandom(state) % (1 << 26)) * 64;
+                fired[i].mCount = 0;
+                cancelled[i]    = false;
+                handles[i]      = wheel.schedule(deadlines[i], sOnFire, &fired[i]);
+            }
+            for (s32 i = 0; i < N; i += 7)
+            {
+                cancelled[i] = true;
+                wheel.cancel(handles[i]);
+            }
+            for (s32 i = 3; i < N; i += 11)
+            {
+                deadlines[i] = (tick_t)(sRandom(state) % (1 << 26)) * 64;
+                if (!cancelled[i])
+                    wheel.reschedule(handles[i], deadlines[i]);
+            }
+
+            tick_t now  = 0;
+            tick_t prev = 0;
+            s32    bad  = 0;
+            while (wheel.size() > 0)
+            {
+                prev = now;
+                now += (tick_t)(sRandom(state) % (1 << 30));
+                sAdvance(wheel, now);
+                for (s32 i = 0; i < N; ++i)
+                {
+                    // Fired exactly by the first advance at or past the slot of the deadline
+                    tick_t const slot = ((deadlines[i] + resolution - 1) / resolution) * resolution;
+                    bool const   due  = !cancelled[i] && slot <= now;
+                    if (due && (fired[i].mCount != 1 || (slot > prev && fired[i].mNow != now)))
+                        bad++;
+                    if (!due && fired[i].mCount != 0)
+                        bad++;
+                }
+            }
+            CHECK_EQUAL(0, bad);
+        }
+    }
+}
+UNITTEST_SUITE_END
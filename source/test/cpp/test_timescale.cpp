@@ -0,0 +1,132 @@
+#include "cunittest/cunittest.h"
+
+#include "ctime/c_datetime.h"
+#include "ctime/c_timescale.h"
+
+using namespace ncore;
+
+UNITTEST_SUITE_BEGIN(timescale)
+{
+    UNITTEST_FIXTURE(main)
+    {
+        UNITTEST_FIXTURE_SETUP() {}
+        UNITTEST_FIXTURE_TEARDOWN() { ntime::resetLeapSeconds(); }
+
+        UNITTEST_TEST(tai_minus_utc)
+        {
+            CHECK_EQUAL(28, ntime::getNumLeapSeconds());
+            CHECK_EQUAL(10, ntime::taiMinusUtc(datetime_t(1970, 1, 1)));
+            CHECK_EQUAL(10, ntime::taiMinusUtc(datetime_t(1972, 6, 30, 23, 59, 59)));
+            CHECK_EQUAL(11, ntime::taiMinusUtc(datetime_t(1972, 7, 1)));
+            CHECK_EQUAL(36, ntime::taiMinusUtc(datetime_t(2016, 12, 31, 23, 59, 59)));
+            CHECK_EQUAL(37, ntime::taiMinusUtc(datetime_t(2017, 1, 1)));
+            CHECK_EQUAL(37, ntime::taiMinusUtc(datetime_t(2030, 1, 1)));
+            CHECK_TRUE(ntime::getLeapSecondsExpiry() == datetime_t(2026, 6, 28));
+        }
+
+        UNITTEST_TEST(utc_tai_gps)
+        {
+            datetime_t const utc(2017, 1, 1, 0, 0, 0);
+            CHECK_TRUE(ntime::utcToTai(utc) == datetime_t(2017, 1, 1, 0, 0, 37));
+            CHECK_TRUE(ntime::utcToGps(utc) == datetime_t(2017, 1, 1, 0, 0, 18));
+            CHECK_TRUE(ntime::taiToUtc(datetime_t(2017, 1, 1, 0, 0, 37)) == utc);
+            CHECK_TRUE(ntime::gpsToUtc(datetime_t(2017, 1, 1, 0, 0, 18)) == utc);
+            CHECK_TRUE(ntime::taiToGps(datetime_t(2017, 1, 1, 0, 0, 37)) == datetime_t(2017, 1, 1, 0, 0, 18));
+            CHECK_TRUE(ntime::gpsToTai(datetime_t(2017, 1, 1, 0, 0, 18)) == datetime_t(2017, 1, 1, 0, 0, 37));
+
+            // GPS and UTC coincide at the GPS epoch
+            CHECK_TRUE(ntime::utcToGps(datetime_t(1980, 1, 6)) == datetime_t(1980, 1, 6));
+
+            // The inserted leap second 2016-12-31 23:59:60 repeats 23:59:59
+            CHECK_TRUE(ntime::taiToUtc(datetime_t(2017, 1, 1, 0, 0, 35)) == datetime_t(2016, 12, 31, 23, 59, 59));
+            CHECK_TRUE(ntime::taiToUtc(datetime_t(2017, 1, 1, 0, 0, 36, 500)) == datetime_t(2016, 12, 31, 23, 59, 59, 500));
+
+            // Sub-microsecond ticks are preserved
+            datetime_t const precise((u64)utc.ticks() + 1234567);
+            CHECK_EQUAL((s64)utc.ticks() + 1234567 + 37 * 10000000, (s64)ntime::utcToTai(precise).ticks());
+        }
+
+        UNITTEST_TEST(batch)
+        {
+            datetime_t in[256];
+            datetime_t out[256];
+            datetime_t dt(1970, 1, 1);
+            for (s32 i = 0; i < 256; ++i)
+            {
+                in[i] = dt;
+                dt.addDays((i & 1) ? 97 : 11);
+            }
+            in[100].swap(in[7]);
+
+            ntime::utcToTai(in, out, 256);
+            for (s32 i = 0; i < 256; ++i)
+                CHECK_TRUE(out[i] == ntime::utcToTai(in[i]));
+            ntime::taiToUtc(out, out, 256);
+            for (s32 i = 0; i < 256; ++i)
+                CHECK_TRUE(out[i] == in[i]);
+
+            ntime::utcToGps(in, out, 256);
+            for (s32 i = 0; i < 256; ++i)
+                CHECK_TRUE(out[i] == ntime::utcToGps(in[i]));
+            ntime::gpsToUtc(out, out, 256);
+            for (s32 i = 0; i < 256; ++i)
+                CHECK_TRUE(out[i] == in[i]);
+        }
+
+        UNITTEST_TEST(cached_offset)
+        {
+            CHECK_EQUAL(37, ntime::taiMinusUtc(datetime_t(2024, 1, 1)));
+            u64 hits0, misses0;
+            ntime::getLeapSecondCacheStats(hits0, misses0);
+
+            datetime_t dt(2024, 1, 1);
+            for (s32 i = 0; i < 100; ++i)
+            {
+                ntime::utcToTai(dt);
+                dt.addSeconds(3600);
+            }
+            u64 hits, misses;
+            ntime::getLeapSecondCacheStats(hits, misses);
+            CHECK_EQUAL(100, (s32)(hits - hits0));
+            CHECK_EQUAL(0, (s32)(misses - misses0));
+        }
+
+        UNITTEST_TEST(load)
+        {
+            const char* list = "#\tleap-seconds.list\n"
+                               "#@\t3991593600\n"
+                               "2272060800\t10\t# 1 Jan 1972\n"
+                               "2287785600\t11\t# 1 Jul 1972\n"
+                               "\n"
+                               "3692217600\t37\t# 1 Jan 2017\n"
+                               "4102444800\t38\t# 1 Jan 2030, hypothetical\n";
+            s64 length = 0;
+            while (list[length] != 0)
+                length++;
+
+            // Cache the current offset first, loading must invalidate it
+            CHECK_EQUAL(37, ntime::taiMinusUtc(datetime_t(2031, 1, 1)));
+            CHECK_TRUE(ntime::loadLeapSeconds(list, length));
+            CHECK_EQUAL(4, ntime::getNumLeapSeconds());
+            CHECK_EQUAL(38, ntime::taiMinusUtc(datetime_t(2031, 1, 1)));
+            CHECK_EQUAL(11, ntime::taiMinusUtc(datetime_t(2000, 1, 1)));
+            CHECK_TRUE(ntime::utcToTai(datetime_t(2030, 1, 1)) == datetime_t(2030, 1, 1, 0, 0, 38));
+
+            // Out of order, the loaded table stays
+            const char* bad = "3692217600\t37\n2272060800\t10\n";
+            CHECK_FALSE(ntime::loadLeapSeconds(bad, 28));
+            CHECK_EQUAL(4, ntime::getNumLeapSeconds());
+
+            ntime::resetLeapSeconds();
+            CHECK_EQUAL(37, ntime::taiMinusUtc(datetime_t(2031, 1, 1)));
+
+            // Only when the system has a leap second list
+            if (ntime::loadLeapSecondsFile("/usr/share/zoneinfo/leap-seconds.list"))
+            {
+                CHECK_TRUE(ntime::getNumLeapSeconds() >= 28);
+                CHECK_EQUAL(37, ntime::taiMinusUtc(datetime_t(2020, 1, 1)));
+            }
+        }
+    }
+}
+UNITTEST_SUITE_END
@@ -0,0 +1,468 @@
+#include "cunittest/cunittest.h"
+
+#include "ctime/c_datetime.h"
+#include "ctime/c_timezone.h"
+
+#include <stdio.h>
+
+using namespace ncore;
+
+UNITTEST_SUITE_BEGIN(timezone)
+{
+    UNITTEST_FIXTURE(main)
+    {
+        // Builds a 'slim' TZif version 2 file (empty version 1 block) with CET/CEST types
+        class tzif_builder_t
+        {
+        public:
+            u8  mData[1024];
+            s32 mSize;
+
+            void u32be(u32 v)
+            {
+                mData[mSize++] = (u8)(v >> 24);
+                mData[mSize++] = (u8)(v >> 16);
+                mData[mSize++] = (u8)(v >> 8);
+                mData[mSize++] = (u8)v;
+            }
+
+            void header(u32 timecnt, u32 typecnt, u32 charcnt)
+            {
+                mData[mSize++] = 'T';
+                mData[mSize++] = 'Z';
+                mData[mSize++] = 'i';
+                mData[mSize++] = 'f';
+                mData[mSize++] = '2';
+                for (s32 i = 0; i < 15; ++i)
+                    mData[mSize++] = 0;
+                u32be(0); // isutcnt
+                u32be(0); // isstdcnt
+                u32be(0); // leapcnt
+                u32be(timecnt);
+                u32be(typecnt);
+                u32be(charcnt);
+            }
+
+            void build(const s64* times, const u8* types, s32 count, const char* footer)
+            {
+                mSize = 0;
+                header(0, 1, 1);
+                u32be(0); // v1: one ttinfo and a designation
+                mData[mSize++] = 0;
+                mData[mSize++] = 0;
+                mData[mSize++] = 0;
+
+                header(count, 2, 10);
+                for (s32 i = 0; i < count; ++i)
+                {
+                    u32be((u32)((u64)times[i] >> 32));
+                    u32be((u32)times[i]);
+                }
+                for (s32 i = 0; i < count; ++i)
+                    mData[mSize++] = types[i];
+                u32be(3600); // type 0, CET
+                mData[mSize++] = 0;
+                mData[mSize++] = 0;
+                u32be(7200); // type 1, CEST
+                mData[mSize++] = 1;
+                mData[mSize++] = 4;
+                const char* names = "CET\0CEST\0\0";
+                for (s32 i = 0; i < 10; ++i)
+                    mData[mSize++] = (u8)names[i];
+                mData[mSize++] = '\n';
+                while (*footer != 0)
+                    mData[mSize++] = (u8)*footer++;
+                mData[mSize++] = '\n';
+            }
+        };
+
+        static tzif_builder_t sZone2023;
+
+        static const timezone_t* sGetTestZone()
+        {
+            // 2023-03-26 01:00 UTC and 2023-10-29 01:00 UTC
+            static const s64 sTimes[] = {D_CONSTANT_S64(1679792400), D_CONSTANT_S64(1698541200)};
+            static const u8  sTypes[] = {1, 0};
+            if (sZone2023.mSize == 0)
+                sZone2023.build(sTimes, sTypes, 2, "CET-1CEST,M3.5.0,M10.5.0/3");
+            return timezone_t::sRegister("Test/CET2023", sZone2023.mData, (u64)sZone2023.mSize);
+        }
+
+        static tzif_builder_t sZoneRuleOnly;
+
+        static const timezone_t* sGetRuleOnlyZone()
+        {
+            // No transitions at all, the footer (southern hemisphere) gives every period
+            if (sZoneRuleOnly.mSize == 0)
+                sZoneRuleOnly.build(nullptr, nullptr, 0, "AEST-10AEDT,M10.1.0,M4.1.0/3");
+            return timezone_t::sRegister("Test/Sydney", sZoneRuleOnly.mData, (u64)sZoneRuleOnly.mSize);
+        }
+
+        UNITTEST_FIXTURE_SETUP() {}
+        UNITTEST_FIXTURE_TEARDOWN() {}
+
+        UNITTEST_TEST(register_and_find)
+        {
+            const timezone_t* tz = sGetTestZone();
+            CHECK_TRUE(tz != nullptr);
+            CHECK_TRUE(tz == sGetTestZone());
+            CHECK_TRUE(tz == timezone_t::sFind("Test/CET2023"));
+
+            u8 garbage[64] = {'T', 'Z', 'i', 'x'};
+            CHECK_TRUE(timezone_t::sRegister("Test/Garbage", garbage, sizeof(garbage)) == nullptr);
+            CHECK_TRUE(timezone_t::sFind("../etc/passwd") == nullptr);
+        }
+
+        UNITTEST_TEST(utc)
+        {
+            const timezone_t* tz = timezone_t::sUtc();
+            datetime_t const  dt(2023, 7, 1, 12, 0, 0);
+            CHECK_EQUAL(0, tz->offsetAt(dt));
+            CHECK_TRUE(tz->utcToLocal(dt) == dt);
+            CHECK_TRUE(tz->localToUtc(dt) == dt);
+        }
+
+        UNITTEST_TEST(offsetAt)
+        {
+            const timezone_t* tz = sGetTestZone();
+            CHECK_EQUAL(3600, tz->offsetAt(datetime_t(2023, 1, 1)));
+            CHECK_EQUAL(3600, tz->offsetAt(datetime_t(2023, 3, 26, 0, 59, 59)));
+            CHECK_EQUAL(7200, tz->offsetAt(datetime_t(2023, 3, 26, 1, 0, 0)));
+            CHECK_EQUAL(7200, tz->offsetAt(datetime_t(2023, 7, 1)));
+            CHECK_EQUAL(3600, tz->offsetAt(datetime_t(2023, 10, 29, 1, 0, 0)));
+        }
+
+        UNITTEST_TEST(utcToLocal)
+        {
+            const timezone_t* tz = sGetTestZone();
+            CHECK_TRUE(tz->utcToLocal(datetime_t(2023, 1, 1, 12, 0, 0)) == datetime_t(2023, 1, 1, 13, 0, 0));
+            CHECK_TRUE(tz->utcToLocal(datetime_t(2023, 7, 1, 12, 0, 0, 500)) == datetime_t(2023, 7, 1, 14, 0, 0, 500));
+        }
+
+        UNITTEST_TEST(localToUtc)
+        {
+            const timezone_t* tz = sGetTestZone();
+            CHECK_TRUE(tz->localToUtc(datetime_t(2023, 7, 1, 14, 0, 0)) == datetime_t(2023, 7, 1, 12, 0, 0));
+            CHECK_TRUE(tz->localToUtc(datetime_t(2023, 1, 1, 13, 0, 0)) == datetime_t(2023, 1, 1, 12, 0, 0));
+
+            // Gap, shifted forward
+            CHECK_TRUE(tz->localToUtc(datetime_t(2023, 3, 26, 2, 30, 0)) == datetime_t(2023, 3, 26, 1, 30, 0));
+            // Overlap, earliest
+            CHECK_TRUE(tz->localToUtc(datetime_t(2023, 10, 29, 2, 30, 0)) == datetime_t(2023, 10, 29, 0, 30, 0));
+        }
+
+        UNITTEST_TEST(localToUtc_policy)
+        {
+            const timezone_t* tz = sGetTestZone();
+            datetime_t        utc;
+
+            // Gap, 02:30 does not exist on 2023-03-26
+            datetime_t const gap(2023, 3, 26, 2, 30, 0);
+            CHECK_TRUE(tz->localToUtc(gap, LocalTimeEarliest, utc));
+            CHECK_TRUE(utc == datetime_t(2023, 3, 26, 0, 30, 0));
+            CHECK_TRUE(tz->localToUtc(gap, LocalTimeLatest, utc));
+            CHECK_TRUE(utc == datetime_t(2023, 3, 26, 1, 30, 0));
+            CHECK_TRUE(tz->localToUtc(gap, LocalTimeShiftForward, utc));
+            CHECK_TRUE(utc == datetime_t(2023, 3, 26, 1, 30, 0));
+            CHECK_FALSE(tz->localToUtc(gap, LocalTimeReject, utc));
+
+            // Overlap, 02:30 occurs twice on 2023-10-29
+            datetime_t const overlap(2023, 10, 29, 2, 30, 0);
+            CHECK_TRUE(tz->localToUtc(overlap, LocalTimeEarliest, utc));
+            CHECK_TRUE(utc == datetime_t(2023, 10, 29, 0, 30, 0));
+            CHECK_TRUE(tz->localToUtc(overlap, LocalTimeLatest, utc));
+            CHECK_TRUE(utc == datetime_t(2023, 10, 29, 1, 30, 0));
+            CHECK_TRUE(tz->localToUtc(overlap, LocalTimeShiftForward, utc));
+            CHECK_TRUE(utc == datetime_t(2023, 10, 29, 0, 30, 0));
+            CHECK_FALSE(tz->localToUtc(overlap, LocalTimeReject, utc));
+
+            // Unambiguous, every policy agrees
+            CHECK_TRUE(tz->localToUtc(datetime_t(2023, 10, 29, 3, 0, 0), LocalTimeReject, utc));
+            CHECK_TRUE(utc == datetime_t(2023, 10, 29, 2, 0, 0));
+            CHECK_TRUE(tz->localToUtc(datetime_t(2023, 3, 26, 3, 0, 0), LocalTimeReject, utc));
+            CHECK_TRUE(utc == datetime_t(2023, 3, 26, 1, 0, 0));
+        }
+
+        UNITTEST_TEST(localToUtc_batch)
+        {
+            const timezone_t* tz = sGetTestZone();
+
+            // Every 30 minutes over both transition days, 2 x 48
+            datetime_t in[96];
+            datetime_t out[96];
+            for (s32 i = 0; i < 48; ++i)
+            {
+                in[i]      = datetime_t(2023, 3, 26, i / 2, (i & 1) * 30, 0);
+                in[48 + i] = datetime_t(2023, 10, 29, i / 2, (i & 1) * 30, 0);
+            }
+
+            u64 gaps[2];
+            u64 overlaps[2];
+            CHECK_EQUAL(92, (s32)tz->localToUtc(in, out, 96, LocalTimeReject, gaps, overlaps));
+            for (s32 i = 0; i < 96; ++i)
+            {
+                bool const isGap     = i == 4 || i == 5;   // 02:00 and 02:30 on 2023-03-26
+                bool const isOverlap = i == 52 || i == 53; // 02:00 and 02:30 on 2023-10-29
+                CHECK_EQUAL(isGap, ((gaps[i >> 6] >> (i & 63)) & 1) != 0);
+                CHECK_EQUAL(isOverlap, ((overlaps[i >> 6] >> (i & 63)) & 1) != 0);
+                if (isGap || isOverlap)
+                    CHECK_TRUE(out[i] == in[i]);
+            }
+
+            // Every policy matches the scalar conversion, also in place
+            for (s32 p = LocalTimeEarliest; p <= LocalTimeShiftForward; ++p)
+            {
+                ELocalTimePolicy const policy = (ELocalTimePolicy)p;
+                datetime_t             col[96];
+                for (s32 i = 0; i < 96; ++i)
+                    col[i] = in[i];
+                tz->localToUtc(col, col, 96, policy);
+                for (s32 i = 0; i < 96; ++i)
+                {
+                    datetime_t utc = in[i];
+                    tz->localToUtc(in[i], policy, utc);
+                    CHECK_TRUE(col[i] == utc);
+                }
+            }
+        }
+
+        UNITTEST_TEST(period_cache)
+        {
+            const timezone_t* tz = sGetTestZone();
+            CHECK_EQUAL(3600, tz->offsetAt(datetime_t(2023, 1, 1)));
+            timezone_t::sResetCacheStats();
+
+            datetime_t dt(2023, 5, 1);
+            for (s32 i = 0; i < 100; ++i)
+            {
+                CHECK_EQUAL(7200, tz->offsetAt(dt));
+                dt.addHours(1);
+            }
+
+            u64 hits, misses;
+            timezone_t::sGetCacheStats(hits, misses);
+            CHECK_EQUAL(99, (s32)hits);
+            CHECK_EQUAL(1, (s32)misses);
+
+            // Leaving the period is a miss, local to UTC within the period is a hit
+            CHECK_EQUAL(3600, tz->offsetAt(datetime_t(2023, 12, 1)));
+            CHECK_TRUE(tz->localToUtc(datetime_t(2023, 12, 10, 13, 0, 0)) == datetime_t(2023, 12, 10, 12, 0, 0));
+            timezone_t::sGetCacheStats(hits, misses);
+            CHECK_EQUAL(100, (s32)hits);
+            CHECK_EQUAL(2, (s32)misses);
+
+            // Close to a transition the cached period does not decide, that is a miss
+            CHECK_TRUE(tz->localToUtc(datetime_t(2023, 10, 29, 2, 30, 0)) == datetime_t(2023, 10, 29, 0, 30, 0));
+            timezone_t::sGetCacheStats(hits, misses);
+            CHECK_EQUAL(100, (s32)hits);
+            CHECK_EQUAL(3, (s32)misses);
+
+            // A miss of local to UTC caches the period it resolved to
+            CHECK_TRUE(tz->localToUtc(datetime_t(2023, 7, 10, 14, 0, 0)) == datetime_t(2023, 7, 10, 12, 0, 0));
+            CHECK_TRUE(tz->localToUtc(datetime_t(2023, 7, 11, 14, 0, 0)) == datetime_t(2023, 7, 11, 12, 0, 0));
+            timezone_t::sGetCacheStats(hits, misses);
+            CHECK_EQUAL(101, (s32)hits);
+            CHECK_EQUAL(4, (s32)misses);
+        }
+
+        UNITTEST_TEST(utcToLocal_batch)
+        {
+            const timezone_t* tz = sGetTestZone();
+
+            // Sorted, spanning both transitions
+            datetime_t in[64];
+            datetime_t out[64];
+            datetime_t dt(2023, 1, 1);
+            for (s32 i = 0; i < 64; ++i)
+            {
+                in[i] = dt;
+                dt.addDays(6);
+            }
+            tz->utcToLocal(in, out, 64);
+            for (s32 i = 0; i < 64; ++i)
+                CHECK_TRUE(out[i] == tz->utcToLocal(in[i]));
+
+            // Unsorted and in place
+            in[10].swap(in[40]);
+            for (s32 i = 0; i < 64; ++i)
+                out[i] = in[i];
+            tz->utcToLocal(out, out, 64);
+            for (s32 i = 0; i < 64; ++i)
+                CHECK_TRUE(out[i] == tz->utcToLocal(in[i]));
+        }
+
+        UNITTEST_TEST(posix_rule)
+        {
+            // 2023 is in the table, later years come from "CET-1CEST,M3.5.0,M10.5.0/3"
+            const timezone_t* tz = sGetTestZone();
+            CHECK_EQUAL(3600, tz->offsetAt(datetime_t(2024, 1, 15)));
+            CHECK_EQUAL(3600, tz->offsetAt(datetime_t(2030, 3, 31, 0, 59, 59)));
+            CHECK_EQUAL(7200, tz->offsetAt(datetime_t(2030, 3, 31, 1, 0, 0)));
+            CHECK_EQUAL(7200, tz->offsetAt(datetime_t(2030, 10, 27, 0, 59, 59)));
+            CHECK_EQUAL(3600, tz->offsetAt(datetime_t(2030, 10, 27, 1, 0, 0)));
+            CHECK_EQUAL(7200, tz->offsetAt(datetime_t(2100, 3, 28, 1, 0, 0)));
+            CHECK_EQUAL(3600, tz->offsetAt(datetime_t(2100, 10, 31, 1, 0, 0)));
+
+            // Gap and overlap of a computed year
+            CHECK_TRUE(tz->localToUtc(datetime_t(2030, 3, 31, 2, 30, 0)) == datetime_t(2030, 3, 31, 1, 30, 0));
+            CHECK_TRUE(tz->localToUtc(datetime_t(2030, 10, 27, 2, 30, 0)) == datetime_t(2030, 10, 27, 0, 30, 0));
+            CHECK_TRUE(tz->localToUtc(datetime_t(2030, 7, 1, 14, 0, 0)) == datetime_t(2030, 7, 1, 12, 0, 0));
+
+            // Southern hemisphere, DST spans the turn of the year
+            const timezone_t* syd = sGetRuleOnlyZone();
+            CHECK_TRUE(syd != nullptr);
+            CHECK_EQUAL(39600, syd->offsetAt(datetime_t(2030, 1, 1)));
+            CHECK_EQUAL(39600, syd->offsetAt(datetime_t(2030, 4, 6, 15, 59, 59)));
+            CHECK_EQUAL(36000, syd->offsetAt(datetime_t(2030, 4, 6, 16, 0, 0)));
+            CHECK_EQUAL(36000, syd->offsetAt(datetime_t(2030, 10, 5, 15, 59, 59)));
+            CHECK_EQUAL(39600, syd->offsetAt(datetime_t(2030, 10, 5, 16, 0, 0)));
+            CHECK_TRUE(syd->utcToLocal(datetime_t(2030, 12, 31, 13, 0, 0)) == datetime_t(2031, 1, 1, 0, 0, 0));
+
+            // Sorted batch over the end of the table and decades of computed years
+            datetime_t in[400];
+            datetime_t out[400];
+            datetime_t dt(2023, 1, 1);
+            for (s32 i = 0; i < 400; ++i)
+            {
+                in[i] = dt;
+                dt.addDays(29);
+            }
+            tz->utcToLocal(in, out, 400);
+            for (s32 i = 0; i < 400; ++i)
+                CHECK_TRUE(out[i] == tz->utcToLocal(in[i]));
+            syd->utcToLocal(in, out, 400);
+            for (s32 i = 0; i < 400; ++i)
+                CHECK_TRUE(out[i] == syd->utcToLocal(in[i]));
+
+            // Ticks beyond the end of the datetime_t range (only in raw memory), the last period
+            // ends before them, they saturate at the maximum
+            u64* raw = reinterpret_cast<u64*>(in);
+            in[0]    = datetime_t(2030, 1, 1);
+            raw[1]   = D_CONSTANT_U64(0x3000000000000000);
+            raw[2]   = D_CONSTANT_U64(0x3fffffffffffffff);
+            tz->utcToLocal(in, out, 3);
+            CHECK_TRUE(out[0] == tz->utcToLocal(in[0]));
+            CHECK_TRUE(out[1] == datetime_t::sMaxValue);
+            CHECK_TRUE(out[2] == datetime_t::sMaxValue);
+            syd->utcToLocal(in, out, 3);
+            CHECK_TRUE(out[0] == syd->utcToLocal(in[0]));
+            CHECK_TRUE(out[1] == datetime_t::sMaxValue);
+            CHECK_TRUE(out[2] == datetime_t::sMaxValue);
+        }
+
+        static bool sWriteFile(const char* path, const u8* data, s32 size)
+        {
+            FILE* f = fopen(path, "wb");
+            if (f == nullptr)
+                return false;
+            bool const ok = fwrite(data, 1, (size_t)size, f) == (size_t)size;
+            fclose(f);
+            return ok;
+        }
+
+        UNITTEST_TEST(register_name_length)
+        {
+            const timezone_t* tz = sGetTestZone();
+            CHECK_TRUE(tz != nullptr);
+
+            // 64 characters does not fit, it is not truncated into another name
+            char name[80];
+            for (s32 i = 0; i < 64; ++i)
+                name[i] = 'x';
+            name[64] = 0;
+            CHECK_TRUE(timezone_t::sRegister(name, sZone2023.mData, (u64)sZone2023.mSize) == nullptr);
+            CHECK_TRUE(timezone_t::sFind(name) == nullptr);
+            name[63] = 0;
+            CHECK_TRUE(timezone_t::sRegister(name, sZone2023.mData, (u64)sZone2023.mSize) != nullptr);
+            CHECK_TRUE(timezone_t::sRegister("", sZone2023.mData, (u64)sZone2023.mSize) == nullptr);
+        }
+
+        UNITTEST_TEST(mapped_file)
+        {
+            // A zone that is not built in, loaded (mapped) from a zoneinfo directory on disk
+            tzif_builder_t file;
+            file.build(nullptr, nullptr, 0, "CET-1CEST,M3.5.0,M10.5.0/3");
+            u8 garbage[64] = {'T', 'Z', 'i', 'x'};
+            if (!sWriteFile("./test_tzif_mapped", file.mData, file.mSize) || !sWriteFile("./test_tzif_garbage", garbage, sizeof(garbage)))
+                return;
+
+            timezone_t::sSetZoneInfoPath(".");
+            const timezone_t* tz = timezone_t::sFind("test_tzif_mapped");
+            CHECK_TRUE(tz != nullptr);
+            if (tz != nullptr)
+            {
+                CHECK_EQUAL(3600, tz->offsetAt(datetime_t(2023, 1, 15)));
+                CHECK_EQUAL(7200, tz->offsetAt(datetime_t(2023, 7, 15)));
+                CHECK_TRUE(tz->utcToLocal(datetime_t(2023, 10, 29, 0, 59, 59)) == datetime_t(2023, 10, 29, 2, 59, 59));
+                CHECK_TRUE(tz == timezone_t::sFind("test_tzif_mapped"));
+            }
+
+            // Invalid files are unmapped again and not cached
+            CHECK_TRUE(timezone_t::sFind("test_tzif_garbage") == nullptr);
+            CHECK_TRUE(timezone_t::sFind("test_tzif_missing") == nullptr);
+
+            // Misses are remembered until the zoneinfo directory is set again
+            if (sWriteFile("./test_tzif_missing", file.mData, file.mSize))
+            {
+                CHECK_TRUE(timezone_t::sFind("test_tzif_missing") == nullptr);
+                timezone_t::sSetZoneInfoPath(".");
+                CHECK_TRUE(timezone_t::sFind("test_tzif_missing") != nullptr);
+            }
+            timezone_t::sSetZoneInfoPath("/usr/share/zoneinfo");
+
+            // The mapped zone stays cached, removing its file only unlinks it (fails on Windows)
+            remove("./test_tzif_mapped");
+            remove("./test_tzif_garbage");
+            remove("./test_tzif_missing");
+        }
+
+        UNITTEST_TEST(builtin)
+        {
+            // Compiled-in zones are found without a zoneinfo directory
+            timezone_t::sSetZoneInfoPath("/nonexistent");
+            const timezone_t* tz = timezone_t::sFind("Asia/Tokyo");
+            CHECK_TRUE(tz != nullptr);
+            if (tz != nullptr)
+            {
+                CHECK_EQUAL(9 * 3600, tz->offsetAt(datetime_t(2023, 7, 1)));
+                CHECK_TRUE(tz->utcToLocal(datetime_t(1960, 7, 1)) == datetime_t(1960, 7, 1, 9, 0, 0));
+            }
+            tz = timezone_t::sFind("Europe/London");
+            CHECK_TRUE(tz != nullptr);
+            if (tz != nullptr)
+            {
+                CHECK_EQUAL(0, tz->offsetAt(datetime_t(2023, 1, 1)));
+                CHECK_EQUAL(3600, tz->offsetAt(datetime_t(2023, 7, 1)));
+            }
+            CHECK_TRUE(timezone_t::sFind("Europe/Not_A_Zone") == nullptr);
+            timezone_t::sSetZoneInfoPath("/usr/share/zoneinfo");
+        }
+
+        UNITTEST_TEST(zoneinfo)
+        {
+            // Only when the system has a zoneinfo database
+            const timezone_t* tz = timezone_t::sFind("Europe/Amsterdam");
+            if (tz != nullptr)
+            {
+                CHECK_EQUAL(3600, tz->offsetAt(datetime_t(2023, 1, 15)));
+                CHECK_EQUAL(7200, tz->offsetAt(datetime_t(2023, 7, 15)));
+                CHECK_EQUAL(7200, tz->offsetAt(datetime_t(2060, 7, 15)));
+                CHECK_TRUE(tz == timezone_t::sFind("Europe/Amsterdam"));
+
+                // Sorted batch over many transitions
+                datetime_t in[512];
+                datetime_t out[512];
+                datetime_t dt(1970, 1, 1);
+                for (s32 i = 0; i < 512; ++i)
+                {
+                    in[i] = dt;
+                    dt.addDays(47);
+                }
+                tz->utcToLocal(in, out, 512);
+                for (s32 i = 0; i < 512; ++i)
+                    CHECK_TRUE(out[i] == tz->utcToLocal(in[i]));
+            }
+        }
+    }
+}
+UNITTEST_SUITE_END